@@ -0,0 +1,243 @@
+// adaptive.cpp - adaptive sampling: boost windows, pre-trigger rings, captures
+// Pure logic, NO raylib/drawing includes
+#include "adaptive.h"
+#include "collector.h"
+#include "event_log.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+
+AdaptiveConfig adaptiveConfig;
+
+// The anomaly detector's thresholds: CPU and RAM in percent, NET as a
+// multiple of its baseline. approach opens a boost, and so does a reading
+// that jumps this far from the moving average; trigger starts a capture.
+struct Rule { float trigger, approach, jump; bool relative; };
+static const Rule RULES[AM_COUNT] = {
+    { 90.f, 75.f, 15.f, false },
+    { 95.f, 88.f,  5.f, false },
+    { 10.f,  5.f,  0.f, true  },
+};
+static const float NET_FLOOR_KBPS = 64.f;   // slower than this, the network never counts
+
+struct Reading { double t; float v; };
+
+struct MetricState {
+    int    collector  = -1;
+    int    probe      = -1;
+    bool   probeFast  = false;
+    double probeT     = 0.0;    // last probe reading; while recent, collector readings are ignored
+    float  avg        = -1.f;   // moving average: 2 s, or NET's 30 s baseline
+    double lastT      = 0.0;
+    double boostUntil = 0.0;
+    bool   fast       = false;  // the collector is on the fast cadence
+    bool   over       = false;  // the last reading was over the trigger
+    double overSince  = 0.0;
+    float  overPeak   = 0.f;
+    double lastBurstLog = -1e9;
+    int    burstsUnlogged = 0;
+    std::deque<Reading> ring;   // the last preSec seconds
+};
+
+static std::mutex      s_mutex;
+static MetricState     s_metric[AM_COUNT];
+static bool            s_active  = false;
+static bool            s_holdCpu = false;
+static AdaptiveCapture s_filling, s_done;
+static bool            s_capturing = false;
+static double          s_triggerT  = 0.0;
+static int             s_nextId    = 1;
+
+static double SteadySec() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void FormatValue(int m, float v, char* buf, size_t size) {
+    if (m != AM_NET)      snprintf(buf, size, "%.0f%%", v);
+    else if (v >= 1024.f) snprintf(buf, size, "%.1f MB/s", v / 1024.f);
+    else                  snprintf(buf, size, "%.0f KB/s", v);
+}
+
+// Callers hold s_mutex. The collector scheduler's lock is taken inside it,
+// never the other way round.
+static void ApplyCadence(int m, double now) {
+    MetricState& s = s_metric[m];
+    bool probe = s_active && adaptiveConfig.enabled && adaptiveConfig.cpuProbe;
+    if (s.probe >= 0 && probe != s.probeFast) {
+        s.probeFast = probe;
+        if (probe) SetCollectorCadence(s.probe, adaptiveConfig.fastMs);
+        else       ResetCollectorCadence(s.probe);
+    }
+    bool boost = s_active && adaptiveConfig.enabled && now < s.boostUntil;
+    bool fast  = boost || (m == AM_CPU && s_holdCpu);
+    if (fast == s.fast) return;
+    s.fast = fast;
+    if (fast) SetCollectorCadence(s.collector, adaptiveConfig.fastMs);
+    else      ResetCollectorCadence(s.collector);
+    if (boost) {
+        char buf[96];
+        snprintf(buf, sizeof(buf), "[ADAPTIVE] %s sampling at %d Hz", ADAPTIVE_METRIC_NAMES[m],
+                 1000 / adaptiveConfig.fastMs);
+        LogEvent(EV_DEBUG, buf);
+    }
+}
+
+static void StartCapture(const std::string& reason, double now) {
+    if (s_capturing) return;
+    s_capturing = true;
+    s_triggerT  = now;
+    s_filling   = AdaptiveCapture();
+    s_filling.id     = s_nextId++;
+    s_filling.reason = reason;
+    s_filling.before = (float)adaptiveConfig.preSec;
+    s_filling.after  = (float)adaptiveConfig.postSec;
+    for (int m = 0; m < AM_COUNT; m++) {
+        MetricState& s = s_metric[m];
+        int before = 0;
+        double first = now;
+        for (const Reading& r : s.ring) {
+            if (r.t < now - adaptiveConfig.preSec) continue;
+            s_filling.series[m].push_back({ (float)(r.t - now), r.v });
+            if (before++ == 0) first = r.t;
+        }
+        // The rate the readings actually came at, not one the config promises
+        s_filling.preHz[m] = before > 1 && now > first ? (float)((before - 1) / (now - first)) : 0.f;
+        // Everything is recorded fast until the capture is complete
+        s.boostUntil = std::max(s.boostUntil, now + adaptiveConfig.postSec);
+        ApplyCadence(m, now);
+    }
+}
+
+void AdaptiveBind(AdaptiveMetric m, int collectorId) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_metric[m].collector = collectorId;
+}
+
+void AdaptiveBindProbe(AdaptiveMetric m, int collectorId) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_metric[m].probe = collectorId;
+}
+
+static void SampleLocked(AdaptiveMetric m, float value, double now) {
+    MetricState& s = s_metric[m];
+    const Rule&  r = RULES[m];
+
+    // Judged against the average before it takes this reading in
+    bool  counts = !r.relative || value >= NET_FLOOR_KBPS;
+    float level  = r.relative ? value / std::max(s.avg, 1.f) : value;
+    bool  jump   = r.jump > 0.f && s.avg >= 0.f && fabsf(value - s.avg) >= r.jump;
+    double dt    = s.lastT > 0.0 ? now - s.lastT : 0.0;
+    s.lastT = now;
+    if (s.avg < 0.f) s.avg = value;
+    else             s.avg += (value - s.avg) * (1.f - expf(-(float)dt / (r.relative ? 30.f : 2.f)));
+
+    s.ring.push_back({ now, value });
+    while (s.ring.front().t < now - adaptiveConfig.preSec) s.ring.pop_front();
+    if (s_capturing && now <= s_triggerT + adaptiveConfig.postSec)
+        s_filling.series[m].push_back({ (float)(now - s_triggerT), value });
+
+    if (counts && (level >= r.approach || jump)) s.boostUntil = now + adaptiveConfig.windowSec;
+
+    // Over the trigger: capture on the way up, report the burst on the way
+    // down. Bursts are logged once per window, with a count of the rest.
+    bool over = counts && level >= r.trigger;
+    char val[32];
+    if (over && !s.over) {
+        s.overSince = now;
+        s.overPeak  = value;
+        FormatValue(m, value, val, sizeof(val));
+        StartCapture(std::string(ADAPTIVE_METRIC_NAMES[m]) + " " + val, now);
+    } else if (over) {
+        s.overPeak = std::max(s.overPeak, value);
+    } else if (s.over) {
+        if (now - s.lastBurstLog >= adaptiveConfig.windowSec) {
+            char buf[128];
+            FormatValue(m, s.overPeak, val, sizeof(val));
+            int n = snprintf(buf, sizeof(buf), "[ADAPTIVE] %s burst %.2f s, peak %s, read at %.0f Hz",
+                             ADAPTIVE_METRIC_NAMES[m], now - s.overSince, val, dt > 0.0 ? 1.0 / dt : 0.0);
+            if (s.burstsUnlogged > 0 && n > 0 && n < (int)sizeof(buf))
+                snprintf(buf + n, sizeof(buf) - n, " (+%d more)", s.burstsUnlogged);
+            LogEvent(EV_WARN, buf);
+            s.lastBurstLog   = now;
+            s.burstsUnlogged = 0;
+        } else {
+            s.burstsUnlogged++;
+        }
+    }
+    s.over = over;
+    ApplyCadence(m, now);
+}
+
+void AdaptiveSample(AdaptiveMetric m, float value) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_active || !adaptiveConfig.enabled) return;
+    double now = SteadySec();
+    if (now - s_metric[m].probeT < 1.0) return;
+    SampleLocked(m, value, now);
+}
+
+void AdaptiveProbeSample(AdaptiveMetric m, float value) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_active || !adaptiveConfig.enabled || !s_metric[m].probeFast) return;
+    double now = SteadySec();
+    s_metric[m].probeT = now;
+    SampleLocked(m, value, now);
+}
+
+void AdaptiveTrigger(const std::string& reason) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_active || !adaptiveConfig.enabled) return;
+    StartCapture(reason, SteadySec());
+}
+
+void AdaptiveUpdate(bool active, bool holdCpu) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    double now = SteadySec();
+    if (active != s_active && !active) {
+        for (MetricState& s : s_metric) {
+            s.avg = -1.f; s.lastT = 0.0; s.boostUntil = 0.0; s.over = false; s.probeT = 0.0;
+            s.ring.clear();
+        }
+    }
+    s_active  = active;
+    s_holdCpu = holdCpu;
+    for (int m = 0; m < AM_COUNT; m++) ApplyCadence(m, now);
+
+    if (!s_capturing || (s_active && now < s_triggerT + adaptiveConfig.postSec)) return;
+    s_capturing = false;
+    if (!s_active) return;   // cut short: dropped
+
+    std::string peaks;
+    for (int m = 0; m < AM_COUNT; m++) {
+        float peak = 0.f;
+        for (const AdaptivePoint& p : s_filling.series[m]) peak = std::max(peak, p.v);
+        s_filling.peak[m] = peak;
+        char val[32];
+        FormatValue(m, peak, val, sizeof(val));
+        peaks += std::string(" ") + ADAPTIVE_METRIC_NAMES[m] + " " + val;
+    }
+    char buf[224];
+    snprintf(buf, sizeof(buf), "[ADAPTIVE] Captured %s: %d s before at %.0f Hz, %d s after; peaks%s",
+             s_filling.reason.c_str(), adaptiveConfig.preSec, s_filling.preHz[AM_CPU],
+             adaptiveConfig.postSec, peaks.c_str());
+    LogEvent(EV_INFO, buf);
+    s_done = std::move(s_filling);
+    s_filling = AdaptiveCapture();
+}
+
+AdaptiveStatus GetAdaptiveStatus() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    AdaptiveStatus st;
+    for (int m = 0; m < AM_COUNT; m++) st.boosted[m] = s_metric[m].fast;
+    st.capturing = s_capturing;
+    st.captureId = s_done.id;
+    return st;
+}
+
+AdaptiveCapture GetAdaptiveCapture() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_done;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <string>
+#include <vector>
+
+// ── Adaptive sampling ─────────────────────────────────────────────────────────
+// The CPU, RAM and network collectors run at their base cadence (1 s) until
+// a reading comes near an anomaly threshold or jumps away from its recent
+// average. That metric's collector then switches to the fast cadence for a
+// window, renewed for as long as the reason lasts. Every reading also goes
+// into a ring covering the last few seconds. When a reading crosses the
+// threshold (often a burst a 1 s average would hide) or the anomaly
+// detector fires, a capture takes the ring and keeps filling for the
+// seconds after.
+//
+// A boost starts only once a reading shows something, which for a 1 s
+// reading is after a sub-second burst is over. So a metric can also have a
+// probe: a reading that runs at the fast cadence the whole time, and is
+// what the ring, the thresholds and the capture see. CPU has one, off by
+// default: it uses only the aggregate line, but the kernel still generates
+// all of /proc/stat (every CPU and the intr line) for each read, 20 times a
+// second at 50 ms, which is hundreds of microseconds a read on a many-core
+// host. Without it, and always for RAM and NET, the pre-trigger part of a
+// capture is at the collector's cadence: 1 Hz unless a boost was already
+// running.
+enum AdaptiveMetric { AM_CPU = 0, AM_RAM, AM_NET, AM_COUNT };
+
+inline const char* ADAPTIVE_METRIC_NAMES[] = { "CPU", "RAM", "NET" };
+
+struct AdaptiveConfig {
+    bool enabled   = true;
+    int  fastMs    = 50;    // boosted cadence, 20..100 ms (50..10 Hz)
+    int  windowSec = 10;    // a boost lasts this long after its last reason
+    int  preSec    = 5;     // capture: seconds kept before the trigger
+    int  postSec   = 5;     //          and recorded after it
+    bool cpuProbe  = false; // CPU probe at the fast cadence the whole time (see above)
+};
+
+// A capture's readings, t in seconds from the trigger
+struct AdaptivePoint { float t, v; };
+
+struct AdaptiveCapture {
+    int         id = 0;             // 0 = none yet
+    std::string reason;
+    float       before = 0.f, after = 0.f;   // seconds covered either side of the trigger
+    std::vector<AdaptivePoint> series[AM_COUNT];
+    float       peak[AM_COUNT]   = {};
+    float       preHz[AM_COUNT]  = {};   // reading rate before the trigger, as recorded
+};
+
+struct AdaptiveStatus {
+    bool boosted[AM_COUNT] = {};
+    bool capturing = false;         // post-trigger part still filling
+    int  captureId = 0;             // of the last complete capture
+};
+
+extern AdaptiveConfig adaptiveConfig;
+
+// Ties a metric to the collector whose cadence it drives
+void AdaptiveBind(AdaptiveMetric m, int collectorId);
+// A reading, from the collector's thread. NET is in KB/s and judged against
+// its own 30 s baseline, like the anomaly detector's NET SPIKE. Ignored
+// while the metric's probe is delivering.
+void AdaptiveSample(AdaptiveMetric m, float value);
+// The probe collector runs at the fast cadence while adaptive sampling and
+// the probe are on, at its own otherwise, and its readings count only then.
+// Where it has nothing to read (off Linux) it never samples, and the
+// collector's readings count as before.
+void AdaptiveBindProbe(AdaptiveMetric m, int collectorId);
+void AdaptiveProbeSample(AdaptiveMetric m, float value);
+// The anomaly detector fired: capture, unless one is already filling
+void AdaptiveTrigger(const std::string& reason);
+// Main thread, every update. active: real data is on. holdCpu keeps CPU at
+// the fast cadence whatever the readings (the stress run's load controller).
+// Ends expired boosts and completes the capture.
+void AdaptiveUpdate(bool active, bool holdCpu);
+
+AdaptiveStatus  GetAdaptiveStatus();
+AdaptiveCapture GetAdaptiveCapture();   // the last complete one
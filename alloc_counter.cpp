@@ -0,0 +1,76 @@
+// alloc_counter.cpp - counting replacements for global operator new/delete
+// Pure logic, NO raylib/drawing includes
+#include "alloc_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static thread_local uint64_t s_threadAllocs = 0;
+static std::atomic<uint64_t> s_totalAllocs{0};
+
+uint64_t ThreadAllocCount() { return s_threadAllocs; }
+uint64_t TotalAllocCount()  { return s_totalAllocs.load(std::memory_order_relaxed); }
+
+static void* CountedAlloc(std::size_t size) {
+    s_threadAllocs++;
+    s_totalAllocs.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+static void* CountedAlignedAlloc(std::size_t size, std::size_t align) {
+    s_threadAllocs++;
+    s_totalAllocs.fetch_add(1, std::memory_order_relaxed);
+    if (align < sizeof(void*)) align = sizeof(void*);
+    size = (size + align - 1) / align * align;
+#if defined(_WIN32)
+    return _aligned_malloc(size ? size : align, align);
+#else
+    void* p = nullptr;
+    return posix_memalign(&p, align, size ? size : align) == 0 ? p : nullptr;
+#endif
+}
+
+static void AlignedFree(void* p) {
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+// ── Replacements ──────────────────────────────────────────────────────────────
+void* operator new(std::size_t size) {
+    if (void* p = CountedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    if (void* p = CountedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept   { return CountedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+
+void operator delete(void* p) noexcept                          { std::free(p); }
+void operator delete[](void* p) noexcept                        { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept             { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept           { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept   { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+void* operator new(std::size_t size, std::align_val_t al) {
+    if (void* p = CountedAlignedAlloc(size, (std::size_t)al)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size, std::align_val_t al) {
+    if (void* p = CountedAlignedAlloc(size, (std::size_t)al)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept   { return CountedAlignedAlloc(size, (std::size_t)al); }
+void* operator new[](std::size_t size, std::align_val_t al, const std::nothrow_t&) noexcept { return CountedAlignedAlloc(size, (std::size_t)al); }
+
+void operator delete(void* p, std::align_val_t) noexcept                          { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept                        { AlignedFree(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept             { AlignedFree(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept           { AlignedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept   { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { AlignedFree(p); }
@@ -0,0 +1,10 @@
+#pragma once
+#include <cstdint>
+
+// ── Allocation counter ────────────────────────────────────────────────────────
+// Global operator new/delete are replaced to count heap allocations made
+// through them, per thread and in total. The render loop diffs the calling
+// thread's count around a frame to check that steady frames allocate nothing.
+// Allocations made with malloc directly (raylib, the C library) are not seen.
+uint64_t ThreadAllocCount();   // allocations by the calling thread so far
+uint64_t TotalAllocCount();    // all threads
@@ -0,0 +1,505 @@
+// cgroup.cpp - cgroup v2 limits and incremental hierarchy walker
+// Pure logic, NO raylib/drawing includes
+#include "cgroup.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+  #include <cerrno>
+  #include <dirent.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/resource.h>
+#endif
+
+std::atomic<CgroupSort> cgroupSort{CgroupSort::CPU};
+
+#if defined(__linux__)
+
+static double NowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ── File helpers ──────────────────────────────────────────────────────────────
+static bool ReadSmallFile(const std::string& path, std::string& out) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    char buf[4096];
+    ssize_t n = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    if (n < 0) return false;
+    out.assign(buf, (size_t)n);
+    return true;
+}
+
+// Value of "key N" in a flat keyed file (cpu.stat, memory.stat)
+static bool KeyedValue(const char* text, const char* key, uint64_t& out) {
+    size_t kl = strlen(key);
+    for (const char* p = text; p && *p; ) {
+        if (strncmp(p, key, kl) == 0 && p[kl] == ' ') {
+            out = strtoull(p + kl + 1, nullptr, 10);
+            return true;
+        }
+        p = strchr(p, '\n');
+        if (p) p++;
+    }
+    return false;
+}
+
+// memory.max: "max" or bytes
+static uint64_t ParseMemMax(const std::string& s) {
+    if (s.empty() || s.compare(0, 3, "max") == 0) return 0;
+    return strtoull(s.c_str(), nullptr, 10);
+}
+
+// cpu.max: "$MAX $PERIOD", $MAX may be "max"
+static float ParseCpuMax(const std::string& s) {
+    if (s.empty() || s.compare(0, 3, "max") == 0) return 0.f;
+    char* end = nullptr;
+    double quota  = strtod(s.c_str(), &end);
+    double period = strtod(end, nullptr);
+    return period > 0.0 ? (float)(quota / period) : 0.f;
+}
+
+// First cgroup2 mount in our mount namespace. mountRoot is the part of the
+// hierarchy that mount exposes ("/" unless a container bind-mounted a subtree).
+static bool FindCgroup2Mount(std::string& mount, std::string& mountRoot) {
+    std::ifstream f("/proc/self/mountinfo");
+    std::string line;
+    while (std::getline(f, line)) {
+        size_t sep = line.find(" - ");
+        if (sep == std::string::npos || line.compare(sep + 3, 8, "cgroup2 ") != 0) continue;
+        // id parent major:minor root mountpoint ...
+        char root[512], point[512];
+        if (sscanf(line.c_str(), "%*d %*d %*s %511s %511s", root, point) != 2) continue;
+        mount = point;
+        mountRoot = root;
+        return true;
+    }
+    return false;
+}
+
+static std::string OwnCgroupPath(const std::string& mountRoot) {
+    std::ifstream f("/proc/self/cgroup");
+    std::string line;
+    while (std::getline(f, line)) {
+        if (line.compare(0, 3, "0::") != 0) continue;
+        std::string p = line.substr(3);
+        if (mountRoot != "/" && p.compare(0, mountRoot.size(), mountRoot) == 0)
+            p = p.substr(mountRoot.size());
+        return p.empty() ? "/" : p;
+    }
+    return "/";
+}
+
+static std::string Join(const std::string& mount, const std::string& path) {
+    return path == "/" ? mount : mount + path;
+}
+
+// ── Own limits ────────────────────────────────────────────────────────────────
+static std::mutex   s_limitMutex;
+static CgroupLimits s_limits;
+static double       s_limitsTime = -1e9;
+
+static CgroupLimits ReadLimits() {
+    CgroupLimits l;
+    std::string mountRoot;
+    if (!FindCgroup2Mount(l.mount, mountRoot)) return l;
+    l.path  = OwnCgroupPath(mountRoot);
+    l.valid = true;
+    // Walk up: every ancestor's limit also caps us
+    for (std::string p = l.path; ; ) {
+        std::string dir = Join(l.mount, p), s;
+        if (ReadSmallFile(dir + "/cpu.max", s)) {
+            float c = ParseCpuMax(s);
+            if (c > 0.f && (l.cpuCores == 0.f || c < l.cpuCores)) l.cpuCores = c;
+        }
+        if (ReadSmallFile(dir + "/memory.max", s)) {
+            uint64_t m = ParseMemMax(s);
+            if (m > 0 && (l.memMax == 0 || m < l.memMax)) l.memMax = m;
+        }
+        if (p == "/") break;
+        size_t slash = p.rfind('/');
+        p = slash == 0 ? "/" : p.substr(0, slash);
+    }
+    return l;
+}
+
+CgroupLimits GetCgroupLimits() {
+    std::lock_guard<std::mutex> lock(s_limitMutex);
+    double now = NowSec();
+    if (now - s_limitsTime >= 5.0) {
+        s_limits = ReadLimits();
+        s_limitsTime = now;
+    }
+    return s_limits;
+}
+
+bool CgroupCpuUsage(float& pct) {
+    static uint64_t prevUsage = 0;
+    static double   prevTime  = 0.0;
+    CgroupLimits l = GetCgroupLimits();
+    if (!l.valid || l.cpuCores <= 0.f) { prevTime = 0.0; return false; }
+    std::string s;
+    uint64_t usage;
+    if (!ReadSmallFile(Join(l.mount, l.path) + "/cpu.stat", s) || !KeyedValue(s.c_str(), "usage_usec", usage))
+        return false;
+    double now = NowSec();
+    if (prevTime == 0.0 || usage < prevUsage) {
+        pct = 0.f;
+    } else {
+        double wallUs = (now - prevTime) * 1e6;
+        pct = wallUs > 0.0 ? (float)((usage - prevUsage) * 100.0 / (wallUs * l.cpuCores)) : 0.f;
+        pct = std::min(pct, 100.f);
+    }
+    prevUsage = usage;
+    prevTime  = now;
+    return true;
+}
+
+bool CgroupMemUsage(uint64_t& usedBytes, uint64_t& limitBytes) {
+    CgroupLimits l = GetCgroupLimits();
+    if (!l.valid || l.memMax == 0) return false;
+    std::string dir = Join(l.mount, l.path), s;
+    if (!ReadSmallFile(dir + "/memory.current", s)) return false;
+    uint64_t current = strtoull(s.c_str(), nullptr, 10), inactive = 0;
+    // Same working-set figure the kubelet evicts on: page cache that can be dropped doesn't count
+    if (ReadSmallFile(dir + "/memory.stat", s)) KeyedValue(s.c_str(), "inactive_file", inactive);
+    usedBytes  = current > inactive ? current - inactive : 0;
+    limitBytes = l.memMax;
+    return true;
+}
+
+// ── Walker ────────────────────────────────────────────────────────────────────
+struct CgNode {
+    int      depth    = 0;
+    int      cpuFd    = -1, memFd = -1, ioFd = -1, statFd = -1;
+    bool     lazy     = false;   // out of fds: open/read/close on every sample
+    bool     hasMem   = false;
+    float    cpuCores = 0.f;
+    uint64_t memMax   = 0;
+    uint64_t desc     = 0;       // nr_descendants + nr_dying_descendants when last listed
+    std::vector<std::string> kids;
+    // Previous counters for rates
+    bool     primed   = false;
+    uint64_t usage = 0, rbytes = 0, wbytes = 0;
+    // Latest sample
+    float    cpuPct = 0.f, rdKBps = 0.f, wrKBps = 0.f;
+    uint64_t mem = 0;
+};
+
+static std::atomic<bool>  s_walkRunning{false};
+static std::atomic<bool>  s_walkStop{false};
+static std::mutex         s_treeMutex;
+static CgroupTree         s_tree;
+
+// Keyed by path, so the descendants of X are the contiguous range "X/"...
+static std::map<std::string, CgNode> s_nodes;
+static std::string s_mount;
+
+static std::string ChildPath(const std::string& parent, const std::string& name) {
+    return (parent == "/" ? "" : parent) + "/" + name;
+}
+
+static int OpenStat(const std::string& path, bool& lazy) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0 && (errno == EMFILE || errno == ENFILE)) lazy = true;
+    return fd;
+}
+
+static void CloseNode(CgNode& n) {
+    if (n.cpuFd >= 0) close(n.cpuFd);
+    if (n.memFd >= 0) close(n.memFd);
+    if (n.ioFd  >= 0) close(n.ioFd);
+    if (n.statFd >= 0) close(n.statFd);
+}
+
+static void EraseSubtree(const std::string& path) {
+    auto it = s_nodes.find(path);
+    if (it == s_nodes.end()) return;
+    CloseNode(it->second);
+    s_nodes.erase(it);
+    std::string prefix = path + "/";
+    auto first = s_nodes.lower_bound(prefix), end = first;
+    for (; end != s_nodes.end() && end->first.compare(0, prefix.size(), prefix) == 0; ++end)
+        CloseNode(end->second);
+    s_nodes.erase(first, end);
+}
+
+static std::vector<std::string> ListChildren(const std::string& dir) {
+    std::vector<std::string> out;
+    DIR* d = opendir(dir.c_str());
+    if (!d) return out;
+    while (struct dirent* e = readdir(d)) {
+        if (e->d_type != DT_DIR || e->d_name[0] == '.') continue;
+        out.push_back(e->d_name);
+    }
+    closedir(d);
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+static void ReadNodeLimits(const std::string& dir, CgNode& n) {
+    std::string s;
+    n.cpuCores = ReadSmallFile(dir + "/cpu.max", s) ? ParseCpuMax(s) : 0.f;
+    n.memMax   = ReadSmallFile(dir + "/memory.max", s) ? ParseMemMax(s) : 0;
+}
+
+// pread from the cached fd, or a one-shot open when we ran out of descriptors
+static ssize_t ReadStat(int fd, bool lazy, const std::string& path, char* buf, size_t sz) {
+    ssize_t n;
+    if (fd >= 0) {
+        n = pread(fd, buf, sz - 1, 0);
+    } else if (lazy) {
+        int tmp = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (tmp < 0) return -1;
+        n = read(tmp, buf, sz - 1);
+        close(tmp);
+    } else {
+        return -1;
+    }
+    if (n >= 0) buf[n] = 0;
+    return n;
+}
+
+// cgroup.stat: any mkdir or rmdir anywhere below a cgroup moves this sum
+static bool ReadDescendants(CgNode& n, const std::string& dir, uint64_t& out) {
+    char buf[256];
+    if (ReadStat(n.statFd, n.lazy, dir + "/cgroup.stat", buf, sizeof(buf)) < 0) return false;
+    uint64_t desc = 0, dying = 0;
+    KeyedValue(buf, "nr_descendants", desc);
+    KeyedValue(buf, "nr_dying_descendants", dying);
+    out = desc + dying;
+    return true;
+}
+
+static int ListNode(const std::string& path);
+
+// New cgroup: open its stat files and pick up whatever children it already has
+static int AddNode(const std::string& path, int depth) {
+    CgNode& n = s_nodes[path];
+    n.depth = depth;
+    std::string dir = Join(s_mount, path);
+    n.cpuFd = OpenStat(dir + "/cpu.stat", n.lazy);
+    n.memFd = OpenStat(dir + "/memory.current", n.lazy);
+    n.ioFd  = OpenStat(dir + "/io.stat", n.lazy);
+    n.statFd = OpenStat(dir + "/cgroup.stat", n.lazy);
+    n.hasMem = n.memFd >= 0 || (n.lazy && access((dir + "/memory.current").c_str(), R_OK) == 0);
+    ReadDescendants(n, dir, n.desc);   // before listing, so a change during it shows next tick
+    return ListNode(path);
+}
+
+// Re-list one directory: drop vanished children (with their subtrees), add
+// new ones. Returns the number of directories listed.
+static int ListNode(const std::string& path) {
+    auto it = s_nodes.find(path);
+    if (it == s_nodes.end()) return 0;
+    std::string dir = Join(s_mount, path);
+    ReadNodeLimits(dir, it->second);
+    std::vector<std::string> now = ListChildren(dir);
+    std::vector<std::string> old = it->second.kids;
+    it->second.kids = now;
+    int depth = it->second.depth, listed = 1;
+    for (const std::string& k : old)
+        if (!std::binary_search(now.begin(), now.end(), k)) EraseSubtree(ChildPath(path, k));
+    for (const std::string& k : now) {
+        std::string cp = ChildPath(path, k);
+        if (!s_nodes.count(cp)) listed += AddNode(cp, depth + 1);
+    }
+    return listed;
+}
+
+// Re-lists a cgroup whose descendant count moved, then goes down into those
+// of its existing children whose count moved too. Unchanged subtrees are
+// not touched, so churn under one pod costs a listing per level on its path
+// plus a cgroup.stat pread per sibling. A create and a delete that cancel
+// out are left to the round-robin slice.
+static int RelistChanged(const std::string& path) {
+    auto it = s_nodes.find(path);
+    if (it == s_nodes.end()) return 0;
+    uint64_t desc;
+    if (!ReadDescendants(it->second, Join(s_mount, path), desc) || desc == it->second.desc) return 0;
+    it->second.desc = desc;
+    std::vector<std::string> before = it->second.kids;
+    int listed = ListNode(path);   // new children are added whole, vanished ones dropped
+    std::vector<std::string> kids = s_nodes[path].kids;
+    for (const std::string& k : kids)
+        if (std::binary_search(before.begin(), before.end(), k)) listed += RelistChanged(ChildPath(path, k));
+    return listed;
+}
+
+// io.stat: "8:0 rbytes=1 wbytes=2 rios=3 ..." per device
+static void SumIoStat(const char* text, uint64_t& rd, uint64_t& wr) {
+    rd = wr = 0;
+    for (const char* p = text; (p = strstr(p, "bytes=")); p += 6) {
+        if (p > text && p[-1] == 'r')      rd += strtoull(p + 6, nullptr, 10);
+        else if (p > text && p[-1] == 'w') wr += strtoull(p + 6, nullptr, 10);
+    }
+}
+
+static void RaiseFdLimit() {
+    struct rlimit rl;
+    if (getrlimit(RLIMIT_NOFILE, &rl) != 0 || rl.rlim_cur >= rl.rlim_max) return;
+    rl.rlim_cur = std::min<rlim_t>(rl.rlim_max, 65536);
+    setrlimit(RLIMIT_NOFILE, &rl);
+}
+
+static void WalkerThread() {
+    std::string mountRoot;
+    if (!FindCgroup2Mount(s_mount, mountRoot)) {
+        std::lock_guard<std::mutex> lock(s_treeMutex);
+        s_tree = CgroupTree();
+        s_walkRunning = false;
+        return;
+    }
+    RaiseFdLimit();
+    AddNode("/", 0);
+    std::string cursor = "/";
+    double prevTime = NowSec();
+
+    while (!s_walkStop.load()) {
+        double t0 = NowSec();
+        int listed = 0;
+
+        // Structure: only the subtrees whose descendant count moved are
+        // re-listed, plus a small round-robin slice that catches a create
+        // and a delete cancelling out in the counts
+        listed += RelistChanged("/");
+        size_t slice = std::max<size_t>(16, s_nodes.size() / 16);
+        std::vector<std::string> batch;
+        auto it = s_nodes.lower_bound(cursor);
+        while (batch.size() < slice && batch.size() < s_nodes.size()) {
+            if (it == s_nodes.end()) it = s_nodes.begin();
+            batch.push_back(it->first);
+            ++it;
+        }
+        cursor = it == s_nodes.end() ? "/" : it->first;
+        for (const std::string& p : batch) listed += ListNode(p);
+
+        // Sample every node from its open fds
+        double now = NowSec(), wallUs = (now - prevTime) * 1e6;
+        prevTime = now;
+        std::vector<std::string> gone;
+        char buf[4096];
+        for (auto& kv : s_nodes) {
+            CgNode& n = kv.second;
+            std::string dir = n.lazy ? Join(s_mount, kv.first) : std::string();
+            uint64_t usage = 0, rd = 0, wr = 0;
+            if (ReadStat(n.cpuFd, n.lazy, dir + "/cpu.stat", buf, sizeof(buf)) < 0) {
+                // ENODEV: the cgroup was removed under us
+                if (kv.first != "/") gone.push_back(kv.first);
+                continue;
+            }
+            KeyedValue(buf, "usage_usec", usage);
+            if (n.hasMem && ReadStat(n.memFd, n.lazy, dir + "/memory.current", buf, sizeof(buf)) > 0)
+                n.mem = strtoull(buf, nullptr, 10);
+            if (ReadStat(n.ioFd, n.lazy, dir + "/io.stat", buf, sizeof(buf)) >= 0)
+                SumIoStat(buf, rd, wr);
+            if (n.primed && wallUs > 0.0) {
+                n.cpuPct = usage >= n.usage ? (float)((usage - n.usage) * 100.0 / wallUs) : 0.f;
+                n.rdKBps = rd >= n.rbytes ? (float)((rd - n.rbytes) / 1024.0 / (wallUs / 1e6)) : 0.f;
+                n.wrKBps = wr >= n.wbytes ? (float)((wr - n.wbytes) / 1024.0 / (wallUs / 1e6)) : 0.f;
+            }
+            n.usage = usage; n.rbytes = rd; n.wbytes = wr;
+            n.primed = true;
+        }
+        for (const std::string& p : gone) EraseSubtree(p);
+
+        // Top-K by the current sort key; copying thousands of entries to the
+        // UI every frame is what we are avoiding
+        std::vector<std::pair<const std::string*, const CgNode*>> order;
+        order.reserve(s_nodes.size());
+        for (auto& kv : s_nodes) order.push_back({ &kv.first, &kv.second });
+        CgroupSort key = cgroupSort.load();
+        auto score = [key](const CgNode* n) {
+            switch (key) {
+                case CgroupSort::MEMORY: return (double)n->mem;
+                case CgroupSort::IO:     return (double)(n->rdKBps + n->wrKBps);
+                default:                 return (double)n->cpuPct;
+            }
+        };
+        size_t k = std::min<size_t>(order.size(), CGROUP_TOP);
+        std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                          [&](const auto& a, const auto& b) {
+                              double sa = score(a.second), sb = score(b.second);
+                              return sa != sb ? sa > sb : *a.first < *b.first;
+                          });
+
+        CgroupTree t;
+        t.available = true;
+        t.mount     = s_mount;
+        t.groups    = (int)s_nodes.size();
+        t.listed    = listed;
+        t.top.reserve(k);
+        for (size_t i = 0; i < k; i++) {
+            const CgNode& n = *order[i].second;
+            CgroupEntry e;
+            e.path = *order[i].first;
+            e.depth = n.depth;
+            e.cpuPct = n.cpuPct;
+            e.cpuCores = n.cpuCores;
+            e.memBytes = n.mem;
+            e.memMax = n.memMax;
+            e.hasMem = n.hasMem;
+            e.ioReadKBps = n.rdKBps;
+            e.ioWriteKBps = n.wrKBps;
+            t.top.push_back(std::move(e));
+        }
+        t.sampleMs = (float)((NowSec() - t0) * 1000.0);
+        {
+            std::lock_guard<std::mutex> lock(s_treeMutex);
+            s_tree = std::move(t);
+        }
+
+        for (int i = 0; i < 10 && !s_walkStop.load(); i++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    for (auto& kv : s_nodes) CloseNode(kv.second);
+    s_nodes.clear();
+    s_walkRunning = false;
+    // A start that raced the exit only cancelled the stop: take it up here
+    bool expected = false;
+    if (!s_walkStop.load() && s_walkRunning.compare_exchange_strong(expected, true))
+        std::thread(WalkerThread).detach();
+}
+
+void StartCgroupWalker() {
+    bool expected = false;
+    if (!s_walkRunning.compare_exchange_strong(expected, true)) {
+        s_walkStop = false;   // a pending stop is cancelled; thread keeps going
+        return;
+    }
+    s_walkStop = false;
+    std::thread(WalkerThread).detach();
+}
+
+#else
+
+CgroupLimits GetCgroupLimits()                  { return CgroupLimits(); }
+bool CgroupCpuUsage(float&)                     { return false; }
+bool CgroupMemUsage(uint64_t&, uint64_t&)       { return false; }
+void StartCgroupWalker()                        {}
+static std::mutex s_treeMutex;
+static CgroupTree s_tree;
+static std::atomic<bool> s_walkStop{false};
+
+#endif
+
+void StopCgroupWalker() {
+    s_walkStop = true;
+}
+
+CgroupTree GetCgroupTree() {
+    std::lock_guard<std::mutex> lock(s_treeMutex);
+    return s_tree;
+}
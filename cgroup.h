@@ -0,0 +1,61 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ── cgroup v2 limits of this process ──────────────────────────────────────────
+// Inside a container the host's /proc/stat and /proc/meminfo describe the node,
+// not the pod. The effective limit is the tightest cpu.max / memory.max from
+// our own cgroup up to the v2 mount root. Linux only; elsewhere valid = false.
+struct CgroupLimits {
+    bool        valid    = false;   // cgroup v2 mounted and our cgroup found
+    std::string mount;              // e.g. "/sys/fs/cgroup"
+    std::string path;               // our cgroup relative to the mount, "/" for root
+    float       cpuCores = 0.f;     // cpu.max quota / period, 0 = unlimited
+    uint64_t    memMax   = 0;       // bytes, 0 = unlimited
+};
+
+CgroupLimits GetCgroupLimits();     // cached, re-read every few seconds
+
+// Usage relative to the limits above. Both return false when that resource
+// is unlimited, so callers keep their host-wide numbers.
+bool CgroupCpuUsage(float& pct);                          // % of cpuCores since the last call
+bool CgroupMemUsage(uint64_t& usedBytes, uint64_t& limitBytes);   // working set: current - inactive_file
+
+// ── Hierarchy walker ──────────────────────────────────────────────────────────
+// Background thread that samples every cgroup once a second. Stat files stay
+// open and are read with pread; directories are re-listed a slice at a time,
+// and those under a cgroup whose descendant count moved right away.
+enum class CgroupSort { CPU = 0, MEMORY, IO, COUNT };
+
+inline const char* CGROUP_SORT_NAMES[] = { "CPU", "MEMORY", "IO" };
+
+struct CgroupEntry {
+    std::string path;               // relative to the mount
+    int         depth      = 0;
+    float       cpuPct     = 0.f;   // of one CPU
+    float       cpuCores   = 0.f;   // own cpu.max, 0 = unlimited
+    uint64_t    memBytes   = 0;
+    uint64_t    memMax     = 0;     // own memory.max, 0 = unlimited
+    bool        hasMem     = false; // memory controller enabled here
+    float       ioReadKBps = 0.f, ioWriteKBps = 0.f;
+};
+
+struct CgroupTree {
+    bool        available = false;
+    std::string mount;
+    int         groups    = 0;      // total cgroups tracked
+    int         listed    = 0;      // directories re-listed on the last tick
+    float       sampleMs  = 0.f;    // cost of the last tick
+    std::vector<CgroupEntry> top;   // highest by cgroupSort, at most CGROUP_TOP
+};
+
+static const int CGROUP_TOP = 256;
+
+// Set by the UI thread, read by the walker
+extern std::atomic<CgroupSort> cgroupSort;
+
+void       StartCgroupWalker();
+void       StopCgroupWalker();
+CgroupTree GetCgroupTree();
@@ -0,0 +1,312 @@
+// collector.cpp - collector scheduler: timer wheel, worker pool, cost accounting
+// Pure logic, NO raylib/drawing includes
+#include "collector.h"
+#include "sysfs_util.h"
+#include "event_log.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+std::map<std::string, int> collectorCadenceConfig;
+
+using Clock = std::chrono::steady_clock;
+
+struct Collector {
+    std::string name, source;
+    CollectorFn fn;
+    int      baseMs = 1000, cadenceMs = 1000;
+    float    budgetMs = 1.f;
+    uint32_t gen      = 0;        // bumped on every schedule; older wheel entries are dropped
+    uint64_t due      = 0;        // tick of the live wheel entry
+    bool     running  = false;    // queued or on a worker
+    double   lastOverLog = -1e9;  // seconds, for the once-a-minute budget warning
+    CollectorInfo info;
+};
+
+// ── Timer wheel ───────────────────────────────────────────────────────────────
+// Level n holds what is due 64^n to 64^(n+1) ticks out, in slots of 64^n
+// ticks; when the level below wraps, the next slot up is cascaded into it.
+// Only level 0 fires, so an entry is touched at most once per level.
+static const int WHEEL_LEVELS = 3, WHEEL_BITS = 6, WHEEL_SLOTS = 1 << WHEEL_BITS;
+
+struct WheelEntry { int id; uint32_t gen; uint64_t expiry; };
+
+static std::vector<WheelEntry> s_wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t                s_tick = 0;      // last tick processed
+
+static std::mutex              s_mutex;         // collectors, wheel, queue
+static std::condition_variable s_timerCv, s_workCv;
+static std::deque<Collector>   s_collectors;    // deque: stable addresses for the workers
+static std::deque<std::vector<int>> s_queue;    // jobs: collectors sharing one source read
+static std::vector<std::thread> s_threads;
+static int                     s_busy = 0;      // jobs on a worker
+static bool                    s_running = false, s_stop = false;
+static Clock::time_point       s_start;
+static long long               s_startWallMs = 0;
+static std::atomic<uint64_t>   s_generation{0};
+static std::atomic<void (*)()> s_notify{nullptr};
+
+static void WheelInsert(const WheelEntry& e) {
+    uint64_t delta = e.expiry - s_tick;   // callers keep expiry > s_tick, except cascades
+    int level = 0;
+    while (level < WHEEL_LEVELS - 1 && delta >= (1ull << (WHEEL_BITS * (level + 1)))) level++;
+    s_wheel[level][(e.expiry >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1)].push_back(e);
+}
+
+// Next run after the current tick at a whole multiple of the cadence on the
+// wall clock, plus 5 ms so a second's reading lands after the clock turns
+static void Schedule(Collector& c, int id) {
+    long long nowMs  = s_startWallMs + (long long)s_tick * COLLECTOR_TICK_MS;
+    long long nextMs = (nowMs / c.cadenceMs + 1) * c.cadenceMs + 5;
+    uint64_t  expiry = (uint64_t)((nextMs - s_startWallMs + COLLECTOR_TICK_MS - 1) / COLLECTOR_TICK_MS);
+    c.gen++;
+    c.due = std::max(expiry, s_tick + 1);
+    WheelInsert({ id, c.gen, c.due });
+}
+
+static void Cascade(int level) {
+    std::vector<WheelEntry> moved;
+    moved.swap(s_wheel[level][(s_tick >> (WHEEL_BITS * level)) & (WHEEL_SLOTS - 1)]);
+    for (const WheelEntry& e : moved) WheelInsert(e);
+}
+
+// One tick: cascade where lower levels wrapped, then fire level 0. Fired
+// collectors are rescheduled on their wall-clock grid, so a late timer
+// thread does not make the cadence drift, and a triggered extra run does
+// not leave a second entry behind.
+static void AdvanceTick(std::vector<int>& fired) {
+    s_tick++;
+    for (int level = WHEEL_LEVELS - 1; level > 0; level--)
+        if ((s_tick & ((1ull << (WHEEL_BITS * level)) - 1)) == 0) Cascade(level);
+
+    std::vector<WheelEntry>& slot = s_wheel[0][s_tick & (WHEEL_SLOTS - 1)];
+    std::vector<WheelEntry>  due;
+    due.swap(slot);
+    for (const WheelEntry& e : due) {
+        if (e.expiry != s_tick) { slot.push_back(e); continue; }   // a later lap
+        Collector& c = s_collectors[e.id];
+        if (e.gen != c.gen) continue;                                // rescheduled since
+        fired.push_back(e.id);
+        Schedule(c, e.id);
+    }
+}
+
+// Collectors with the same source become one job; a collector whose last
+// run has not finished is skipped this time round
+static void Dispatch(const std::vector<int>& fired) {
+    std::vector<std::vector<int>> jobs;
+    for (int id : fired) {
+        Collector& c = s_collectors[id];
+        if (c.running) { c.info.skipped++; continue; }
+        c.running = true;
+        auto same = std::find_if(jobs.begin(), jobs.end(), [&](const std::vector<int>& j) {
+            return !c.source.empty() && s_collectors[j[0]].source == c.source;
+        });
+        if (same != jobs.end()) same->push_back(id);
+        else                    jobs.push_back({ id });
+    }
+    for (auto& j : jobs) s_queue.push_back(std::move(j));
+    if (!jobs.empty()) s_workCv.notify_all();
+}
+
+static void TimerThread() {
+    std::unique_lock<std::mutex> lock(s_mutex);
+    std::vector<int> fired;
+    while (!s_stop) {
+        uint64_t next = UINT64_MAX;
+        for (const Collector& c : s_collectors) next = std::min(next, c.due);
+        if (next == UINT64_MAX) { s_timerCv.wait(lock); continue; }
+
+        Clock::time_point at = s_start + std::chrono::milliseconds(next * COLLECTOR_TICK_MS);
+        if (Clock::now() < at) { s_timerCv.wait_until(lock, at); continue; }
+
+        uint64_t nowTick = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+                               Clock::now() - s_start).count() / COLLECTOR_TICK_MS;
+        fired.clear();
+        while (s_tick < nowTick) AdvanceTick(fired);
+        Dispatch(fired);
+    }
+}
+
+static double SecondsSince(Clock::time_point t) {
+    return std::chrono::duration<double>(Clock::now() - t).count();
+}
+
+static void WorkerThread() {
+    std::unique_lock<std::mutex> lock(s_mutex);
+    std::string text;
+    while (true) {
+        while (!s_stop && s_queue.empty()) s_workCv.wait(lock);
+        if (s_stop) return;
+        std::vector<Collector*> job;
+        for (int id : s_queue.front()) job.push_back(&s_collectors[id]);
+        s_queue.pop_front();
+        s_busy++;
+        std::string source = job[0]->source;
+        lock.unlock();
+
+        // The shared read is charged to the job's collectors in equal parts
+        Clock::time_point t0 = Clock::now();
+        if (source.empty() || !ReadProcFile(source.c_str(), text)) text.clear();
+        double readMs = SecondsSince(t0) * 1000.0 / job.size();
+
+        for (Collector* cp : job) {
+            Collector& c = *cp;   // fn and name never change after registration
+            Clock::time_point t = Clock::now();
+            c.fn(text);
+            float ms = (float)(readMs + SecondsSince(t) * 1000.0);
+
+            lock.lock();
+            CollectorInfo& in = c.info;
+            in.lastMs = ms;
+            in.avgMs  = in.runs == 0 ? ms : in.avgMs + (ms - in.avgMs) * 0.1f;
+            in.maxMs  = std::max(in.maxMs, ms);
+            in.runs++;
+            c.running = false;
+            bool logIt = false;
+            double now = SecondsSince(s_start);
+            if (ms > c.budgetMs) {
+                in.overBudget++;
+                if (now - c.lastOverLog >= 60.0) { c.lastOverLog = now; logIt = true; }
+            }
+            lock.unlock();
+            if (logIt) {
+                char buf[128];
+                snprintf(buf, sizeof(buf), "[COLLECT] %s took %.1f ms, budget %.1f ms",
+                         c.name.c_str(), ms, c.budgetMs);
+                LogEvent(EV_WARN, buf);
+            }
+        }
+
+        // Jobs dispatched together land together: notify after the last one
+        s_generation.fetch_add(1, std::memory_order_release);
+        lock.lock();
+        bool last = --s_busy == 0 && s_queue.empty();
+        void (*notify)() = s_notify.load();
+        if (last && notify) {
+            lock.unlock();
+            notify();
+            lock.lock();
+        }
+    }
+}
+
+// ── Registration and control ──────────────────────────────────────────────────
+static int ClampCadence(int ms) {
+    return std::min(std::max(ms, COLLECTOR_TICK_MS), COLLECTOR_MAX_MS);
+}
+
+int RegisterCollector(const char* name, const char* source, int cadenceMs, float budgetMs, CollectorFn fn) {
+    auto cfg = collectorCadenceConfig.find(name);
+    if (cfg != collectorCadenceConfig.end()) cadenceMs = cfg->second;
+    cadenceMs = ClampCadence(cadenceMs);
+    collectorCadenceConfig[name] = cadenceMs;
+
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_collectors.emplace_back();
+    Collector& c = s_collectors.back();
+    c.name = name; c.source = source; c.fn = std::move(fn);
+    c.baseMs = c.cadenceMs = cadenceMs;
+    c.budgetMs = budgetMs;
+    c.due = UINT64_MAX;
+    int id = (int)s_collectors.size() - 1;
+    if (s_running) { Schedule(c, id); s_timerCv.notify_one(); }
+    return id;
+}
+
+int FindCollector(const char* name) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    for (size_t i = 0; i < s_collectors.size(); i++)
+        if (s_collectors[i].name == name) return (int)i;
+    return -1;
+}
+
+void SetCollectorCadence(int id, int cadenceMs) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (id < 0 || id >= (int)s_collectors.size()) return;
+    Collector& c = s_collectors[id];
+    cadenceMs = ClampCadence(cadenceMs);
+    if (c.cadenceMs == cadenceMs) return;
+    c.cadenceMs = cadenceMs;
+    if (s_running) { Schedule(c, id); s_timerCv.notify_one(); }
+}
+
+void ResetCollectorCadence(int id) {
+    int base;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (id < 0 || id >= (int)s_collectors.size()) return;
+        base = s_collectors[id].baseMs;
+    }
+    SetCollectorCadence(id, base);
+}
+
+void TriggerCollector(int id) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_running || id < 0 || id >= (int)s_collectors.size()) return;
+    Collector& c = s_collectors[id];
+    // A one-off extra entry: the regular one stays, so the cadence is kept
+    WheelInsert({ id, c.gen, s_tick + 1 });
+    c.due = std::min(c.due, s_tick + 1);
+    s_timerCv.notify_one();
+}
+
+void StartCollectors(int workers) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_running) return;
+    s_running = true;
+    s_stop    = false;
+    s_start   = Clock::now();
+    s_startWallMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count();
+    s_tick = 0;
+    // Everything runs once straight away, so the views have data
+    for (size_t i = 0; i < s_collectors.size(); i++) {
+        Schedule(s_collectors[i], (int)i);
+        WheelInsert({ (int)i, s_collectors[i].gen, 1 });
+        s_collectors[i].due = 1;
+    }
+    s_threads.emplace_back(TimerThread);
+    for (int i = 0; i < std::max(1, workers); i++) s_threads.emplace_back(WorkerThread);
+}
+
+void StopCollectors() {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s_running) return;
+        s_stop = true;
+        s_timerCv.notify_all();
+        s_workCv.notify_all();
+    }
+    for (std::thread& t : s_threads) t.join();
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_threads.clear();
+    s_queue.clear();
+    s_busy = 0;
+    for (auto& level : s_wheel)
+        for (auto& slot : level) slot.clear();
+    for (Collector& c : s_collectors) { c.running = false; c.due = UINT64_MAX; }
+    s_running = false;
+}
+
+uint64_t CollectorGeneration() { return s_generation.load(std::memory_order_acquire); }
+
+void SetCollectorNotify(void (*fn)()) { s_notify.store(fn); }
+
+std::vector<CollectorInfo> GetCollectorInfo() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    std::vector<CollectorInfo> out;
+    out.reserve(s_collectors.size());
+    for (const Collector& c : s_collectors) {
+        CollectorInfo in = c.info;
+        in.name = c.name; in.source = c.source;
+        in.cadenceMs = c.cadenceMs; in.baseMs = c.baseMs; in.budgetMs = c.budgetMs;
+        out.push_back(in);
+    }
+    return out;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+// ── Collector scheduler ───────────────────────────────────────────────────────
+// Every periodic sampler registers here with a cadence and a cost budget
+// instead of keeping its own frame-driven timer. A hierarchical timer wheel
+// (10 ms ticks, three levels of 64 slots) on one timer thread decides what
+// is due, and due collectors run on a small worker pool, off the render
+// thread. Collectors due on the same tick that read the same source file
+// run as one job: the file is read once and each gets its text.
+//
+// Cadences are aligned to the wall clock, so a 1000 ms collector runs just
+// after each second and every 1 s reading lands together with the clock.
+// Each run is timed; a collector over its budget is logged, at most once a
+// minute.
+
+// source: the text of the collector's source file, "" when it has none or
+// the file could not be read (the collector then reads for itself)
+using CollectorFn = std::function<void(const std::string& source)>;
+
+struct CollectorInfo {
+    std::string name, source;
+    int      cadenceMs = 0;          // running cadence
+    int      baseMs    = 0;          // configured cadence
+    float    budgetMs  = 0.f;
+    float    lastMs = 0.f, avgMs = 0.f, maxMs = 0.f;   // cost: last run, moving average, worst
+    uint64_t runs       = 0;
+    uint64_t overBudget = 0;         // runs that took longer than the budget
+    uint64_t skipped    = 0;         // due while the previous run was still going
+};
+
+static const int COLLECTOR_TICK_MS = 10;
+static const int COLLECTOR_MAX_MS  = 600000;   // the wheel's reach, about 43 min, with room
+
+// name doubles as the dashboard.cfg key cadence_<name>_ms, which overrides
+// cadenceMs. source: a file read once per job for every collector sharing
+// it, or "" when the collector reads what it needs itself. Returns the id.
+int  RegisterCollector(const char* name, const char* source, int cadenceMs, float budgetMs, CollectorFn fn);
+int  FindCollector(const char* name);                // -1 when unknown
+
+// A temporary cadence, such as fast sampling during a stress run; it is not
+// saved. Reset goes back to the configured one.
+void SetCollectorCadence(int id, int cadenceMs);
+void ResetCollectorCadence(int id);
+void TriggerCollector(int id);                       // run on the next tick
+
+void StartCollectors(int workers);
+void StopCollectors();                               // joins the threads
+
+// Bumped after every job; the main loop redraws when it moves. The notify
+// hook is called from a worker once a batch of jobs has landed, to wake a
+// blocked loop.
+uint64_t CollectorGeneration();
+void     SetCollectorNotify(void (*fn)());
+std::vector<CollectorInfo> GetCollectorInfo();
+
+// dashboard.cfg cadence_<name>_ms values: LoadConfig fills it, registration
+// applies and completes it, SaveConfig writes it back. Main thread only.
+extern std::map<std::string, int> collectorCadenceConfig;
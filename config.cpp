@@ -1,6 +1,20 @@
 #include "config.h"
 #include "theme.h"
 #include "dashboard.h"
+#include "speedtest.h"
+#include "stress_test.h"
+#include "mem_stress.h"
+#include "disk_bench.h"
+#include "psi.h"
+#include "du_scan.h"
+#include "log_tail.h"
+#include "event_log.h"
+#include "frame_pacer.h"
+#include "crt_quality.h"
+#include "layout.h"
+#include "collector.h"
+#include "adaptive.h"
+#include "sysfs_util.h"
 #include "raylib.h"
 #include <fstream>
 #include <string>
@@ -18,6 +32,57 @@ void SaveConfig() {
     GetWidgetStates(ws);
     for (int i = 0; i < WIDGET_COUNT; i++)
         f << "widget_" << i << "=" << (*ws[i] ? 1 : 0) << "\n";
+    const SpeedTestSchedule& sc = speedTestSchedule;
+    f << "speedtest_schedule=" << (sc.enabled ? 1 : 0) << "\n";
+    f << "speedtest_interval_min=" << sc.intervalMin << "\n";
+    f << "speedtest_jitter_sec=" << sc.jitterSec << "\n";
+    f << "speedtest_budget_mb=" << sc.dailyBudgetMB << "\n";
+    f << "speedtest_max_kbps=" << sc.maxTrafficKBps << "\n";
+    f << "stress_workload=" << (int)stressWorkload << "\n";
+    const StressLoadProfile& lp = stressLoad;
+    f << "stress_load_pct=" << lp.targetPct << "\n";
+    f << "stress_ramp=" << (int)lp.ramp << "\n";
+    f << "stress_ramp_from=" << lp.rampFromPct << "\n";
+    f << "stress_ramp_to=" << lp.rampToPct << "\n";
+    f << "stress_ramp_steps=" << lp.rampSteps << "\n";
+    f << "stress_ramp_period=" << lp.rampPeriodSec << "\n";
+    f << "stress_cpus=" << FormatCpuList(lp.cpus) << "\n";
+    const MemStressConfig& mc = memStressConfig;
+    f << "mem_footprint_pct=" << mc.footprintPct << "\n";
+    f << "mem_hugepages=" << (int)mc.hugePages << "\n";
+    f << "mem_numa_local=" << (mc.numaLocal ? 1 : 0) << "\n";
+    f << "mem_duration_sec=" << mc.durationSec << "\n";
+    f << "sysfs_root=" << GetSysfsRoot() << "\n";
+    const DiskBenchConfig& dc = diskBenchConfig;
+    f << "disk_bench_mount=" << dc.mountPoint << "\n";
+    f << "disk_bench_pattern=" << (int)dc.pattern << "\n";
+    f << "disk_bench_block_kb=" << dc.blockKB << "\n";
+    f << "disk_bench_qd=" << dc.queueDepth << "\n";
+    f << "disk_bench_file_mb=" << dc.fileMB << "\n";
+    f << "disk_bench_duration_sec=" << dc.durationSec << "\n";
+    f << "psi_cpu_pct=" << psiConfig.thresholdPct[PSI_CPU] << "\n";
+    f << "psi_mem_pct=" << psiConfig.thresholdPct[PSI_MEMORY] << "\n";
+    f << "psi_io_pct=" << psiConfig.thresholdPct[PSI_IO] << "\n";
+    f << "psi_window_ms=" << psiConfig.windowMs << "\n";
+    f << "du_threads=" << duThreads << "\n";
+    f << "log_tail_path=" << logTailConfig.path << "\n";
+    f << "log_tail_filter=" << logTailConfig.filter << "\n";
+    f << "log_tail_regex=" << (logTailConfig.regex ? 1 : 0) << "\n";
+    f << "event_log_file=" << (eventLogFile.empty() ? "-" : eventLogFile) << "\n";
+    f << "pace_mode=" << (int)framePacerConfig.mode << "\n";
+    f << "pace_fps=" << framePacerConfig.fps << "\n";
+    f << "pace_anim_fps=" << framePacerConfig.animFps << "\n";
+    f << "crt_quality=" << (int)crtQuality << "\n";
+    f << "ui_scale=" << uiScalePct << "\n";
+    f << "render_scale=" << renderScalePct << "\n";
+    f << "adaptive_sampling=" << (adaptiveConfig.enabled ? 1 : 0) << "\n";
+    f << "adaptive_fast_ms=" << adaptiveConfig.fastMs << "\n";
+    f << "adaptive_window_sec=" << adaptiveConfig.windowSec << "\n";
+    f << "adaptive_pre_sec=" << adaptiveConfig.preSec << "\n";
+    f << "adaptive_post_sec=" << adaptiveConfig.postSec << "\n";
+    f << "adaptive_cpu_probe=" << (adaptiveConfig.cpuProbe ? 1 : 0) << "\n";
+    for (const auto& c : collectorCadenceConfig)
+        f << "cadence_" << c.first << "_ms=" << c.second << "\n";
 }
 
 void LoadConfig() {
@@ -36,6 +101,13 @@ void LoadConfig() {
         std::string key = line.substr(0, eq);
         std::string val = line.substr(eq + 1);
         if (val.empty()) continue;
+        // String-valued keys
+        if (key == "stress_cpus")      { stressLoad.cpus = ParseCpuList(val); continue; }
+        if (key == "disk_bench_mount") { diskBenchConfig.mountPoint = val; continue; }
+        if (key == "sysfs_root")       { SetSysfsRoot(val); continue; }
+        if (key == "log_tail_path")    { logTailConfig.path = val; continue; }
+        if (key == "log_tail_filter")  { logTailConfig.filter = val; continue; }
+        if (key == "event_log_file")   { eventLogFile = val == "-" ? "" : val; continue; }
         try {
             int v = std::stoi(val);
             if      (key == "first_run") isFirstRun = (v != 0);
@@ -44,6 +116,54 @@ void LoadConfig() {
                 int idx = std::stoi(key.substr(7));
                 if (idx >= 0 && idx < WIDGET_COUNT) *ws[idx] = (v != 0);
             }
+            else if (key == "speedtest_schedule")     speedTestSchedule.enabled        = (v != 0);
+            else if (key == "speedtest_interval_min") speedTestSchedule.intervalMin    = v < 1 ? 1 : v;
+            else if (key == "speedtest_jitter_sec")   speedTestSchedule.jitterSec      = v < 0 ? 0 : v;
+            else if (key == "speedtest_budget_mb")    speedTestSchedule.dailyBudgetMB  = v < 0 ? 0 : v;
+            else if (key == "speedtest_max_kbps")     speedTestSchedule.maxTrafficKBps = v < 0 ? 0 : v;
+            else if (key == "stress_workload" && v >= 0 && v < (int)StressWorkload::COUNT)
+                stressWorkload = (StressWorkload)v;
+            else if (key == "stress_load_pct")    stressLoad.targetPct     = v < 1 ? 1 : v > 100 ? 100 : v;
+            else if (key == "stress_ramp" && v >= 0 && v < (int)StressRamp::COUNT)
+                stressLoad.ramp = (StressRamp)v;
+            else if (key == "stress_ramp_from")   stressLoad.rampFromPct   = v < 0 ? 0 : v > 100 ? 100 : v;
+            else if (key == "stress_ramp_to")     stressLoad.rampToPct     = v < 0 ? 0 : v > 100 ? 100 : v;
+            else if (key == "stress_ramp_steps")  stressLoad.rampSteps     = v < 2 ? 2 : v;
+            else if (key == "stress_ramp_period") stressLoad.rampPeriodSec = v < 1 ? 1 : v;
+            else if (key == "mem_footprint_pct")  memStressConfig.footprintPct = v < 1 ? 1 : v > 90 ? 90 : v;
+            else if (key == "mem_hugepages" && v >= 0 && v < (int)MemHugePages::COUNT)
+                memStressConfig.hugePages = (MemHugePages)v;
+            else if (key == "mem_numa_local")     memStressConfig.numaLocal    = v != 0;
+            else if (key == "mem_duration_sec")   memStressConfig.durationSec  = v < 5 ? 5 : v;
+            else if (key == "disk_bench_pattern" && v >= 0 && v < (int)DiskPattern::COUNT)
+                diskBenchConfig.pattern = (DiskPattern)v;
+            else if (key == "disk_bench_block_kb")      diskBenchConfig.blockKB     = v < 4 ? 4 : v > 4096 ? 4096 : v;
+            else if (key == "disk_bench_qd")            diskBenchConfig.queueDepth  = v < 1 ? 1 : v > 256 ? 256 : v;
+            else if (key == "disk_bench_file_mb")       diskBenchConfig.fileMB      = v < 16 ? 16 : v;
+            else if (key == "disk_bench_duration_sec")  diskBenchConfig.durationSec = v < 1 ? 1 : v;
+            else if (key == "psi_cpu_pct")   psiConfig.thresholdPct[PSI_CPU]    = v < 1 ? 1 : v > 99 ? 99 : v;
+            else if (key == "psi_mem_pct")   psiConfig.thresholdPct[PSI_MEMORY] = v < 1 ? 1 : v > 99 ? 99 : v;
+            else if (key == "psi_io_pct")    psiConfig.thresholdPct[PSI_IO]     = v < 1 ? 1 : v > 99 ? 99 : v;
+            else if (key == "psi_window_ms") psiConfig.windowMs = v < 500 ? 500 : v > 10000 ? 10000 : v;
+            else if (key == "du_threads")    duThreads = v < 0 ? 0 : v > 256 ? 256 : v;
+            else if (key == "log_tail_regex") logTailConfig.regex = v != 0;
+            else if (key == "pace_mode" && v >= 0 && v < (int)PaceMode::COUNT)
+                framePacerConfig.mode = (PaceMode)v;
+            else if (key == "pace_fps")      framePacerConfig.fps     = v < 5 ? 5 : v > 500 ? 500 : v;
+            else if (key == "pace_anim_fps") framePacerConfig.animFps = v < 1 ? 1 : v > 120 ? 120 : v;
+            else if (key == "crt_quality" && v >= 0 && v < (int)CrtQuality::COUNT)
+                crtQuality = (CrtQuality)v;
+            else if (key == "ui_scale")      uiScalePct     = v <= 0 ? 0 : v < 50 ? 50 : v > 400 ? 400 : v;
+            else if (key == "render_scale")  renderScalePct = v < 25 ? 25 : v > 200 ? 200 : v;
+            else if (key == "adaptive_sampling")   adaptiveConfig.enabled   = v != 0;
+            else if (key == "adaptive_fast_ms")    adaptiveConfig.fastMs    = v < 20 ? 20 : v > 100 ? 100 : v;
+            else if (key == "adaptive_window_sec") adaptiveConfig.windowSec = v < 2 ? 2 : v > 120 ? 120 : v;
+            else if (key == "adaptive_pre_sec")    adaptiveConfig.preSec    = v < 1 ? 1 : v > 30 ? 30 : v;
+            else if (key == "adaptive_post_sec")   adaptiveConfig.postSec   = v < 1 ? 1 : v > 30 ? 30 : v;
+            else if (key == "adaptive_cpu_probe")  adaptiveConfig.cpuProbe  = v != 0;
+            else if (key.size() > 11 && key.compare(0, 8, "cadence_") == 0 && key.compare(key.size() - 3, 3, "_ms") == 0)
+                collectorCadenceConfig[key.substr(8, key.size() - 11)] =
+                    v < COLLECTOR_TICK_MS ? COLLECTOR_TICK_MS : v > COLLECTOR_MAX_MS ? COLLECTOR_MAX_MS : v;
         } catch (...) { continue; }
     }
 }
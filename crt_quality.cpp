@@ -0,0 +1,87 @@
+// crt_quality.cpp - CRT quality tiers and the AUTO tier picker
+// Pure logic, NO raylib/drawing includes
+#include "crt_quality.h"
+#include "event_log.h"
+#include <algorithm>
+#include <cstdio>
+
+#if defined(__linux__)
+// raylib links libGL in on Linux desktop builds. Weak, like the GLFW post in
+// frame_pacer.cpp, so other backends still link and AUTO just stays put.
+extern "C" void glFinish(void) __attribute__((weak));
+#endif
+
+CrtQuality crtQuality = CrtQuality::AUTO;
+
+bool CrtGpuFinish() {
+#if defined(__linux__)
+    if (!glFinish) return false;
+    glFinish();
+    return true;
+#else
+    return false;
+#endif
+}
+
+// ── AUTO ──────────────────────────────────────────────────────────────────────
+// Timing a pass stalls the pipeline, so only a few frames a second are timed.
+// A tier steps down once its smoothed cost is over budget, and the next tier
+// up is retried after a hold-off that doubles each time the retry is quickly
+// undone, so a machine that can't afford FULL doesn't keep bouncing into it.
+static const double TIMING_GAP   = 0.25;   // seconds between timed frames
+static const int    MIN_SAMPLES  = 4;      // before a step down
+static const double HOLD_MIN     = 30.0;
+static const double HOLD_MAX     = 480.0;
+static const double QUICK_UNDO   = 10.0;   // a step down this soon after a retry
+
+static CrtQuality s_autoTier    = CrtQuality::FULL;
+static double     s_lastTimed   = -1.0;
+static double     s_ema         = 0.0;
+static int        s_samples     = 0;
+static double     s_hold        = HOLD_MIN;
+static double     s_retryAt     = 0.0;
+static double     s_steppedUpAt = -1.0;
+static float      s_lastPassMs  = -1.f;
+
+CrtQuality CrtQualityActive() {
+    return crtQuality == CrtQuality::AUTO ? s_autoTier : crtQuality;
+}
+
+bool CrtQualityWantsTiming(double now) {
+    if (crtQuality != CrtQuality::AUTO) return false;
+    if (s_autoTier == CrtQuality::OFF && now < s_retryAt) return false;   // nothing to step down to
+    return s_lastTimed < 0.0 || now - s_lastTimed >= TIMING_GAP;
+}
+
+static void Step(CrtQuality to, double passMs, double budgetMs) {
+    char msg[EVENT_TEXT_MAX];
+    snprintf(msg, sizeof(msg), "[CRT] AUTO %s -> %s (pass %.2f ms, budget %.2f ms)",
+             CRT_QUALITY_NAMES[(int)s_autoTier], CRT_QUALITY_NAMES[(int)to], passMs, budgetMs);
+    LogEvent(EV_INFO, msg);
+    s_autoTier = to;
+    s_ema      = 0.0;
+    s_samples  = 0;
+}
+
+void CrtQualityReport(double passMs, double budgetMs, double now) {
+    s_lastTimed  = now;
+    s_lastPassMs = (float)passMs;
+    s_ema = s_samples == 0 ? passMs : s_ema * 0.7 + passMs * 0.3;
+    s_samples++;
+
+    if (s_autoTier != CrtQuality::OFF && s_samples >= MIN_SAMPLES && s_ema > budgetMs) {
+        bool undone = s_steppedUpAt >= 0.0 && now - s_steppedUpAt < QUICK_UNDO;
+        s_hold = undone ? std::min(s_hold * 2.0, HOLD_MAX) : HOLD_MIN;
+        s_retryAt     = now + s_hold;
+        s_steppedUpAt = -1.0;
+        Step((CrtQuality)((int)s_autoTier - 1), s_ema, budgetMs);
+        return;
+    }
+    // Comfortably inside the budget and the hold-off is over: try one tier up
+    if (s_autoTier != CrtQuality::FULL && now >= s_retryAt && s_samples >= MIN_SAMPLES && s_ema < budgetMs * 0.5) {
+        s_steppedUpAt = now;
+        Step((CrtQuality)((int)s_autoTier + 1), s_ema, budgetMs);
+    }
+}
+
+float CrtQualityLastPassMs() { return s_lastPassMs; }
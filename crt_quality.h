@@ -0,0 +1,29 @@
+#pragma once
+
+// ── CRT post-processing quality ───────────────────────────────────────────────
+// OFF copies the frame straight to the window. LITE runs one cheap pass:
+// scanlines, vignette and the theme tint. FULL adds curvature, flicker and
+// the phosphor glow; the glow is blurred at half resolution in its own pass
+// and composited, instead of four extra taps per output pixel. AUTO times
+// the post-processing on the GPU a few times a second and steps between
+// FULL, LITE and OFF to keep it within a share of the frame.
+enum class CrtQuality { OFF = 0, LITE, FULL, AUTO, COUNT };
+
+inline const char* CRT_QUALITY_NAMES[] = { "OFF", "LITE", "FULL", "AUTO" };
+
+extern CrtQuality crtQuality;   // configured (dashboard.cfg crt_quality)
+
+// The tier to render this frame: crtQuality, or AUTO's current pick
+CrtQuality CrtQualityActive();
+
+// AUTO only. WantsTiming says whether to time this frame's passes; the
+// caller then reports the cost, which may change CrtQualityActive(). The
+// budget is the post-processing share of the display's frame time.
+bool CrtQualityWantsTiming(double now);
+void CrtQualityReport(double passMs, double budgetMs, double now);
+float CrtQualityLastPassMs();   // -1 until AUTO has a measurement
+
+// Waits until the GPU has finished the commands issued so far, so the time
+// around a pass is its GPU cost. False where GL's glFinish is not linked in;
+// AUTO then stays on FULL.
+bool CrtGpuFinish();
@@ -2,23 +2,55 @@
 #include "theme.h"
 #include "system_monitor.h"
 #include "speedtest.h"
+#include "speedtest_history.h"
 #include "stress_test.h"
+#include "mem_stress.h"
+#include "disk_bench.h"
+#include "psi.h"
+#include "cgroup.h"
+#include "meminfo.h"
+#include "numa.h"
+#include "du_scan.h"
+#include "log_tail.h"
+#include "event_log.h"
+#include "frame_pacer.h"
+#include "crt_quality.h"
+#include "retained_widget.h"
+#include "series_graph.h"
+#include "collector.h"
+#include "adaptive.h"
+#include "text_cache.h"
+#include "layout.h"
+#include "ui_menus.h"
+#include "terminal.h"
+#include "sysfs_util.h"
 #include "raylib.h"
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <ctime>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <mutex>
 
 // ── Global definitions ────────────────────────────────────────────────────────
 SystemStats      stats;
-std::vector<LogEntry> logEntries;
 float            timeAccumulator = 0.0f;
 Font             retroFont;
 bool             hasCustomFont   = false;
 int              currentMenu     = MENU_DASHBOARD;
+int              benchPage       = BENCH_MEMORY;
+int              cgroupScroll    = 0;
+int              memPage         = MEM_PAGE_BREAKDOWN;
+bool             showDiskUsage   = false;
+int              siDriveSel      = 0;
+int              duSelected      = 0;
+int              logMinLevel     = EV_DEBUG;
+int              logSourceFilter = 0;
 int              selectedOption  = 0;
 bool             showMenu        = false;
 float            menuBlinkTimer  = 0.0f;
@@ -27,6 +59,8 @@ bool             showWidgetMenu  = false;
 int              selectedWidget  = 0;
 bool             isFirstRun      = true;
 AnomalyState     anomaly;
+bool             showSpeedHistory = false;
+bool             showCapture      = false;
 
 // ── Widget state helper ───────────────────────────────────────────────────────
 void GetWidgetStates(bool* states[WIDGET_COUNT]) {
@@ -40,13 +74,17 @@ void GetWidgetStates(bool* states[WIDGET_COUNT]) {
     states[WIDGET_PROCESSES]    = &widgets.showProcesses;
     states[WIDGET_UPTIME]       = &widgets.showUptime;
     states[WIDGET_COMPUTERNAME] = &widgets.showComputerName;
+    states[WIDGET_PSI]          = &widgets.showPSI;
 }
 
 // ── Log ───────────────────────────────────────────────────────────────────────
+// UI-side wrapper over the event ring: the colour picks the level, so the
+// existing call sites keep working and threads can call LogEvent() directly.
 void AddLogEntry(const std::string& message, Color entryColor) {
-    logEntries.push_back({ message, GetTime(), entryColor });
-    if (logEntries.size() > 40)
-        logEntries.erase(logEntries.begin());
+    auto same = [&](Color c) { return c.r == entryColor.r && c.g == entryColor.g && c.b == entryColor.b; };
+    EventLevel level = same(RED) ? EV_ERROR : same(YELLOW_ALERT) ? EV_WARN : same(DIM_GREEN) ? EV_DEBUG : EV_INFO;
+    uint32_t rgba = (uint32_t)entryColor.r << 24 | (uint32_t)entryColor.g << 16 | (uint32_t)entryColor.b << 8 | entryColor.a;
+    LogEvent(level, message, rgba);
 }
 
 // ── Stats ─────────────────────────────────────────────────────────────────────
@@ -64,28 +102,240 @@ void InitializeStats() {
     GetHostName(stats.computerName, sizeof(stats.computerName));
 }
 
-void UpdateStats(float deltaTime) {
+// ── Metric history ───────────────────────────────────────────────────────────
+// One sample a second for the last hour, drawn under the metrics
+static const int   HISTORY_SAMPLES = 3600;
+static SeriesGraph s_cpuHistory(HISTORY_SAMPLES);
+static SeriesGraph s_ramHistory(HISTORY_SAMPLES);
+static SeriesGraph s_netHistory(HISTORY_SAMPLES);
+
+void PushMetricHistory(float cpu, float ram, float netDownKBps) {
+    s_cpuHistory.Push(cpu);
+    s_ramHistory.Push(ram);
+    s_netHistory.Push(netDownKBps);
+}
+
+// The last adaptive capture, shown in place of the history (C)
+static const int   CAPTURE_POINTS = 480;
+static SeriesGraph s_captureGraphs[AM_COUNT] = {
+    SeriesGraph(CAPTURE_POINTS), SeriesGraph(CAPTURE_POINTS), SeriesGraph(CAPTURE_POINTS)
+};
+
+void UnloadMetricHistory() {
+    s_cpuHistory.Unload();
+    s_ramHistory.Unload();
+    s_netHistory.Unload();
+    for (SeriesGraph& g : s_captureGraphs) g.Unload();
+}
+
+// ── Collectors ───────────────────────────────────────────────────────────────
+// The readings come from the collector scheduler's workers, which write
+// them here under s_collectMutex. UpdateStats copies the scalars out when
+// the scheduler's generation moves; the views copy a list when its own
+// generation does. Work for a view nobody has looked at for a while, and
+// the real-data readers in SIM mode, is skipped.
+struct CollectedStats {
+    bool  valid = false;                     // cpu/ram/disk read since real data went on
+    float cpu = 0.f, ram = 0.f, disk = 0.f;
+    int   processCount = 0;
+    unsigned long long uptimeSeconds = 0;
+    std::vector<float>       cores;
+    std::vector<DiskInfo>    drives;
+    std::vector<AdapterInfo> adapters;
+    int   coresGen = 0, drivesGen = 0, adaptersGen = 0;
+};
+
+static std::mutex        s_collectMutex;
+static CollectedStats    s_collected;
+static std::atomic<bool> s_collectReal{false};   // stats.useRealData, for the workers
+static int s_cpuCollector = -1, s_memCollector = -1, s_diskCollector = -1, s_infoCollector = -1;
+static int s_coresCollector = -1, s_drivesCollector = -1, s_adaptersCollector = -1;
+static const double VIEW_IDLE_SEC = 10.0;
+
+static double SteadySec() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Views call this every frame they draw a list; the first call after a
+// while runs its collector straight away instead of at its next turn
+static std::atomic<double> s_coresWanted{-1e9}, s_drivesWanted{-1e9}, s_adaptersWanted{-1e9};
+
+static void MarkWanted(std::atomic<double>& wanted, int collector) {
+    double now = SteadySec();
+    if (now - wanted.exchange(now) > VIEW_IDLE_SEC) TriggerCollector(collector);
+}
+
+static bool Wanted(const std::atomic<double>& wanted) {
+    return SteadySec() - wanted.load() <= VIEW_IDLE_SEC;
+}
+
+template <typename T>
+static bool CopyCollected(const std::vector<T>& src, const int& srcGen, std::vector<T>& out, int& gen) {
+    std::lock_guard<std::mutex> lock(s_collectMutex);
+    if (gen == srcGen) return false;
+    out = src;
+    gen = srcGen;
+    return true;
+}
+
+// Host-wide busy % from the aggregate /proc/stat line, over the interval
+// since the last call; false when there is no line (off Linux) or no interval
+struct HostCpuMeter {
+    uint64_t busy = 0, total = 0;
+    bool Update(const std::string& text, float& pct) {
+        uint64_t b, t;
+        if (!ParseProcStatTotal(text.c_str(), b, t)) return false;
+        bool ok = total > 0 && t > total && b >= busy;
+        if (ok) pct = (float)(b - busy) * 100.f / (float)(t - total);
+        busy = b; total = t;
+        return ok;
+    }
+};
+
+void StartStatsCollectors() {
+    // CPU and the per-core bars share one read of /proc/stat
+    s_cpuCollector = RegisterCollector("cpu", "/proc/stat", 1000, 2.f, [](const std::string& text) {
+        static HostCpuMeter host;   // a collector never overlaps itself
+        if (!s_collectReal) return;
+        float cpu = GetRealCPUUsage(text);
+        // Under a cpu.max quota the reading above is a share of the quota;
+        // the stress load controller scales a host-wide one by its CPUs
+        float hostCpu;
+        if (host.Update(text, hostCpu))            StressFeedbackCpu(hostCpu);
+        else if (text.compare(0, 4, "cpu ") != 0) StressFeedbackCpu(cpu);   // no /proc/stat, no quota
+        AdaptiveSample(AM_CPU, cpu);
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.cpu   = cpu;
+        s_collected.valid = true;
+    });
+    // Adaptive sampling's CPU probe: just the aggregate line, over its own
+    // interval, at the fast cadence when adaptive_cpu_probe is on. Otherwise
+    // it shares the 1 s read with the two above and its readings are ignored;
+    // on, each fast tick is a whole /proc/stat read for one line.
+    // Host-wide, like the per-core bars, even under a cpu.max quota.
+    int cpuProbe = RegisterCollector("cpu_probe", "/proc/stat", 1000, 1.f, [](const std::string& text) {
+        static HostCpuMeter host;
+        float pct;
+        if (host.Update(text, pct) && s_collectReal) AdaptiveProbeSample(AM_CPU, pct);
+    });
+    s_coresCollector = RegisterCollector("cores", "/proc/stat", 1000, 2.f, [](const std::string& text) {
+        if (!s_collectReal || !Wanted(s_coresWanted)) return;
+        std::vector<float> cores = GetPerCoreCPUUsage(text);
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.cores.swap(cores);
+        s_collected.coresGen++;
+    });
+    s_memCollector = RegisterCollector("mem", "", 1000, 2.f, [](const std::string&) {
+        if (!s_collectReal) return;
+        float ram = GetRealRAMUsage();
+        AdaptiveSample(AM_RAM, ram);
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.ram = ram;
+    });
+    s_diskCollector = RegisterCollector("disk", "", 1000, 2.f, [](const std::string&) {
+        if (!s_collectReal) return;
+        float disk = GetRealDiskUsage();
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.disk = disk;
+    });
     // Network is always real regardless of mode
-    static float netTimer = 0.f;
-    netTimer += deltaTime;
-    if (netTimer >= 1.f) {
+    int net = RegisterCollector("net", "", 1000, 2.f, [](const std::string&) {
         UpdateNetworkStats();
+        if (s_collectReal) AdaptiveSample(AM_NET, GetNetDownKBps() + GetNetUpKBps());
+    });
+    s_infoCollector = RegisterCollector("info", "", 2000, 10.f, [](const std::string&) {
+        if (!s_collectReal) return;
+        int procs = GetProcessCount();
+        unsigned long long up = GetSystemUptimeSeconds();
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.processCount  = procs;
+        s_collected.uptimeSeconds = up;
+    });
+    // Mount and adapter lists, for the dashboard, System Information and
+    // network views alike
+    s_drivesCollector = RegisterCollector("drives", "", 5000, 20.f, [](const std::string&) {
+        if (!Wanted(s_drivesWanted)) return;
+        std::vector<DiskInfo> drives = GetAllDrives();
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.drives.swap(drives);
+        s_collected.drivesGen++;
+    });
+    s_adaptersCollector = RegisterCollector("adapters", "", 2000, 10.f, [](const std::string&) {
+        if (!Wanted(s_adaptersWanted)) return;
+        std::vector<AdapterInfo> adapters = GetAdapterList();
+        std::lock_guard<std::mutex> lock(s_collectMutex);
+        s_collected.adapters.swap(adapters);
+        s_collected.adaptersGen++;
+    });
+    // Adaptive sampling drives the cadence of these three
+    AdaptiveBind(AM_CPU, s_cpuCollector);
+    AdaptiveBind(AM_RAM, s_memCollector);
+    AdaptiveBind(AM_NET, net);
+    AdaptiveBindProbe(AM_CPU, cpuProbe);
+    StartCollectors(2);
+}
+
+void TriggerStatsCollectors() {
+    s_collectReal = stats.useRealData;
+    for (int id : { s_cpuCollector, s_memCollector, s_diskCollector, s_infoCollector })
+        TriggerCollector(id);
+}
+
+// Mount list, shared by the dashboard and System Information
+static std::vector<DiskInfo> s_drives;
+static int                   s_drivesGen = 0;
+
+static void RefreshDrives() {
+    MarkWanted(s_drivesWanted, s_drivesCollector);
+    CopyCollected(s_collected.drives, s_collected.drivesGen, s_drives, s_drivesGen);
+}
+
+// The collectors land just after each wall-clock second, so the clock and
+// the numbers change together; between samples only the easing towards the
+// new targets runs. The pacer is woken when a batch lands; this estimate is
+// its fallback.
+static double             s_nextSample  = 0.0;
+static unsigned long long s_sampleCount = 0;
+
+double             StatsNextSampleTime() { return s_nextSample; }
+unsigned long long StatsSampleCount()    { return s_sampleCount; }
+
+bool UpdateStats(float deltaTime) {
+    double now = GetTime();
+    if (now >= s_nextSample) {
+        long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::system_clock::now().time_since_epoch()).count();
+        s_nextSample = now + (1000 - ms % 1000) / 1000.0 + 0.02;
+    }
+    s_collectReal = stats.useRealData;
+
+    // Boosted cadences come and go here; a stress run holds CPU at the fast
+    // one for its load controller
+    AdaptiveUpdate(stats.useRealData, stats.useRealData && stressState == StressTestState::RUNNING);
+
+    static uint64_t seenGen = 0;
+    uint64_t gen = CollectorGeneration();
+    bool sampled = gen != seenGen;
+    if (sampled) {
+        seenGen = gen;
+        s_sampleCount++;
         stats.targetNetDown = GetNetDownKBps();
         stats.targetNetUp   = GetNetUpKBps();
-        netTimer = 0.f;
     }
 
     if (stats.useRealData) {
-        stats.targetCpu  = GetRealCPUUsage();
-        stats.targetRam  = GetRealRAMUsage();
-        stats.targetDisk = GetRealDiskUsage();
-
-        static float infoTimer = 0.f;
-        infoTimer += deltaTime;
-        if (infoTimer >= 2.f) {
-            stats.processCount  = GetProcessCount();
-            stats.uptimeSeconds = GetSystemUptimeSeconds();
-            infoTimer = 0.f;
+        if (sampled) {
+            std::lock_guard<std::mutex> lock(s_collectMutex);
+            const CollectedStats& c = s_collected;
+            if (c.valid) {
+                stats.targetCpu  = c.cpu;
+                stats.targetRam  = c.ram;
+                stats.targetDisk = c.disk;
+            }
+            if (c.processCount > 0) {
+                stats.processCount  = c.processCount;
+                stats.uptimeSeconds = c.uptimeSeconds;
+            }
         }
     } else {
         if (GetRandomValue(0, 100) < 2) {
@@ -96,12 +346,57 @@ void UpdateStats(float deltaTime) {
         stats.processCount  = 120 + GetRandomValue(-5, 5);
         stats.uptimeSeconds = static_cast<unsigned long long>(GetTime()) + 3600;
     }
+    // History keeps one sample per second, whatever the collectors' cadences
+    static time_t historySecond = 0;
+    if (sampled && time(nullptr) != historySecond) {
+        historySecond = time(nullptr);
+        PushMetricHistory(stats.targetCpu, stats.targetRam, stats.targetNetDown);
+    }
+
+    // Throttle flag from the stress run's thermal tracker: log it once per run
+    static bool throttleLogged = false;
+    if (stressState == StressTestState::RUNNING) {
+        if (!throttleLogged) {
+            StressThermalStatus th = GetStressThermal();
+            if (th.throttled) {
+                AddLogEntry("[STRESS] " + th.note, YELLOW_ALERT);
+                throttleLogged = true;
+            }
+        }
+    } else {
+        throttleLogged = false;
+    }
+
+    // Memory benchmark finished: one log line with the headline numbers
+    static MemStressState lastMemState = MemStressState::IDLE;
+    if (memStressState != lastMemState) {
+        lastMemState = memStressState;
+        MemStressResult r = GetMemStressResult();
+        char buf[128];
+        if (lastMemState == MemStressState::DONE) {
+            snprintf(buf, sizeof(buf), "[MEMBENCH] R %.1f W %.1f C %.1f GB/s, %d passes, %llu errors",
+                     r.readGBps, r.writeGBps, r.copyGBps, r.passes, (unsigned long long)r.errors);
+            AddLogEntry(buf, r.errors > 0 ? RED : GREEN_PHOSPHOR);
+        } else if (lastMemState == MemStressState::FAILED) {
+            AddLogEntry("[MEMBENCH] " + r.error, YELLOW_ALERT);
+        }
+    }
+
+    // ON-DEMAND pacing draws once per sample, so live values jump straight
+    // to the target instead of gliding over frames that would not be drawn
     const float S = stats.useRealData ? 5.f : 2.f;
-    stats.cpu     += (stats.targetCpu     - stats.cpu)     * deltaTime * S;
-    stats.ram     += (stats.targetRam     - stats.ram)     * deltaTime * S;
-    stats.disk    += (stats.targetDisk    - stats.disk)    * deltaTime * S;
-    stats.netDown += (stats.targetNetDown - stats.netDown) * deltaTime * S;
-    stats.netUp   += (stats.targetNetUp   - stats.netUp)   * deltaTime * S;
+    float k = deltaTime * S;
+    if (stats.useRealData && framePacerConfig.mode == PaceMode::ON_DEMAND) k = 1.f;
+    k = std::min(k, 1.f);
+    stats.cpu     += (stats.targetCpu     - stats.cpu)     * k;
+    stats.ram     += (stats.targetRam     - stats.ram)     * k;
+    stats.disk    += (stats.targetDisk    - stats.disk)    * k;
+    stats.netDown += (stats.targetNetDown - stats.netDown) * k;
+    stats.netUp   += (stats.targetNetUp   - stats.netUp)   * k;
+    bool easing = fabsf(stats.targetCpu - stats.cpu) > 0.05f || fabsf(stats.targetRam - stats.ram) > 0.05f
+               || fabsf(stats.targetDisk - stats.disk) > 0.05f
+               || fabsf(stats.targetNetDown - stats.netDown) > 0.05f || fabsf(stats.targetNetUp - stats.netUp) > 0.05f;
+    bool wasAnomaly = anomaly.triggered;
 
     // ── Anomaly detection ───────────────────────────────────────────────────
     if (stats.useRealData) {
@@ -133,6 +428,30 @@ void UpdateStats(float deltaTime) {
             anomaly.reason = buf;
         }
 
+        // Pressure stall: tasks waiting on CPU, memory or IO. Saturation shows
+        // up here before (or without) CPU% / RAM% looking alarming.
+        if (!anomaly.triggered) {
+            PsiSnapshot psi = GetPsi();
+            for (int r = 0; r < PSI_COUNT && !anomaly.triggered; r++) {
+                if (!psi.res[r].stalled) continue;
+                anomaly.triggered = true;
+                char buf[64]; snprintf(buf, sizeof(buf), "%s PRESSURE  %.0f%% STALLED",
+                                       PSI_RESOURCE_NAMES[r], psi.res[r].some.deltaPct);
+                anomaly.reason = buf;
+            }
+        }
+
+        // Stress run throttling: throughput and clocks fell together
+        if (!anomaly.triggered && stressState == StressTestState::RUNNING) {
+            StressThermalStatus th = GetStressThermal();
+            if (th.throttled) {
+                anomaly.triggered = true;
+                char buf[64]; snprintf(buf, sizeof(buf), "THROTTLING  -%.0f%% WORK  -%.0f%% FREQ",
+                                       th.throughputDropPct, th.freqDropPct);
+                anomaly.reason = buf;
+            }
+        }
+
         // Network spike: 10x the rolling baseline
         if (!anomaly.triggered && anomaly.netBaseline > 1.f && netTotal > anomaly.netBaseline * 10.f) {
             anomaly.triggered = true;
@@ -141,8 +460,10 @@ void UpdateStats(float deltaTime) {
         }
 
         // Log when state changes
-        if (anomaly.triggered && !wasTriggered)
+        if (anomaly.triggered && !wasTriggered) {
             AddLogEntry("[ANOMALY] " + anomaly.reason, RED);
+            AdaptiveTrigger(anomaly.reason);
+        }
         else if (!anomaly.triggered && wasTriggered)
             AddLogEntry("[ANOMALY] Condition cleared", GREEN_PHOSPHOR);
     } else {
@@ -152,6 +473,19 @@ void UpdateStats(float deltaTime) {
         anomaly.netBaseline = -1.f;
         static float cpuHighTimer = 0.f; cpuHighTimer = 0.f;
     }
+    return sampled || easing || anomaly.triggered != wasAnomaly;
+}
+
+// Anything on screen that moves between metric samples. ON-DEMAND pacing
+// keeps drawing at its animation rate while this is true.
+bool DashboardAnimating() {
+    if (!stats.useRealData) return true;                               // SIM mode is all animation
+    if (showMenu || showWidgetMenu || showColorMenu || showOnboarding || showTerminal) return true;   // blinking cursors
+    if (widgets.showAnomaly && anomaly.triggered) return true;         // alert flash
+    return stressState == StressTestState::RUNNING || coreLatencyState == StressTestState::RUNNING
+        || memStressState == MemStressState::RUNNING || diskBenchState == DiskBenchState::RUNNING
+        || diskBenchState == DiskBenchState::PREPARING || duScanState == DuScanState::RUNNING
+        || speedTestState == SpeedTestState::RUNNING;
 }
 
 void GenerateRandomLog() {
@@ -181,18 +515,19 @@ void DrawProgressBar(int x, int y, int w, int h, float value, Color barColor) {
     DrawRectangleLines(x, y, w, h, DIM_GREEN);
     int fill = static_cast<int>((w - 4) * (value / 100.f));
     DrawRectangle(x + 2, y + 2, fill, h - 4, barColor);
-    std::string txt = std::to_string(static_cast<int>(value)) + "%";
-    int tw = MeasureText(txt.c_str(), 16);
-    DrawText(txt.c_str(), x + w / 2 - tw / 2, y + h / 2 - 8, 16, COLOR_BLACK);
+    char txt[16];
+    snprintf(txt, sizeof(txt), "%d%%", static_cast<int>(value));
+    int tw = MeasureTextRun(txt, 16);
+    DrawTextRun(txt, x + w / 2 - tw / 2, y + h / 2 - 8, 16, COLOR_BLACK);
 }
 
 void DrawPanel(int x, int y, int w, int h, const char* title) {
     DrawRectangle(x, y, w, h, ColorAlpha(COLOR_BLACK, 0.6f));
     DrawRectangleLines(x, y, w, h, DIM_GREEN);
     if (title && title[0]) {
-        int tw = MeasureText(title, 14);
+        int tw = MeasureTextRun(title, 14);
         DrawRectangle(x + 10, y - 8, tw + 8, 16, COLOR_BLACK);
-        DrawText(title, x + 14, y - 7, 14, GREEN_PHOSPHOR);
+        DrawTextRun(title, x + 14, y - 7, 14, GREEN_PHOSPHOR);
     }
 }
 
@@ -200,21 +535,21 @@ void DrawPanel(int x, int y, int w, int h, const char* title) {
 void DrawMenu() {
     if (!showMenu) return;
 
-    int mX = WINDOW_WIDTH - 440, mY = 80, mW = 400, mH = MENU_COUNT * 38 + 130;
+    int mX = layout.width - 440, mY = 80, mW = 400, mH = MENU_COUNT * 38 + 130;
     DrawRectangle(mX, mY, mW, mH, ColorAlpha(COLOR_BLACK, 0.9f));
     DrawRectangleLines(mX, mY, mW, mH, GREEN_PHOSPHOR);
-    DrawText("CONTROL PANEL", mX + 20, mY + 16, 22, GREEN_PHOSPHOR);
+    DrawTextRun("CONTROL PANEL", mX + 20, mY + 16, 22, GREEN_PHOSPHOR);
     DrawLine(mX + 10, mY + 46, mX + mW - 10, mY + 46, DIM_GREEN);
-    DrawText("UP/DOWN  ENTER select  TAB close", mX + 20, mY + mH - 28, 13, DIM_GREEN);
+    DrawTextRun("UP/DOWN  ENTER select  TAB close", mX + 20, mY + mH - 28, 13, DIM_GREEN);
 
     int oY = mY + 56;
     for (int i = 0; i < MENU_COUNT; i++) {
         Color c = (i == selectedOption) ? CYAN_HIGHLIGHT : GREEN_PHOSPHOR;
         if (i == selectedOption && fmod(menuBlinkTimer, 1.f) < 0.5f)
-            DrawText(">", mX + 14, oY + 2, 18, CYAN_HIGHLIGHT);
-        DrawText(MENU_OPTIONS[i], mX + 36, oY + 2, 18, c);
+            DrawTextRun(">", mX + 14, oY + 2, 18, CYAN_HIGHLIGHT);
+        DrawTextRun(MENU_OPTIONS[i], mX + 36, oY + 2, 18, c);
         if (i == currentMenu)
-            DrawText("[ACTIVE]", mX + mW - 90, oY + 4, 13, AMBER_PHOSPHOR);
+            DrawTextRun("[ACTIVE]", mX + mW - 90, oY + 4, 13, AMBER_PHOSPHOR);
         oY += 38;
     }
 }
@@ -236,7 +571,377 @@ static void EnsureHardwareInfo() {
     }
 }
 
+// ── Stress benchmark strip: live ops/s per core, final score ─────────────────
+// Stress score after a run: copied once when the run ends, not every frame
+static const StressScore& CachedStressScore() {
+    static StressScore     score;
+    static StressTestState seen = StressTestState::IDLE;
+    if (stressState != seen) { score = GetStressScore(); seen = stressState; }
+    return score;
+}
+
+// Recorded every frame while the run is live; a finished run's score strip
+// is rebuilt only when a new score arrives.
+static void DrawStressBench(int x, int y, int w, int h) {
+    static RetainedWidget strip;
+    static uint64_t liveFrame = 0;
+    bool running = stressState == StressTestState::RUNNING;
+    const StressScore& sc = CachedStressScore();
+    WidgetKey key;
+    key << x << y << w << h << running;
+    if (running) key << ++liveFrame;
+    else         key << sc.totalOpsPerSec << sc.seconds << sc.workload;
+    if (!strip.Begin(key)) { strip.Draw(); return; }
+
+    std::vector<float> liveRates;
+    if (running) liveRates = GetStressCoreRates();
+    const std::vector<float>& rates = running ? liveRates : sc.coreOpsPerSec;
+    if (rates.empty()) return;
+
+    if (running || !sc.valid) {
+        StressLoadStatus ls = GetStressLoadStatus();
+        if (ls.active)
+            strip.TextF(x, y, 14, AMBER_PHOSPHOR, "BENCH %s  %d CORES  LOAD %.0f%% / %.0f%%",
+                        STRESS_WORKLOAD_NAMES[(int)stressWorkload], (int)rates.size(), ls.measuredPct, ls.setpointPct);
+        else
+            strip.TextF(x, y, 14, AMBER_PHOSPHOR, "BENCH %s  %d CORES  LIVE UNITS/S",
+                        STRESS_WORKLOAD_NAMES[(int)stressWorkload], (int)rates.size());
+    } else {
+        strip.TextF(x, y, 14, GREEN_PHOSPHOR, "SCORE %.0f  mean %.0f/core  CV %.1f%%  %s",
+                    sc.totalOpsPerSec, sc.meanOpsPerSec, sc.cvPct, STRESS_WORKLOAD_NAMES[(int)sc.workload]);
+        if (sc.outliers > 0)
+            strip.TextF(x, y + 16, 12, YELLOW_ALERT, "%d OUTLIER CORE%s  slowest cpu%d", sc.outliers,
+                        sc.outliers > 1 ? "S" : "", sc.slowestCpu);
+    }
+
+    // Frequency / temperature, and the throttle flag when work and clocks fell together
+    StressThermalStatus th = GetStressThermal();
+    if (th.sensors) {
+        char buf[64];
+        if (running && th.tempC >= 0.f)
+            snprintf(buf, sizeof(buf), "%.2f GHz  %.0fC", th.freqMHz / 1000.f, th.tempC);
+        else if (running)
+            snprintf(buf, sizeof(buf), "%.2f GHz", th.freqMHz / 1000.f);
+        else
+            snprintf(buf, sizeof(buf), "peak %.0fC", th.peakTempC);
+        if (running || th.peakTempC >= 0.f)
+            strip.TextRight(buf, x + w, y + 16, 12, DIM_GREEN);
+        if (th.throttled && (running || sc.outliers == 0))
+            strip.Text(th.note.c_str(), x, y + 16, 12, YELLOW_ALERT);
+    }
+
+    // One vertical bar per logical CPU, scaled to the fastest core
+    int by = y + 34, bh = h - 34;
+    if (bh >= 16) {
+        float peak = 1.f, sum = 0.f;
+        for (float r : rates) { if (r > peak) peak = r; sum += r; }
+        float mean = sum / rates.size();
+        int n = (int)rates.size();
+        int slot = w / n; if (slot < 1) slot = 1;
+        int bw = slot > 3 ? slot - 1 : slot;
+        strip.RectLines(x - 2, by - 2, slot * n + 3, bh + 4, DIM_GREEN);
+        for (int i = 0; i < n && i * slot < w; i++) {
+            int fh = (int)(bh * rates[i] / peak);
+            Color c = rates[i] < mean * 0.9f ? YELLOW_ALERT : GREEN_PHOSPHOR;
+            strip.Rect(x + i * slot, by + bh - fh, bw, fh, c);
+        }
+    }
+    strip.Draw();
+}
+
 // ── Dashboard ─────────────────────────────────────────────────────────────────
+// ── Event log (SYSTEM LOG panel) ─────────────────────────────────────────────
+// New entries are drained from the ring once per frame into a local history,
+// so filtering and drawing never touch the shared ring.
+static const size_t LOG_VIEW_MAX = 1024;
+
+static void DrawEventLog(int x, int top, int w, int bottom) {
+    static std::vector<EventLogEntry> history;   // oldest first, used as a ring
+    static size_t   next = 0;                    // history slot for the next entry
+    static uint64_t cursor = 0, lost = 0;
+    static EventLogEntry batch[64];
+    size_t n;
+    while ((n = ReadEventLog(cursor, batch, 64, &lost)) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            if (history.size() < LOG_VIEW_MAX) history.push_back(batch[i]);
+            else                               history[next] = batch[i];
+            next = (next + 1) % LOG_VIEW_MAX;
+        }
+    }
+
+    // Filter tag in the panel header
+    char tag[48] = "";
+    if (logMinLevel > EV_DEBUG || logSourceFilter) {
+        snprintf(tag, sizeof(tag), "%s+ %s", EVENT_LEVEL_NAMES[logMinLevel],
+                 logSourceFilter ? EventSourceName((uint8_t)logSourceFilter) : "ALL");
+        DrawTextRun(tag, x + w - 10 - MeasureTextRun(tag, 12), top + 4, 12, AMBER_PHOSPHOR);
+    }
+
+    double now = EventLogNow();
+    int y = top + 18;
+    size_t count = history.size();
+    for (size_t k = 0; k < count && y + 18 < bottom; k++) {
+        const EventLogEntry& e = history[(next + count - 1 - k) % count];   // newest first
+        if (e.level < logMinLevel) continue;
+        if (logSourceFilter && e.source != logSourceFilter) continue;
+        float age = (float)(now - e.time);
+        if (age >= 60.f) break;   // older entries stay in the file, not on screen
+        Color c = { (unsigned char)(e.rgba >> 24), (unsigned char)(e.rgba >> 16), (unsigned char)(e.rgba >> 8), 255 };
+        if (e.rgba == 0) c = e.level >= EV_ERROR ? RED : e.level == EV_WARN ? YELLOW_ALERT :
+                             e.level == EV_DEBUG ? DIM_GREEN : GREEN_PHOSPHOR;
+        c.a = static_cast<unsigned char>(255 * (1.f - age / 60.f));
+        DrawTextRun(e.text, x + 10, y, 14, c);
+        y += 18;
+    }
+    if (lost > 0) {
+        snprintf(tag, sizeof(tag), "%llu dropped", (unsigned long long)lost);
+        DrawTextRun(tag, x + 10, bottom - 14, 12, YELLOW_ALERT);
+    }
+}
+
+// ── Tailed log file (lower part of the SYSTEM LOG panel) ──────────────────────
+// Newest line at the bottom, like tail -f. The snapshot is only copied, and
+// the lines only re-laid out, when the tail thread has published something new.
+static void DrawLogTail(int x, int y, int w, int h) {
+    static LogTailSnapshot snap;
+    static RetainedWidget  tail;
+    GetLogTail(snap);
+    if (!tail.Begin(WidgetKey() << x << y << w << h << snap.generation)) { tail.Draw(); return; }
+
+    tail.Line(x + 10, y, x + w - 10, y, DIM_GREEN);
+    char buf[200];
+    size_t slash = snap.path.find_last_of('/');
+    const char* name = snap.path.c_str() + (slash == std::string::npos ? 0 : slash + 1);
+    if (!snap.error.empty())
+        snprintf(buf, sizeof(buf), "TAIL %s  %s", name, snap.error.c_str());
+    else if (!snap.open)
+        snprintf(buf, sizeof(buf), "TAIL %s  waiting for file", name);
+    else
+        snprintf(buf, sizeof(buf), "TAIL %s  %.1f MB/s  %.0f lines/s%s%s", name, snap.mbps, snap.linesPerSec,
+                 snap.filter.empty() ? "" : "  filter: ", snap.filter.c_str());
+    tail.Text(buf, x + 10, y + 6, 12, snap.error.empty() ? AMBER_PHOSPHOR : YELLOW_ALERT);
+    if (snap.skippedBytes > 0) {
+        snprintf(buf, sizeof(buf), "%.0f MB skipped", snap.skippedBytes / (1024.0 * 1024.0));
+        tail.TextRight(buf, x + w - 10, y + 6, 12, YELLOW_ALERT);
+    }
+
+    const int LH = 15, top = y + 24;
+    int rows = (y + h - 8 - top) / LH;
+    int n = (int)snap.text.size();
+    int maxW = w - 20;
+    char cut[LOG_TAIL_LINE_MAX + 1];
+    for (int r = 0; r < rows && r < n; r++) {
+        const std::string& line = snap.text[n - std::min(rows, n) + r];
+        int lw = MeasureTextRun(line.c_str(), 12);
+        if (lw > maxW) {
+            // One measure per line: cut in proportion, not char by char
+            size_t len = std::min(line.size() * maxW / lw, sizeof(cut) - 1);
+            memcpy(cut, line.data(), len);
+            cut[len] = 0;
+            tail.Text(cut, x + 10, top + r * LH, 12, GREEN_PHOSPHOR);
+        } else {
+            tail.Text(line.c_str(), x + 10, top + r * LH, 12, GREEN_PHOSPHOR);
+        }
+    }
+    tail.Draw();
+}
+
+// CPU, RAM and download history under the metrics: labels and frames are a
+// retained widget, each graph one draw call from its own vertex buffer.
+// The network scale doubles from 64 KB/s until the peak fits.
+static void DrawHistory(int x, int y, int w, int h) {
+    float netMax = 64.f;
+    for (float peak = s_netHistory.Peak(); netMax < peak && netMax < 1e9f; ) netMax *= 2.f;
+
+    struct Row { const char* name; SeriesGraph& g; float max; bool net; };
+    const Row rows[] = {
+        { "CPU", s_cpuHistory, 100.f,  false },
+        { "RAM", s_ramHistory, 100.f,  false },
+        { "NET", s_netHistory, netMax, true  },
+    };
+    const int LABEL = 96;
+    const int GAP   = 6;
+    int rowH = std::min(100, h / 3);
+    int gw   = w - LABEL;
+    if (rowH < 44 || gw < 60) return;
+
+    static RetainedWidget labels;
+    WidgetKey key;
+    key << x << y << w << rowH << netMax << s_cpuHistory.Count() / 60;
+    for (const Row& r : rows) key << (int)(r.g.Latest() * (r.net ? 1.f : 10.f));
+    if (labels.Begin(key)) {
+        for (int i = 0; i < 3; i++) {
+            const Row& r = rows[i];
+            int   ry = y + i * rowH;
+            float v  = r.g.Latest();
+            labels.Text(r.name, x, ry, 14, GREEN_PHOSPHOR);
+            if (!r.net)           labels.TextF(x, ry + 16, 12, DIM_GREEN, "%.1f%%", v);
+            else if (v >= 1024.f) labels.TextF(x, ry + 16, 12, DIM_GREEN, "%.2f MB/s", v / 1024.f);
+            else                  labels.TextF(x, ry + 16, 12, DIM_GREEN, "%.0f KB/s", v);
+            if (r.net) {
+                if (netMax >= 1024.f) labels.TextF(x, ry + 30, 10, DIM_GREEN, "max %.0f MB/s", netMax / 1024.f);
+                else                  labels.TextF(x, ry + 30, 10, DIM_GREEN, "max %.0f KB/s", netMax);
+            }
+            labels.RectLines(x + LABEL - 1, ry - 1, gw + 2, rowH - GAP + 2, DIM_GREEN);
+        }
+        labels.TextF(x + LABEL, y + 3 * rowH - GAP + 3, 10, DIM_GREEN, "last %d of %d min   C  last capture",
+                     std::max(1, s_cpuHistory.Count() / 60), HISTORY_SAMPLES / 60);
+    }
+    labels.Draw();
+
+    for (int i = 0; i < 3; i++)
+        rows[i].g.Draw(x + LABEL, y + i * rowH, gw, rowH - GAP, rows[i].max,
+                       GREEN_PHOSPHOR, ColorAlpha(GREEN_PHOSPHOR, 0.25f));
+}
+
+// The last adaptive capture in the history's place: the same three rows,
+// from before the trigger to after it, the trigger marked. Readings come at
+// mixed rates, so each graph sample takes the highest reading in its slice
+// of time and holds the last one across slices without any.
+static void LoadCaptureGraphs(const AdaptiveCapture& cap) {
+    float span = cap.before + cap.after;
+    for (int m = 0; m < AM_COUNT; m++) {
+        SeriesGraph& g = s_captureGraphs[m];
+        g.Clear();
+        const std::vector<AdaptivePoint>& pts = cap.series[m];
+        if (pts.empty()) continue;
+        size_t i    = 0;
+        float  held = pts[0].v;
+        for (int s = 0; s < CAPTURE_POINTS; s++) {
+            float end = -cap.before + span * (s + 1) / CAPTURE_POINTS;
+            bool  any = false;
+            float hi  = 0.f;
+            for (; i < pts.size() && pts[i].t < end; i++) {
+                hi   = any ? std::max(hi, pts[i].v) : pts[i].v;
+                held = pts[i].v;
+                any  = true;
+            }
+            g.Push(any ? hi : held);
+        }
+    }
+}
+
+static void DrawCapture(int x, int y, int w, int h) {
+    static AdaptiveCapture cap;
+    AdaptiveStatus st = GetAdaptiveStatus();
+    if (st.captureId != cap.id) {
+        cap = GetAdaptiveCapture();
+        LoadCaptureGraphs(cap);
+    }
+
+    float netMax = 64.f;
+    while (netMax < cap.peak[AM_NET] && netMax < 1e9f) netMax *= 2.f;
+    const float maxes[AM_COUNT] = { 100.f, 100.f, netMax };
+    const int LABEL = 96;
+    const int GAP   = 6;
+    int rowH = std::min(100, h / 3);
+    int gw   = w - LABEL;
+    if (rowH < 44 || gw < 60) return;
+
+    static RetainedWidget labels;
+    if (labels.Begin(WidgetKey() << x << y << w << rowH << cap.id << st.capturing)) {
+        if (cap.id == 0) {
+            labels.Text(st.capturing ? "CAPTURING..." : "NO CAPTURE YET", x, y, 14, DIM_GREEN);
+            labels.Text("Readings near a threshold switch to fast sampling; crossing it", x, y + 20, 12, DIM_GREEN);
+            labels.Text("records the seconds around it here.   C  history", x, y + 34, 12, DIM_GREEN);
+        } else {
+            int markX = x + LABEL + (int)(gw * cap.before / (cap.before + cap.after));
+            for (int m = 0; m < AM_COUNT; m++) {
+                int   ry = y + m * rowH;
+                float p  = cap.peak[m];
+                labels.Text(ADAPTIVE_METRIC_NAMES[m], x, ry, 14, GREEN_PHOSPHOR);
+                if (m != AM_NET)      labels.TextF(x, ry + 16, 12, DIM_GREEN, "peak %.0f%%", p);
+                else if (p >= 1024.f) labels.TextF(x, ry + 16, 12, DIM_GREEN, "peak %.1f MB/s", p / 1024.f);
+                else                  labels.TextF(x, ry + 16, 12, DIM_GREEN, "peak %.0f KB/s", p);
+                labels.TextF(x, ry + 30, 10, DIM_GREEN, "before %.0f Hz", cap.preHz[m]);
+                labels.RectLines(x + LABEL - 1, ry - 1, gw + 2, rowH - GAP + 2, DIM_GREEN);
+                labels.Line(markX, ry, markX, ry + rowH - GAP, AMBER_PHOSPHOR);
+            }
+            labels.TextF(x + LABEL, y + 3 * rowH - GAP + 3, 10, DIM_GREEN, "capture %s  -%.0f s .. +%.0f s%s   C  history",
+                         cap.reason.c_str(), cap.before, cap.after, st.capturing ? "  (new one filling)" : "");
+        }
+    }
+    labels.Draw();
+
+    if (cap.id == 0) return;
+    for (int m = 0; m < AM_COUNT; m++)
+        s_captureGraphs[m].Draw(x + LABEL, y + m * rowH, gw, rowH - GAP, maxes[m],
+                                AMBER_PHOSPHOR, ColorAlpha(AMBER_PHOSPHOR, 0.25f));
+}
+
+// Which collectors adaptive sampling has on the fast cadence, on the
+// anomaly row
+static void DrawSamplingStatus(int right, int y) {
+    AdaptiveStatus st = GetAdaptiveStatus();
+    static RetainedWidget w;
+    WidgetKey key;
+    key << right << y << st.capturing << adaptiveConfig.fastMs;
+    for (bool b : st.boosted) key << b;
+    if (w.Begin(key)) {
+        char buf[64];
+        int  n = snprintf(buf, sizeof(buf), "%s %d HZ:", st.capturing ? "CAPTURING" : "SAMPLING",
+                          1000 / adaptiveConfig.fastMs);
+        bool any = false;
+        for (int m = 0; m < AM_COUNT; m++) {
+            if (!st.boosted[m] || n <= 0 || n >= (int)sizeof(buf)) continue;
+            n += snprintf(buf + n, sizeof(buf) - n, " %s", ADAPTIVE_METRIC_NAMES[m]);
+            any = true;
+        }
+        if (any) w.TextRight(buf, right, y + 4, 12, AMBER_PHOSPHOR);
+    }
+    w.Draw();
+}
+
+// Per-core load, one thin bar per logical CPU, in as many columns as the
+// panel height needs. Only shown when the canvas is wide enough for a
+// column of its own (see DrawDashboard).
+static void DrawCoreBars(int x, int y, int w, int h, const std::vector<float>& usage) {
+    static RetainedWidget panel;
+    WidgetKey key;
+    key << x << y << w << h << usage.size();
+    for (float u : usage) key << (int)u;
+    if (panel.Begin(key)) {
+        panel.Panel(x, y, w, h, "CPU CORES");
+        const int ROW  = 16;
+        int rows  = std::max(1, (h - 30) / ROW);
+        int n     = (int)usage.size();
+        int cols  = (n + rows - 1) / rows;
+        rows      = (n + cols - 1) / cols;   // balance the columns
+        int colW  = (w - 20) / std::max(cols, 1);
+        int label = colW >= 110 ? 34 : 0;
+        for (int i = 0; i < n; i++) {
+            int cx = x + 10 + (i / rows) * colW;
+            int cy = y + 20 + (i % rows) * ROW;
+            int bw = colW - label - 8;
+            float u = usage[i];
+            Color c = u > 90.f ? YELLOW_ALERT : u > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+            if (label) panel.TextF(cx, cy, 12, DIM_GREEN, "%3d", i);
+            panel.RectLines(cx + label, cy, bw, ROW - 4, DIM_GREEN);
+            int fill = (int)((bw - 4) * u / 100.f);
+            if (fill > 0) panel.Rect(cx + label + 2, cy + 2, fill, ROW - 8, c);
+        }
+    }
+    panel.Draw();
+}
+
+// Frame pacing, the dashboard's own cost in this mode, and render-thread
+// allocations per drawn frame (0 once every widget is retained)
+static void DrawPaceStatus(int right, int y) {
+    static RetainedWidget w;
+    FramePacerStatus ps = GetFramePacerStatus();
+    if (w.Begin(WidgetKey() << right << y << ps.mode << (int)(ps.fps * 10.f) << (int)ps.cpuMsPerMin
+                            << (int)(ps.allocsPerFrame * 10.f))) {
+        char buf[112];
+        if (ps.cpuMsPerMin >= 0.f)
+            snprintf(buf, sizeof(buf), "[F8] %s %.1f FPS  CPU %.0f ms/min  ALLOC %.1f/FRAME",
+                     PACE_MODE_NAMES[(int)ps.mode], ps.fps, ps.cpuMsPerMin, ps.allocsPerFrame);
+        else
+            snprintf(buf, sizeof(buf), "[F8] %s", PACE_MODE_NAMES[(int)ps.mode]);
+        w.TextRight(buf, right, y, 12, DIM_GREEN);
+    }
+    w.Draw();
+}
+
 void DrawDashboard() {
     ClearBackground(COLOR_BLACK);
     EnsureHardwareInfo();
@@ -246,185 +951,286 @@ void DrawDashboard() {
     const int BOT  = 30;
     const int COLW = 620;
     const int LX   = PAD;
-    const int RX   = COLW + PAD * 3;
-    const int RW   = WINDOW_WIDTH - RX - PAD;
+
+    // Canvases wider than the designed 1280 get a per-core CPU column
+    // between the metrics and the log, sampled along with the metrics. The
+    // other views draw over the right-hand side, so only on the dashboard.
+    static std::vector<float> coreUsage;
+    static int coresGen = 0;
+    bool coreCol = widgets.showCPU && stats.useRealData && layout.width >= 1600 &&
+                   (currentMenu == MENU_DASHBOARD || currentMenu == MENU_REAL_MONITORING);
+    if (coreCol) {
+        MarkWanted(s_coresWanted, s_coresCollector);
+        CopyCollected(s_collected.cores, s_collected.coresGen, coreUsage, coresGen);
+    }
+    coreCol = coreCol && !coreUsage.empty();
+    const int COREX = COLW + PAD * 3;
+    const int COREW = coreCol ? std::min(480, layout.width - WINDOW_WIDTH - PAD * 2) : 0;
+    const int RX    = COREX + (coreCol ? COREW + PAD * 2 : 0);
+    const int RW    = layout.width - RX - PAD;
     const int CT   = HDR + PAD * 2;
-    const int CB   = WINDOW_HEIGHT - BOT - PAD * 2;
+    const int CB   = layout.height - BOT - PAD * 2;
     const int CH   = CB - CT;
 
-    // Header
-    DrawRectangle(0, 0, WINDOW_WIDTH, HDR, ColorAlpha(COLOR_BLACK, 0.85f));
-    DrawLine(0, HDR, WINDOW_WIDTH, HDR, DIM_GREEN);
-    const char* title = stats.useRealData ? "MAINFRAME ONLINE [LIVE]" : "MAINFRAME ONLINE [SIM]";
-    int tw = MeasureText(title, 36);
-    DrawText(title, WINDOW_WIDTH / 2 - tw / 2, 10, 36, GREEN_PHOSPHOR);
-
-    if (widgets.showComputerName && stats.computerName[0]) {
-        std::string h = "HOST: " + std::string(stats.computerName);
-        DrawText(h.c_str(), LX + PAD, 8, 14, DIM_GREEN);
-    }
-    if (s_hwReady.load()) {
-        if (!s_hwInfo.cpuName.empty()) {
-            std::string c = "CPU: " + s_hwInfo.cpuName;
-            DrawText(c.c_str(), LX + PAD, 24, 13, DIM_GREEN);
+    // Header: rebuilt when the clock ticks or the hardware names arrive
+    {
+        static RetainedWidget header;
+        char clock[16] = "";
+        if (widgets.showSystemTime) {
+            time_t now = time(nullptr);
+            strftime(clock, sizeof(clock), "%H:%M:%S", localtime(&now));
         }
-        if (!s_hwInfo.gpuName.empty()) {
-            std::string g = "GPU: " + s_hwInfo.gpuName;
-            DrawText(g.c_str(), LX + PAD, 38, 13, DIM_GREEN);
+        bool hwReady = s_hwReady.load();
+        if (header.Begin(WidgetKey() << stats.useRealData << widgets.showComputerName << stats.computerName
+                                     << hwReady << clock)) {
+            header.Rect(0, 0, layout.width, HDR, ColorAlpha(COLOR_BLACK, 0.85f));
+            header.Line(0, HDR, layout.width, HDR, DIM_GREEN);
+            header.TextCentered(stats.useRealData ? "MAINFRAME ONLINE [LIVE]" : "MAINFRAME ONLINE [SIM]",
+                                layout.width / 2, 10, 36, GREEN_PHOSPHOR);
+            if (widgets.showComputerName && stats.computerName[0])
+                header.TextF(LX + PAD, 8, 14, DIM_GREEN, "HOST: %s", stats.computerName);
+            if (hwReady) {
+                if (!s_hwInfo.cpuName.empty())
+                    header.TextF(LX + PAD, 24, 13, DIM_GREEN, "CPU: %s", s_hwInfo.cpuName.c_str());
+                if (!s_hwInfo.gpuName.empty())
+                    header.TextF(LX + PAD, 38, 13, DIM_GREEN, "GPU: %s", s_hwInfo.gpuName.c_str());
+            } else {
+                header.Text("CPU: detecting...", LX + PAD, 24, 13, DIM_GREEN);
+                header.Text("GPU: detecting...", LX + PAD, 38, 13, DIM_GREEN);
+            }
+            if (widgets.showSystemTime) {
+                char ts[32]; snprintf(ts, sizeof(ts), "TIME: %s", clock);
+                header.TextRight(ts, layout.width - PAD * 2, 12, 16, DIM_GREEN);
+            }
         }
-    } else {
-        DrawText("CPU: detecting...", LX + PAD, 24, 13, DIM_GREEN);
-        DrawText("GPU: detecting...", LX + PAD, 38, 13, DIM_GREEN);
-    }
-    if (widgets.showSystemTime) {
-        time_t now = time(nullptr);
-        struct tm* t = localtime(&now);
-        char buf[32]; strftime(buf, sizeof(buf), "%H:%M:%S", t);
-        std::string ts = std::string("TIME: ") + buf;
-        int tsw = MeasureText(ts.c_str(), 16);
-        DrawText(ts.c_str(), WINDOW_WIDTH - tsw - PAD * 2, 20, 16, DIM_GREEN);
+        header.Draw();
+        DrawPaceStatus(layout.width - PAD * 2, 36);
     }
 
-    // Left panel - metrics
-    DrawPanel(LX, CT, COLW, CH, "SYSTEM METRICS");
+    // Left panel - metrics. Everything but the anomaly flash and the stress
+    // strip is one retained widget: it is rebuilt when a new sample lands or
+    // a shown value moves (easing between samples), not every frame.
     int rowH = 38, barX = LX + 110, barW = 280, barH = 22;
-    int detX = barX + barW + 10, rowY = CT + 20;
-
-    if (widgets.showCPU) {
-        if (stats.useRealData) {
-            Color cpuCol = stats.cpu > 90.f ? YELLOW_ALERT : stats.cpu > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-            DrawText("CPU", LX + 14, rowY + 2, 18, cpuCol);
-            DrawProgressBar(barX, rowY, barW, barH, stats.cpu, cpuCol);
-        } else {
-            DrawText("CPU", LX + 14, rowY + 2, 18, DIM_GREEN);
-            DrawText("-- enable real monitoring --", barX + 4, rowY + 4, 13, DIM_GREEN);
+    int detX = barX + barW + 10;
+
+    if (widgets.showDisk) RefreshDrives();
+    const std::vector<DiskInfo>& drives = s_drives;
+    PsiSnapshot psi;
+    if (widgets.showPSI && stats.useRealData) psi = GetPsi();
+
+    static RetainedWidget metrics;
+    static int metricsBottom = CT + 20;
+    WidgetKey mk;
+    mk.Mix(&widgets, sizeof(widgets));
+    mk << stats.useRealData << StatsSampleCount() << s_drivesGen
+       << (int)stats.cpu << (int)stats.ram << (int)(stats.netDown * 10.f) << (int)(stats.netUp * 10.f)
+       << stats.processCount << stats.uptimeSeconds / 60;
+    if (widgets.showPSI) {
+        mk << psi.supported;
+        for (int r = 0; r < PSI_COUNT; r++) {
+            const PsiStat& st = psi.res[r];
+            mk << st.valid << st.stalled << st.triggerArmed << (int)(st.some.deltaPct * 10.f)
+               << (int)(st.some.avg10 * 10.f) << (int)(st.some.avg60 * 10.f) << (int)(st.full.deltaPct * 10.f);
         }
-        rowY += rowH;
     }
-    if (widgets.showRAM) {
-        if (stats.useRealData) {
-            Color ramCol = stats.ram > 90.f ? YELLOW_ALERT : stats.ram > 75.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-            DrawText("RAM", LX + 14, rowY + 2, 18, ramCol);
-            DrawProgressBar(barX, rowY, barW, barH, stats.ram, ramCol);
-            std::string d = std::to_string(GetUsedRAM_MB()) + "/" + std::to_string(GetTotalRAM_MB()) + " MB";
-            DrawText(d.c_str(), detX, rowY + 4, 14, DIM_GREEN);
-        } else {
-            DrawText("RAM", LX + 14, rowY + 2, 18, DIM_GREEN);
-            DrawText("-- enable real monitoring --", barX + 4, rowY + 4, 13, DIM_GREEN);
+    if (metrics.Begin(mk)) {
+        int rowY = CT + 20;
+        metrics.Panel(LX, CT, COLW, CH, "SYSTEM METRICS");
+
+        if (widgets.showCPU) {
+            if (stats.useRealData) {
+                Color cpuCol = stats.cpu > 90.f ? YELLOW_ALERT : stats.cpu > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+                metrics.Text("CPU", LX + 14, rowY + 2, 18, cpuCol);
+                metrics.ProgressBar(barX, rowY, barW, barH, stats.cpu, cpuCol);
+                CgroupLimits cg = GetCgroupLimits();
+                if (cg.cpuCores > 0.f)
+                    metrics.TextF(detX, rowY + 4, 14, DIM_GREEN, "of %.1f-core quota", cg.cpuCores);
+            } else {
+                metrics.Text("CPU", LX + 14, rowY + 2, 18, DIM_GREEN);
+                metrics.Text("-- enable real monitoring --", barX + 4, rowY + 4, 13, DIM_GREEN);
+            }
+            rowY += rowH;
         }
-        rowY += rowH;
-    }
-    if (widgets.showDisk) {
-        static std::vector<DiskInfo> drives;
-        static float driveTimer = 5.f;
-        driveTimer += GetFrameTime();
-        if (driveTimer >= 5.f) { drives = GetAllDrives(); driveTimer = 0.f; }
-
-        for (const auto& drv : drives) {
-            char label[8]; snprintf(label, sizeof(label), "%c:", drv.letter);
-            DrawText(label, LX + 14, rowY + 2, 18, GREEN_PHOSPHOR);
-            Color dCol = drv.usedPct > 90.f ? YELLOW_ALERT :
-                         drv.usedPct > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-            DrawProgressBar(barX, rowY, barW, barH, drv.usedPct, dCol);
-            if (drv.ready) {
-                char detail[32];
-                snprintf(detail, sizeof(detail), "%llu/%llu GB", drv.usedGB, drv.totalGB);
-                DrawText(detail, detX, rowY + 4, 14, DIM_GREEN);
+        if (widgets.showRAM) {
+            if (stats.useRealData) {
+                Color ramCol = stats.ram > 90.f ? YELLOW_ALERT : stats.ram > 75.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+                metrics.Text("RAM", LX + 14, rowY + 2, 18, ramCol);
+                metrics.ProgressBar(barX, rowY, barW, barH, stats.ram, ramCol);
+                metrics.TextF(detX, rowY + 4, 14, DIM_GREEN, "%llu/%llu MB", GetUsedRAM_MB(), GetTotalRAM_MB());
+            } else {
+                metrics.Text("RAM", LX + 14, rowY + 2, 18, DIM_GREEN);
+                metrics.Text("-- enable real monitoring --", barX + 4, rowY + 4, 13, DIM_GREEN);
             }
             rowY += rowH;
         }
-    }
+        if (widgets.showDisk) {
+            for (const auto& drv : drives) {
+                char label[8]; snprintf(label, sizeof(label), "%c:", drv.letter);
+                metrics.Text(label, LX + 14, rowY + 2, 18, GREEN_PHOSPHOR);
+                Color dCol = drv.usedPct > 90.f ? YELLOW_ALERT :
+                             drv.usedPct > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+                metrics.ProgressBar(barX, rowY, barW, barH, drv.usedPct, dCol);
+                if (drv.ready)
+                    metrics.TextF(detX, rowY + 4, 14, DIM_GREEN, "%llu/%llu GB", drv.usedGB, drv.totalGB);
+                rowY += rowH;
+            }
+        }
 
-    bool hasText = widgets.showNetwork || widgets.showProcesses || widgets.showUptime || widgets.showAnomaly;
-    if (hasText && rowY > CT + 20) {
-        DrawLine(LX + 10, rowY, LX + COLW - 10, rowY, DIM_GREEN);
-        rowY += 10;
-    }
-    if (widgets.showNetwork) {
-        char downBuf[32], upBuf[32], netBuf[80];
-        // Auto-scale: show KB/s below 1024, MB/s above
-        if (stats.netDown >= 1024.f)
-            snprintf(downBuf, sizeof(downBuf), "%.2f MB/s", stats.netDown / 1024.f);
-        else
-            snprintf(downBuf, sizeof(downBuf), "%.1f KB/s", stats.netDown);
-        if (stats.netUp >= 1024.f)
-            snprintf(upBuf, sizeof(upBuf), "%.2f MB/s", stats.netUp / 1024.f);
-        else
-            snprintf(upBuf, sizeof(upBuf), "%.1f KB/s", stats.netUp);
-        snprintf(netBuf, sizeof(netBuf), "NET  %s DOWN   %s UP", downBuf, upBuf);
-        Color netCol = (stats.netDown > 512.f || stats.netUp > 512.f) ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-        DrawText(netBuf, LX + 14, rowY, 18, netCol);
-        if (!stats.useRealData) {
-            DrawText("[SIM]", LX + COLW - 60, rowY + 2, 12, DIM_GREEN);
+        bool hasText = widgets.showNetwork || widgets.showProcesses || widgets.showUptime ||
+                       widgets.showPSI || widgets.showAnomaly;
+        if (hasText && rowY > CT + 20) {
+            metrics.Line(LX + 10, rowY, LX + COLW - 10, rowY, DIM_GREEN);
+            rowY += 10;
         }
-        rowY += rowH;
-    }
-    if (widgets.showProcesses) {
-        std::string s = "PROC  " + std::to_string(stats.processCount) + " running";
-        DrawText(s.c_str(), LX + 14, rowY, 18, GREEN_PHOSPHOR);
-        rowY += rowH;
-    }
-    if (widgets.showUptime) {
-        unsigned long long up = stats.uptimeSeconds;
-        char buf[64];
-        snprintf(buf, sizeof(buf), "UP    %llud %02lluh %02llum", up/86400, (up%86400)/3600, (up%3600)/60);
-        DrawText(buf, LX + 14, rowY, 18, GREEN_PHOSPHOR);
-        rowY += rowH;
+        if (widgets.showNetwork) {
+            char downBuf[32], upBuf[32];
+            // Auto-scale: show KB/s below 1024, MB/s above
+            if (stats.netDown >= 1024.f)
+                snprintf(downBuf, sizeof(downBuf), "%.2f MB/s", stats.netDown / 1024.f);
+            else
+                snprintf(downBuf, sizeof(downBuf), "%.1f KB/s", stats.netDown);
+            if (stats.netUp >= 1024.f)
+                snprintf(upBuf, sizeof(upBuf), "%.2f MB/s", stats.netUp / 1024.f);
+            else
+                snprintf(upBuf, sizeof(upBuf), "%.1f KB/s", stats.netUp);
+            Color netCol = (stats.netDown > 512.f || stats.netUp > 512.f) ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+            metrics.TextF(LX + 14, rowY, 18, netCol, "NET  %s DOWN   %s UP", downBuf, upBuf);
+            if (!stats.useRealData)
+                metrics.Text("[SIM]", LX + COLW - 60, rowY + 2, 12, DIM_GREEN);
+            rowY += rowH;
+        }
+        if (widgets.showProcesses) {
+            metrics.TextF(LX + 14, rowY, 18, GREEN_PHOSPHOR, "PROC  %d running", stats.processCount);
+            rowY += rowH;
+        }
+        if (widgets.showUptime) {
+            unsigned long long up = stats.uptimeSeconds;
+            metrics.TextF(LX + 14, rowY, 18, GREEN_PHOSPHOR, "UP    %llud %02lluh %02llum",
+                          up/86400, (up%86400)/3600, (up%3600)/60);
+            rowY += rowH;
+        }
+        if (widgets.showPSI) {
+            // Stall share over the last second per resource; detail line has the
+            // kernel's avg10/avg60 and the full-stall share for memory and IO
+            if (!stats.useRealData) {
+                metrics.Text("PSI", LX + 14, rowY, 18, DIM_GREEN);
+                metrics.Text("-- enable real monitoring --", barX + 4, rowY + 4, 13, DIM_GREEN);
+            } else if (!psi.supported) {
+                metrics.Text("PSI   not available", LX + 14, rowY, 18, DIM_GREEN);
+            } else {
+                metrics.Text("PSI", LX + 14, rowY, 18, GREEN_PHOSPHOR);
+                int px = LX + 70;
+                for (int r = 0; r < PSI_COUNT; r++) {
+                    const PsiStat& st = psi.res[r];
+                    Color c = !st.valid ? DIM_GREEN : st.stalled ? YELLOW_ALERT :
+                              st.some.deltaPct >= psiConfig.thresholdPct[r] * 0.5f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+                    metrics.TextF(px, rowY, 18, c, "%s %.1f%%", PSI_RESOURCE_NAMES[r], st.some.deltaPct);
+                    px += 130;
+                }
+                const PsiStat& m = psi.res[PSI_MEMORY];
+                const PsiStat& io = psi.res[PSI_IO];
+                metrics.TextF(LX + 70, rowY + 20, 12, DIM_GREEN,
+                              "avg10 %.1f/%.1f/%.1f  avg60 %.1f/%.1f/%.1f  full mem %.1f io %.1f%s",
+                              psi.res[PSI_CPU].some.avg10, m.some.avg10, io.some.avg10,
+                              psi.res[PSI_CPU].some.avg60, m.some.avg60, io.some.avg60,
+                              m.full.deltaPct, io.full.deltaPct,
+                              psi.res[PSI_CPU].triggerArmed || m.triggerArmed || io.triggerArmed ? "  [TRIG]" : "");
+            }
+            rowY += rowH;
+        }
+        metricsBottom = rowY;
     }
+    metrics.Draw();
+
+    int rowY = metricsBottom;
     if (widgets.showAnomaly) {
         anomaly.flashTimer += GetFrameTime() * (anomaly.triggered ? 6.f : 2.f);
         if (anomaly.triggered) {
             // Red flash when something is wrong
             Color ac = RED;
             ac.a = static_cast<unsigned char>(120 + 135 * fabsf(sinf(anomaly.flashTimer)));
-            std::string label = "ANOMALY  " + anomaly.reason;
-            DrawText(label.c_str(), LX + 14, rowY, 18, ac);
+            char label[96];
+            snprintf(label, sizeof(label), "ANOMALY  %s", anomaly.reason.c_str());
+            DrawTextRun(label, LX + 14, rowY, 18, ac);
         } else {
-            // Gentle green pulse when all clear
+            // Gentle green pulse when all clear; steady under ON-DEMAND
+            // pacing, where it alone would keep every frame drawing
             Color ac = GREEN_PHOSPHOR;
-            ac.a = static_cast<unsigned char>(160 + 95 * sinf(anomaly.flashTimer));
-            DrawText("ANOMALY  NONE DETECTED", LX + 14, rowY, 18, ac);
+            if (framePacerConfig.mode != PaceMode::ON_DEMAND)
+                ac.a = static_cast<unsigned char>(160 + 95 * sinf(anomaly.flashTimer));
+            DrawTextRun("ANOMALY  NONE DETECTED", LX + 14, rowY, 18, ac);
         }
+        if (stats.useRealData) DrawSamplingStatus(LX + COLW - 14, rowY);
         rowY += rowH;
     }
+    if (stressState == StressTestState::RUNNING || CachedStressScore().valid) {
+        if (CB - 10 - rowY >= 70)
+            DrawStressBench(LX + 14, rowY, COLW - 28, CB - 10 - rowY);
+    } else if (CB - 24 - rowY >= 132) {
+        if (showCapture) DrawCapture(LX + 14, rowY + 4, COLW - 28, CB - 24 - rowY);
+        else             DrawHistory(LX + 14, rowY + 4, COLW - 28, CB - 24 - rowY);
+    }
 
-    // Right panel - log
+    if (coreCol) DrawCoreBars(COREX, CT, COREW, CH, coreUsage);
+
+    // Right panel - log. With a tailed file the lower part follows the file.
     if (widgets.showSystemLog) {
         DrawPanel(RX, CT, RW, CH, "SYSTEM LOG");
-        int logY = CT + 18, logMax = CT + CH - 10;
-        for (int i = (int)logEntries.size() - 1; i >= 0 && logY + 18 < logMax; i--) {
-            float age = GetTime() - logEntries[i].time;
-            if (age < 60.f) {
-                Color c = logEntries[i].color;
-                c.a = static_cast<unsigned char>(255 * (1.f - age / 60.f));
-                DrawText(logEntries[i].message.c_str(), RX + 10, logY, 14, c);
-                logY += 18;
-            }
-        }
+        bool tailing = !logTailConfig.path.empty();
+        int logMax = tailing ? CT + CH * 2 / 5 : CT + CH - 10;
+        DrawEventLog(RX, CT, RW, logMax);
+        if (tailing) DrawLogTail(RX, logMax, RW, CT + CH - logMax);
     }
 
     // Bottom bar
-    DrawLine(0, WINDOW_HEIGHT - BOT, WINDOW_WIDTH, WINDOW_HEIGHT - BOT, DIM_GREEN);
-    DrawText("TAB: Menu", PAD, WINDOW_HEIGHT - BOT + 8, 14, DIM_GREEN);
-
-    // Stress test indicator / hint
     if (stressState == StressTestState::RUNNING) {
+        // Stress test indicator, flashing: drawn directly
         static float stressFlash = 0.f;
         stressFlash += GetFrameTime() * 5.f;
         Color sc = AMBER_PHOSPHOR;
         sc.a = (unsigned char)(160 + 95 * fabsf(sinf(stressFlash)));
-        char stressBuf[48];
-        snprintf(stressBuf, sizeof(stressBuf), "STRESS  %.0f%%  [F5] STOP", stressProgress * 100.f);
-        int sw = MeasureText(stressBuf, 14);
-        DrawText(stressBuf, WINDOW_WIDTH / 2 - sw / 2, WINDOW_HEIGHT - BOT + 8, 14, sc);
-    } else {
-        const char* mode = stats.useRealData ? "MODE: LIVE  [F5] STRESS TEST" : "MODE: SIM";
-        int mw = MeasureText(mode, 14);
-        DrawText(mode, WINDOW_WIDTH / 2 - mw / 2, WINDOW_HEIGHT - BOT + 8, 14, DIM_GREEN);
+        char stressBuf[112];
+        StressLoadStatus ls = GetStressLoadStatus();
+        if (ls.active)
+            snprintf(stressBuf, sizeof(stressBuf), "STRESS %s  %.0f%%  LOAD %.0f%% (meas %.0f%% duty %.2f)  [F5] STOP",
+                     STRESS_WORKLOAD_NAMES[(int)stressWorkload], stressProgress * 100.f,
+                     ls.setpointPct, ls.measuredPct, ls.duty);
+        else
+            snprintf(stressBuf, sizeof(stressBuf), "STRESS %s  %.0f%%  [F5] STOP",
+                     STRESS_WORKLOAD_NAMES[(int)stressWorkload], stressProgress * 100.f);
+        int sw = MeasureTextRun(stressBuf, 14);
+        DrawTextRun(stressBuf, layout.width / 2 - sw / 2, layout.height - BOT + 8, 14, sc);
     }
-
-    int tnw = MeasureText(THEME_NAMES[currentTheme], 14);
-    DrawText(THEME_NAMES[currentTheme], WINDOW_WIDTH - tnw - PAD, WINDOW_HEIGHT - BOT + 8, 14, DIM_GREEN);
+    static RetainedWidget footer;
+    bool stressRunning = stressState == StressTestState::RUNNING;
+    if (footer.Begin(WidgetKey() << stressRunning << stats.useRealData << stressWorkload << stressLoad.ramp
+                                 << stressLoad.rampFromPct << stressLoad.rampToPct << stressLoad.targetPct
+                                 << crtQuality << CrtQualityActive())) {
+        footer.Line(0, layout.height - BOT, layout.width, layout.height - BOT, DIM_GREEN);
+        footer.Text("TAB: Menu", PAD, layout.height - BOT + 8, 14, DIM_GREEN);
+        if (!stressRunning) {
+            char loadBuf[24], modeBuf[96];
+            if (stressLoad.ramp != StressRamp::CONSTANT)
+                snprintf(loadBuf, sizeof(loadBuf), "%s %d-%d%%", STRESS_RAMP_NAMES[(int)stressLoad.ramp],
+                         stressLoad.rampFromPct, stressLoad.rampToPct);
+            else
+                snprintf(loadBuf, sizeof(loadBuf), "%d%%", stressLoad.targetPct);
+            snprintf(modeBuf, sizeof(modeBuf), "MODE: LIVE  [F5] STRESS  [F6] %s  [F7] %s",
+                     STRESS_WORKLOAD_NAMES[(int)stressWorkload], loadBuf);
+            footer.TextCentered(stats.useRealData ? modeBuf : "MODE: SIM", layout.width / 2,
+                                layout.height - BOT + 8, 14, DIM_GREEN);
+        }
+        footer.TextRight(THEME_NAMES[currentTheme], layout.width - PAD, layout.height - BOT + 8, 14, DIM_GREEN);
+        // CRT tier left of the theme name; AUTO shows what it picked
+        char crtBuf[32];
+        if (crtQuality == CrtQuality::AUTO)
+            snprintf(crtBuf, sizeof(crtBuf), "[F9] CRT AUTO:%s", CRT_QUALITY_NAMES[(int)CrtQualityActive()]);
+        else
+            snprintf(crtBuf, sizeof(crtBuf), "[F9] CRT %s", CRT_QUALITY_NAMES[(int)crtQuality]);
+        footer.TextRight(crtBuf, layout.width - PAD - MeasureTextRun(THEME_NAMES[currentTheme], 14) - 20,
+                         layout.height - BOT + 8, 14, DIM_GREEN);
+    }
+    footer.Draw();
 
     // View overlays (replace right panel / full area when active)
     if (currentMenu == MENU_NETWORK_TEST) {
@@ -433,63 +1239,150 @@ void DrawDashboard() {
     if (currentMenu == MENU_SYSTEM_INFO) {
         DrawSystemInfo();
     }
+    if (currentMenu == MENU_BENCHMARKS) {
+        DrawBenchmarks();
+    }
+    if (currentMenu == MENU_CGROUPS) {
+        DrawCgroups();
+    }
+    if (currentMenu == MENU_MEMORY) {
+        DrawMemoryDetail();
+    }
 
     DrawMenu();
 }
 
 // ── Speed test panel (drawn here to avoid Windows/raylib header conflicts) ────
+// Keyed on what it shows; while the scheduler is on, also on the wall-clock
+// second so the countdown ticks
 static void DrawSpeedTestPanel(int x, int y, int w, int h) {
-    speedTestProgress = speedTestProgress; // sync done in main loop
     const Color NT  = {255, 255, 255, 255};
     const int   PAD = 12;
+    const SpeedTestSchedule& sc = speedTestSchedule;
+
+    static RetainedWidget panel;
+    WidgetKey key;
+    key << x << y << w << h << speedTestState << (int)(speedTestProgress * 100.f)
+        << sc.enabled << sc.intervalMin << sc.dailyBudgetMB << speedTestHasSaved;
+    if (speedTestState == SpeedTestState::DONE) key << speedTestResult.downloadMbps << speedTestResult.timestamp;
+    if (speedTestHasSaved) key << speedTestLastSaved.timestamp;
+    if (sc.enabled)        key << (long long)time(nullptr);
+    if (panel.Begin(key)) {
+        const char* stateStr = "IDLE - PRESS ENTER TO START";
+        Color stateCol = DIM_GREEN;
+        if      (speedTestState == SpeedTestState::RUNNING) { stateStr = "RUNNING..."; stateCol = AMBER_PHOSPHOR; }
+        else if (speedTestState == SpeedTestState::DONE)    { stateStr = "COMPLETE";   stateCol = GREEN_PHOSPHOR; }
+        else if (speedTestState == SpeedTestState::FAILED)  { stateStr = "FAILED - CHECK CONNECTION"; stateCol = YELLOW_ALERT; }
+
+        panel.Text(stateStr, x + PAD, y + PAD + 2, 13, stateCol);
+        panel.Line(x + PAD, y + 30, x + w - PAD, y + 30, DIM_GREEN);
+
+        int cy = y + 36;
+
+        if (speedTestState == SpeedTestState::RUNNING) {
+            int bw = w - PAD * 2;
+            panel.Rect(x + PAD, cy, bw, 14, COLOR_BLACK);
+            panel.RectLines(x + PAD, cy, bw, 14, DIM_GREEN);
+            int fill = static_cast<int>(bw * speedTestProgress);
+            if (fill > 2) panel.Rect(x + PAD + 1, cy + 1, fill - 2, 12, GREEN_PHOSPHOR);
+            panel.TextF(x + PAD + bw / 2 - 12, cy, 13, NT, "%.0f%%", speedTestProgress * 100.f);
+            cy += 20;
+            panel.Text("speed.cloudflare.com", x + PAD, cy, 12, DIM_GREEN);
+        }
 
-    const char* stateStr = "IDLE - PRESS ENTER TO START";
-    Color stateCol = DIM_GREEN;
-    if      (speedTestState == SpeedTestState::RUNNING) { stateStr = "RUNNING..."; stateCol = AMBER_PHOSPHOR; }
-    else if (speedTestState == SpeedTestState::DONE)    { stateStr = "COMPLETE";   stateCol = GREEN_PHOSPHOR; }
-    else if (speedTestState == SpeedTestState::FAILED)  { stateStr = "FAILED - CHECK CONNECTION"; stateCol = YELLOW_ALERT; }
-
-    DrawText(stateStr, x + PAD, y + PAD + 2, 13, stateCol);
-    DrawLine(x + PAD, y + 30, x + w - PAD, y + 30, DIM_GREEN);
+        if (speedTestState == SpeedTestState::DONE) {
+            panel.TextF(x + PAD, cy, 15, GREEN_PHOSPHOR, "DL  %.1f Mbps", speedTestResult.downloadMbps); cy += 20;
+            panel.TextF(x + PAD, cy, 15, AMBER_PHOSPHOR, "UL  ~%.1f Mbps", speedTestResult.uploadMbps); cy += 20;
 
-    int cy = y + 36;
+            Color pingCol = speedTestResult.pingMs < 50.f ? GREEN_PHOSPHOR :
+                            speedTestResult.pingMs < 100.f ? AMBER_PHOSPHOR : YELLOW_ALERT;
+            panel.TextF(x + PAD, cy, 15, pingCol, "PING  %.0f ms", speedTestResult.pingMs); cy += 20;
+            panel.TextF(x + PAD, cy, 12, DIM_GREEN, "     p90 %.0f  max %.0f ms",
+                        speedTestResult.pingP90Ms, speedTestResult.pingMaxMs); cy += 16;
 
-    if (speedTestState == SpeedTestState::RUNNING) {
-        int bw = w - PAD * 2;
-        DrawRectangle(x + PAD, cy, bw, 14, COLOR_BLACK);
-        DrawRectangleLines(x + PAD, cy, bw, 14, DIM_GREEN);
-        int fill = static_cast<int>(bw * speedTestProgress);
-        if (fill > 2) DrawRectangle(x + PAD + 1, cy + 1, fill - 2, 12, GREEN_PHOSPHOR);
-        char pct[16]; snprintf(pct, sizeof(pct), "%.0f%%", speedTestProgress * 100.f);
-        DrawText(pct, x + PAD + bw / 2 - 12, cy, 13, NT);
-        cy += 20;
-        DrawText("speed.cloudflare.com", x + PAD, cy, 12, DIM_GREEN);
-    }
-
-    if (speedTestState == SpeedTestState::DONE) {
-        char buf[64];
-        snprintf(buf, sizeof(buf), "DL  %.1f Mbps", speedTestResult.downloadMbps);
-        DrawText(buf, x + PAD, cy, 15, GREEN_PHOSPHOR); cy += 20;
+            panel.Line(x + PAD, cy, x + w - PAD, cy, {40, 40, 40, 255}); cy += 6;
+            panel.Text(speedTestResult.timestamp.c_str(), x + PAD, cy, 11, DIM_GREEN); cy += 16;
+            panel.Text("ENTER: rerun   S: save   H: history", x + PAD, cy, 12, DIM_GREEN);
+        }
 
-        snprintf(buf, sizeof(buf), "UL  ~%.1f Mbps", speedTestResult.uploadMbps);
-        DrawText(buf, x + PAD, cy, 15, AMBER_PHOSPHOR); cy += 20;
+        // Scheduler status line
+        Color schedCol = sc.enabled ? GREEN_PHOSPHOR : DIM_GREEN;
+        if (sc.enabled) {
+            SpeedTestSchedulerStatus st = GetSpeedTestSchedulerStatus();
+            if (st.active) {
+                long long wait = st.nextRunUnix - (long long)time(nullptr);
+                if (wait < 0) wait = 0;
+                panel.TextF(x + PAD, y + h - 50, 11, schedCol, "AUTO %dm  next %lldm%02llds  %.0f/%d MB today  [A]",
+                            sc.intervalMin, wait / 60, wait % 60, st.usedTodayBytes / 1e6, sc.dailyBudgetMB);
+            } else {
+                panel.TextF(x + PAD, y + h - 50, 11, schedCol, "AUTO OFF  [A] schedule every %dm", sc.intervalMin);
+            }
+            if (!st.lastSkip.empty())
+                panel.TextF(x + PAD, y + h - 34, 11, DIM_GREEN, "last skip: %s  (%d today)",
+                            st.lastSkip.c_str(), st.skipsToday);
+        } else {
+            panel.TextF(x + PAD, y + h - 50, 11, schedCol, "AUTO OFF  [A] schedule every %dm", sc.intervalMin);
+        }
 
-        Color pingCol = speedTestResult.pingMs < 50.f ? GREEN_PHOSPHOR :
-                        speedTestResult.pingMs < 100.f ? AMBER_PHOSPHOR : YELLOW_ALERT;
-        snprintf(buf, sizeof(buf), "PING  %.0f ms", speedTestResult.pingMs);
-        DrawText(buf, x + PAD, cy, 15, pingCol); cy += 20;
+        if (speedTestHasSaved)
+            panel.TextF(x + PAD, y + h - 18, 11, DIM_GREEN, "Saved: %.1f Mbps  %s",
+                        speedTestLastSaved.downloadMbps, speedTestLastSaved.timestamp.c_str());
+    }
+    panel.Draw();
+}
 
-        DrawLine(x + PAD, cy, x + w - PAD, cy, {40, 40, 40, 255}); cy += 6;
-        DrawText(speedTestResult.timestamp.c_str(), x + PAD, cy, 11, DIM_GREEN); cy += 16;
-        DrawText("ENTER: rerun   S: save", x + PAD, cy, 12, DIM_GREEN);
+// ── Speed test history (replaces the adapter list while toggled with H) ───────
+// Only changes when a result is saved
+static void DrawSpeedHistoryPanel(int x, int y, int w, int h) {
+    const int PAD = 10;
+    SpeedTestTrend tr = GetSpeedTestTrend();
+    static RetainedWidget panel;
+    if (!panel.Begin(WidgetKey() << x << y << w << h << tr.count << tr.lastTime)) { panel.Draw(); return; }
+
+    if (tr.count == 0) {
+        panel.Text("No saved results yet", x + PAD, y + 16, 13, DIM_GREEN);
+        panel.Text("Run a test and press S to record it", x + PAD, y + 34, 12, DIM_GREEN);
+        panel.Draw();
+        return;
     }
 
-    if (speedTestHasSaved) {
-        char saved[80];
-        snprintf(saved, sizeof(saved), "Saved: %.1f Mbps  %s",
-            speedTestLastSaved.downloadMbps, speedTestLastSaved.timestamp.c_str());
-        DrawText(saved, x + PAD, y + h - 18, 11, DIM_GREEN);
+    double spanDays = (tr.lastTime - tr.firstTime) / 86400.0;
+    panel.TextF(x + PAD, y + 16, 14, GREEN_PHOSPHOR, "%zu RUNS over %.1f DAYS", tr.count, spanDays);
+    panel.TextRight(tr.timeWindows ? "7d vs prior 28d" : "last 10 vs prior 50 runs", x + w - PAD, y + 18, 12, DIM_GREEN);
+
+    panel.TextF(x + PAD, y + 36, 13, tr.dlRegression ? YELLOW_ALERT : GREEN_PHOSPHOR,
+                "DL   %.1f Mbps  (was %.1f)", tr.recentDlMbps, tr.baselineDlMbps);
+    panel.TextF(x + PAD, y + 52, 13, tr.pingRegression ? YELLOW_ALERT : GREEN_PHOSPHOR,
+                "PING %.0f ms  (was %.0f)", tr.recentPingMs, tr.baselinePingMs);
+    if (tr.dlRegression || tr.pingRegression)
+        panel.TextRight("REGRESSION", x + w - PAD, y + 42, 14, YELLOW_ALERT);
+
+    // Download trend: min/max band per time bucket with the average on top
+    int gx = x + PAD, gy = y + 74, gw = w - PAD * 2, gh = h - 74 - PAD;
+    if (gh >= 30) {
+        panel.RectLines(gx, gy, gw, gh, DIM_GREEN);
+
+        static std::vector<SpeedTestBucket> series;
+        GetSpeedTestSeries(gw / 3, series);
+        float peak = 1.f;
+        for (const auto& b : series) if (b.count > 0 && b.dlMax > peak) peak = b.dlMax;
+
+        int prevX = -1, prevY = 0;
+        for (int i = 0; i < (int)series.size(); i++) {
+            const SpeedTestBucket& b = series[i];
+            if (b.count == 0) continue;
+            int bx  = gx + 1 + i * 3;
+            int top = gy + gh - 2 - (int)((gh - 4) * (b.dlMax / peak));
+            int bot = gy + gh - 2 - (int)((gh - 4) * (b.dlMin / peak));
+            panel.Rect(bx, top, 2, bot - top + 1, ColorAlpha(DIM_GREEN, 0.6f));
+            int ay = gy + gh - 2 - (int)((gh - 4) * (b.dlAvg / peak));
+            if (prevX >= 0) panel.Line(prevX, prevY, bx + 1, ay, GREEN_PHOSPHOR);
+            prevX = bx + 1; prevY = ay;
+        }
+        panel.TextF(gx + 4, gy + 3, 11, DIM_GREEN, "%.0f Mbps", peak);
+        panel.TextRight("H: adapters", gx + gw - 4, gy + 3, 11, DIM_GREEN);
     }
+    panel.Draw();
 }
 
 // ── Network Diagnostics view ──────────────────────────────────────────────────
@@ -498,9 +1391,9 @@ void DrawNetworkDiagnostics() {
     const int HDR = 55;
     const int BOT = 30;
     const int RX  = 640 + PAD * 3;
-    const int RW  = WINDOW_WIDTH - RX - PAD;
+    const int RW  = layout.width - RX - PAD;
     const int CT  = HDR + PAD * 2;
-    const int CH  = WINDOW_HEIGHT - BOT - PAD * 2 - CT;
+    const int CH  = layout.height - BOT - PAD * 2 - CT;
 
     // Split: top 55% adapters, bottom 45% speed test
     const int ADAPTER_H  = static_cast<int>(CH * 0.52f);
@@ -509,236 +1402,921 @@ void DrawNetworkDiagnostics() {
 
     // ── Adapter panel ─────────────────────────────────────────────────────────
     static std::vector<AdapterInfo> adapters;
-    static float refreshTimer = 2.f;
-    refreshTimer += GetFrameTime();
-    if (refreshTimer >= 2.f) { adapters = GetAdapterList(); refreshTimer = 0.f; }
-
-    DrawPanel(RX, CT, RW, ADAPTER_H, "NETWORK ADAPTERS");
-
-    // Live throughput bar
-    float down = stats.netDown, up = stats.netUp;
-    char downStr[24], upStr[24], throughput[80];
-    auto fmtKB = [](float kbps, char* buf, int sz) {
-        if (kbps >= 1024.f) snprintf(buf, sz, "%.2f MB/s", kbps / 1024.f);
-        else                 snprintf(buf, sz, "%.1f KB/s", kbps);
-    };
-    fmtKB(down, downStr, sizeof(downStr));
-    fmtKB(up,   upStr,   sizeof(upStr));
-    snprintf(throughput, sizeof(throughput), "LIVE  %s DOWN   %s UP", downStr, upStr);
-    Color tCol = (down > 512.f || up > 512.f) ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-    DrawText(throughput, RX + 10, CT + 16, 14, tCol);
-    DrawLine(RX + 10, CT + 34, RX + RW - 10, CT + 34, DIM_GREEN);
-
-    int ay = CT + 40;
-    const int lineH = 16;
-    if (adapters.empty()) {
-        DrawText("No adapters found", RX + 10, ay, 13, DIM_GREEN);
-    }
-    for (const auto& a : adapters) {
-        if (ay + lineH * 4 > CT + ADAPTER_H - 6) break;
-        Color sc = a.connected ? GREEN_PHOSPHOR : DIM_GREEN;
-        std::string name = a.name.size() > 30 ? a.name.substr(0, 27) + "..." : a.name;
-        DrawText(name.c_str(), RX + 10, ay, 13, sc);
-        DrawText(a.connected ? "[UP]" : "[DN]", RX + RW - 46, ay, 12, sc);
-        ay += lineH;
-
-        std::string ip = "  " + a.ipAddress;
-        DrawText(ip.c_str(), RX + 10, ay, 12, DIM_GREEN);
-
-        char spd[32];
-        if      (a.speed >= 1000000000UL) snprintf(spd, sizeof(spd), "%.0fGbps", a.speed/1e9);
-        else if (a.speed >= 1000000UL)    snprintf(spd, sizeof(spd), "%.0fMbps", a.speed/1e6);
-        else if (a.speed > 0)             snprintf(spd, sizeof(spd), "%.0fKbps", a.speed/1e3);
-        else                              snprintf(spd, sizeof(spd), "N/A");
-        DrawText(spd, RX + RW - MeasureText(spd, 12) - 6, ay, 12, DIM_GREEN);
-        ay += lineH;
-
-        char rx[40];
-        snprintf(rx, sizeof(rx), "  RX %.1fMB  TX %.1fMB",
-            a.bytesIn/(1024.0*1024.0), a.bytesOut/(1024.0*1024.0));
-        DrawText(rx, RX + 10, ay, 12, DIM_GREEN);
-        ay += lineH;
-
-        DrawLine(RX + 10, ay + 1, RX + RW - 10, ay + 1, {40, 40, 40, 255});
-        ay += 6;
+    static int adaptersGen = 0;
+    MarkWanted(s_adaptersWanted, s_adaptersCollector);
+    CopyCollected(s_collected.adapters, s_collected.adaptersGen, adapters, adaptersGen);
+
+    if (showSpeedHistory) {
+        DrawPanel(RX, CT, RW, ADAPTER_H, "SPEED HISTORY");
+        DrawSpeedHistoryPanel(RX, CT, RW, ADAPTER_H);
+        DrawPanel(RX, SPEEDTEST_Y, RW, SPEEDTEST_H, "SPEED TEST");
+        DrawSpeedTestPanel(RX, SPEEDTEST_Y, RW, SPEEDTEST_H);
+        return;
     }
 
+    // Adapter counters only move on a refresh, throughput on a new sample
+    static RetainedWidget list;
+    if (list.Begin(WidgetKey() << adaptersGen << stats.netDown << stats.netUp)) {
+        list.Panel(RX, CT, RW, ADAPTER_H, "NETWORK ADAPTERS");
+
+        // Live throughput bar
+        float down = stats.netDown, up = stats.netUp;
+        char downStr[24], upStr[24];
+        auto fmtKB = [](float kbps, char* buf, int sz) {
+            if (kbps >= 1024.f) snprintf(buf, sz, "%.2f MB/s", kbps / 1024.f);
+            else                 snprintf(buf, sz, "%.1f KB/s", kbps);
+        };
+        fmtKB(down, downStr, sizeof(downStr));
+        fmtKB(up,   upStr,   sizeof(upStr));
+        Color tCol = (down > 512.f || up > 512.f) ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+        list.TextF(RX + 10, CT + 16, 14, tCol, "LIVE  %s DOWN   %s UP", downStr, upStr);
+        list.Line(RX + 10, CT + 34, RX + RW - 10, CT + 34, DIM_GREEN);
+
+        int ay = CT + 40;
+        const int lineH = 16;
+        if (adapters.empty()) {
+            list.Text("No adapters found", RX + 10, ay, 13, DIM_GREEN);
+        }
+        for (const auto& a : adapters) {
+            if (ay + lineH * 4 > CT + ADAPTER_H - 6) break;
+            Color sc = a.connected ? GREEN_PHOSPHOR : DIM_GREEN;
+            if (a.name.size() > 30) list.TextF(RX + 10, ay, 13, sc, "%.27s...", a.name.c_str());
+            else                    list.Text(a.name.c_str(), RX + 10, ay, 13, sc);
+            list.Text(a.connected ? "[UP]" : "[DN]", RX + RW - 46, ay, 12, sc);
+            ay += lineH;
+
+            list.TextF(RX + 10, ay, 12, DIM_GREEN, "  %s", a.ipAddress.c_str());
+
+            char spd[32];
+            if      (a.speed >= 1000000000UL) snprintf(spd, sizeof(spd), "%.0fGbps", a.speed/1e9);
+            else if (a.speed >= 1000000UL)    snprintf(spd, sizeof(spd), "%.0fMbps", a.speed/1e6);
+            else if (a.speed > 0)             snprintf(spd, sizeof(spd), "%.0fKbps", a.speed/1e3);
+            else                              snprintf(spd, sizeof(spd), "N/A");
+            list.TextRight(spd, RX + RW - 6, ay, 12, DIM_GREEN);
+            ay += lineH;
+
+            list.TextF(RX + 10, ay, 12, DIM_GREEN, "  RX %.1fMB  TX %.1fMB",
+                       a.bytesIn/(1024.0*1024.0), a.bytesOut/(1024.0*1024.0));
+            ay += lineH;
+
+            list.Line(RX + 10, ay + 1, RX + RW - 10, ay + 1, {40, 40, 40, 255});
+            ay += 6;
+        }
+    }
+    list.Draw();
+
     // ── Speed test panel ──────────────────────────────────────────────────────
     DrawPanel(RX, SPEEDTEST_Y, RW, SPEEDTEST_H, "SPEED TEST");
     DrawSpeedTestPanel(RX, SPEEDTEST_Y, RW, SPEEDTEST_H);
 }
 
+// ── Benchmarks view ───────────────────────────────────────────────────────────
+// Replaces the right panel so the RAM widget on the left keeps showing the
+// pressure the memory test puts on the machine.
+static void DrawMemoryBench(int x, int y, int w, int h) {
+    const int PAD = 12;
+    const MemStressConfig& cfg = memStressConfig;
+    MemStressResult r = GetMemStressResult();
+    bool running = memStressState == MemStressState::RUNNING;
+    char buf[128];
+
+    const char* stateStr = "IDLE - PRESS ENTER TO START";
+    Color stateCol = DIM_GREEN;
+    if      (running)                                   { stateStr = r.phase.c_str(); stateCol = AMBER_PHOSPHOR; }
+    else if (memStressState == MemStressState::DONE)    { stateStr = r.phase.c_str(); stateCol = GREEN_PHOSPHOR; }
+    else if (memStressState == MemStressState::FAILED)  { stateStr = r.error.c_str(); stateCol = YELLOW_ALERT; }
+    DrawTextRun(stateStr, x + PAD, y + 18, 14, stateCol);
+    if (running) {
+        snprintf(buf, sizeof(buf), "%.0f%%", memStressProgress * 100.f);
+        DrawTextRun(buf, x + w - MeasureTextRun(buf, 14) - PAD, y + 18, 14, AMBER_PHOSPHOR);
+        int bw = w - PAD * 2;
+        DrawRectangleLines(x + PAD, y + 36, bw, 6, DIM_GREEN);
+        DrawRectangle(x + PAD + 1, y + 37, (int)((bw - 2) * memStressProgress), 4, AMBER_PHOSPHOR);
+    }
+
+    snprintf(buf, sizeof(buf), "FOOTPRINT %d%% (%llu MB)  PAGES %s  NUMA %s  %ds", cfg.footprintPct,
+             GetTotalRAM_MB() * cfg.footprintPct / 100, MEM_HUGEPAGE_NAMES[(int)cfg.hugePages],
+             cfg.numaLocal ? "LOCAL" : "OFF", cfg.durationSec);
+    DrawTextRun(buf, x + PAD, y + 48, 12, DIM_GREEN);
+    DrawTextRun(running ? "ENTER: stop" : "ENTER: start  F: footprint  P: pages  N: numa",
+             x + PAD, y + 64, 12, DIM_GREEN);
+    DrawLine(x + PAD, y + 82, x + w - PAD, y + 82, DIM_GREEN);
+
+    int cy = y + 90;
+    if (r.threads == 0) return;
+    snprintf(buf, sizeof(buf), "%llu MB  %s (%llu MB huge)  %d THREADS  %d NODE%s",
+             (unsigned long long)r.footprintMB, r.pageMode, (unsigned long long)r.hugeMB,
+             r.threads, r.numaNodes, r.numaNodes > 1 ? "S" : "");
+    DrawTextRun(buf, x + PAD, cy, 12, DIM_GREEN); cy += 20;
+
+    struct { const char* name; float best, last; } rows[] = {
+        { "READ ", r.readGBps,  r.lastReadGBps  },
+        { "WRITE", r.writeGBps, r.lastWriteGBps },
+        { "COPY ", r.copyGBps,  r.lastCopyGBps  },
+    };
+    for (const auto& row : rows) {
+        snprintf(buf, sizeof(buf), "%s %6.1f GB/s   last %.1f", row.name, row.best, row.last);
+        DrawTextRun(buf, x + PAD, cy, 15, GREEN_PHOSPHOR); cy += 20;
+    }
+    snprintf(buf, sizeof(buf), "PASSES %d   ERRORS %llu", r.passes, (unsigned long long)r.errors);
+    DrawTextRun(buf, x + PAD, cy, 14, r.errors > 0 ? RED : GREEN_PHOSPHOR); cy += 24;
+
+    // Latency curve: log2(size) across, ns up; the knees are the cache levels
+    int gx = x + PAD, gy = cy + 14, gw = w - PAD * 2, gh = y + h - PAD - 14 - gy;
+    if (gh < 40 || r.latency.empty()) return;
+    DrawTextRun("LATENCY  ns per dependent load", gx, cy, 12, DIM_GREEN);
+    DrawRectangleLines(gx, gy, gw, gh, DIM_GREEN);
+    float peak = 1.f;
+    for (const auto& p : r.latency) peak = std::max(peak, p.ns);
+    const int points = 19;   // 4 KB .. 1 GB
+    int prevX = -1, prevY = 0;
+    for (int i = 0; i < (int)r.latency.size(); i++) {
+        int px = gx + 4 + (gw - 8) * i / (points - 1);
+        int py = gy + gh - 2 - (int)((gh - 4) * (r.latency[i].ns / peak));
+        if (prevX >= 0) DrawLine(prevX, prevY, px, py, GREEN_PHOSPHOR);
+        DrawRectangle(px - 1, py - 1, 3, 3, GREEN_PHOSPHOR);
+        prevX = px; prevY = py;
+        uint64_t kb = r.latency[i].bytes / 1024;
+        if (i % 3 == 0) {
+            if (kb >= 1024) snprintf(buf, sizeof(buf), "%lluM", (unsigned long long)(kb / 1024));
+            else            snprintf(buf, sizeof(buf), "%lluK", (unsigned long long)kb);
+            DrawTextRun(buf, px - MeasureTextRun(buf, 11) / 2, gy + gh + 2, 11, DIM_GREEN);
+        }
+    }
+    snprintf(buf, sizeof(buf), "%.0f ns", peak);
+    DrawTextRun(buf, gx + 4, gy + 3, 11, DIM_GREEN);
+    snprintf(buf, sizeof(buf), "L1 %.1f ns", r.latency.front().ns);
+    DrawTextRun(buf, gx + gw - MeasureTextRun(buf, 11) - 4, gy + 3, 11, DIM_GREEN);
+}
+
+// Low -> high latency as green -> amber -> red, so topology reads at a glance
+static Color HeatColor(float t) {
+    auto mix = [](Color a, Color b, float f) {
+        return Color{ (unsigned char)(a.r + (b.r - a.r) * f), (unsigned char)(a.g + (b.g - a.g) * f),
+                      (unsigned char)(a.b + (b.b - a.b) * f), 255 };
+    };
+    t = t < 0.f ? 0.f : t > 1.f ? 1.f : t;
+    return t < 0.5f ? mix(GREEN_PHOSPHOR, AMBER_PHOSPHOR, t * 2.f)
+                    : mix(AMBER_PHOSPHOR, RED, (t - 0.5f) * 2.f);
+}
+
+static void DrawCoreLatency(int x, int y, int w, int h) {
+    const int PAD = 12;
+    CoreLatencyMatrix mx = GetCoreLatencyMatrix();
+    bool running = coreLatencyState == StressTestState::RUNNING;
+    int n = (int)mx.cpus.size();
+    char buf[128];
+
+    if (running)
+        snprintf(buf, sizeof(buf), "MEASURING  %d / %d PAIRS", mx.pairsDone, mx.pairsTotal);
+    else if (coreLatencyState == StressTestState::DONE)
+        snprintf(buf, sizeof(buf), "COMPLETE  %d PAIRS IN %.1fs", mx.pairsDone, mx.seconds);
+    else
+        snprintf(buf, sizeof(buf), "IDLE - PRESS ENTER TO START");
+    DrawTextRun(buf, x + PAD, y + 18, 14, running ? AMBER_PHOSPHOR : coreLatencyState == StressTestState::DONE
+                                                  ? GREEN_PHOSPHOR : DIM_GREEN);
+    DrawTextRun(running ? "ENTER: stop" : "ENTER: start  (pauses while F5 stress runs)", x + PAD, y + 36, 12, DIM_GREEN);
+    if (n < 2) {
+        if (coreLatencyState == StressTestState::DONE) DrawTextRun("Needs at least two CPUs", x + PAD, y + 58, 13, DIM_GREEN);
+        return;
+    }
+
+    std::vector<float> vals;
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            if (mx.ns[(size_t)i * n + j] > 0.f) vals.push_back(mx.ns[(size_t)i * n + j]);
+    float lo = 0.f, hi = 1.f, med = 0.f;
+    if (!vals.empty()) {
+        std::sort(vals.begin(), vals.end());
+        lo = vals.front(); hi = std::max(vals.back(), lo + 1.f); med = vals[vals.size() / 2];
+        snprintf(buf, sizeof(buf), "ONE-WAY ns   min %.0f   median %.0f   max %.0f", lo, med, vals.back());
+        DrawTextRun(buf, x + PAD, y + 54, 13, GREEN_PHOSPHOR);
+    }
+
+    // The matrix is rasterised into an n x n texture and scaled up, so even
+    // 256 CPUs cost one quad per frame instead of 65k rectangles
+    static Texture2D tex = {};
+    static std::vector<Color> pixels;
+    static int texN = 0, texDone = -1;
+    if (texN != n) {
+        if (tex.id > 0) UnloadTexture(tex);
+        pixels.assign((size_t)n * n, COLOR_BLACK);
+        Image img = { pixels.data(), n, n, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
+        tex = LoadTextureFromImage(img);
+        SetTextureFilter(tex, TEXTURE_FILTER_POINT);
+        texN = n; texDone = -1;
+    }
+    if (texDone != mx.pairsDone) {
+        for (int i = 0; i < n; i++)
+            for (int j = 0; j < n; j++) {
+                float v = mx.ns[(size_t)i * n + j];
+                pixels[(size_t)i * n + j] = i == j ? DIM_GREEN : v > 0.f ? HeatColor((v - lo) / (hi - lo))
+                                                                         : Color{ 20, 20, 20, 255 };
+            }
+        UpdateTexture(tex, pixels.data());
+        texDone = mx.pairsDone;
+    }
+
+    int top = y + 76, legendW = 56;
+    int side = std::min(w - PAD * 2 - legendW, y + h - PAD - 14 - top);
+    if (side < n) return;
+    side -= side % n;                        // whole pixels per cell
+    int gx = x + PAD + 22, gy = top;
+    DrawTexturePro(tex, { 0, 0, (float)n, (float)n }, { (float)gx, (float)gy, (float)side, (float)side },
+                   { 0, 0 }, 0.f, WHITE);
+    DrawRectangleLines(gx - 1, gy - 1, side + 2, side + 2, DIM_GREEN);
+
+    // CPU labels, spaced so they never overlap
+    int step = 1;
+    while (side * step / n < 18) step *= 2;
+    for (int i = 0; i < n; i += step) {
+        snprintf(buf, sizeof(buf), "%d", mx.cpus[i]);
+        int c = side * i / n;
+        DrawTextRun(buf, gx - MeasureTextRun(buf, 10) - 3, gy + c, 10, DIM_GREEN);
+        DrawTextRun(buf, gx + c, gy + side + 3, 10, DIM_GREEN);
+    }
+
+    // Legend
+    int lx = gx + side + 16, lh = side;
+    for (int k = 0; k < lh; k++)
+        DrawLine(lx, gy + k, lx + 10, gy + k, HeatColor(1.f - (float)k / lh));
+    snprintf(buf, sizeof(buf), "%.0f", hi);
+    DrawTextRun(buf, lx + 14, gy, 10, DIM_GREEN);
+    snprintf(buf, sizeof(buf), "%.0f", lo);
+    DrawTextRun(buf, lx + 14, gy + lh - 10, 10, DIM_GREEN);
+}
+
+static void DrawDiskBench(int x, int y, int w, int h) {
+    const int PAD = 12;
+    const DiskBenchConfig& cfg = diskBenchConfig;
+    DiskBenchResult r = GetDiskBenchResult();
+    bool active = diskBenchState == DiskBenchState::PREPARING || diskBenchState == DiskBenchState::RUNNING;
+    char buf[160];
+
+    switch (diskBenchState) {
+        case DiskBenchState::PREPARING: snprintf(buf, sizeof(buf), "WRITING TEST FILE  %.0f%%", r.progress * 100.f); break;
+        case DiskBenchState::RUNNING:   snprintf(buf, sizeof(buf), "RUNNING  %.0f%%", r.progress * 100.f); break;
+        case DiskBenchState::DONE:      snprintf(buf, sizeof(buf), "COMPLETE  %llu I/Os", (unsigned long long)r.ios); break;
+        case DiskBenchState::FAILED:    snprintf(buf, sizeof(buf), "%s", r.error.c_str()); break;
+        default:                        snprintf(buf, sizeof(buf), "IDLE - PRESS ENTER TO START"); break;
+    }
+    Color stateCol = active ? AMBER_PHOSPHOR : diskBenchState == DiskBenchState::DONE ? GREEN_PHOSPHOR
+                   : diskBenchState == DiskBenchState::FAILED ? YELLOW_ALERT : DIM_GREEN;
+    DrawTextRun(buf, x + PAD, y + 18, 14, stateCol);
+
+    snprintf(buf, sizeof(buf), "%s  %s  %dK  QD %d  %d MB  %ds",
+             cfg.mountPoint.empty() ? "(first drive)" : cfg.mountPoint.c_str(),
+             DISK_PATTERN_NAMES[(int)cfg.pattern], cfg.blockKB, cfg.queueDepth, cfg.fileMB, cfg.durationSec);
+    DrawTextRun(buf, x + PAD, y + 38, 12, DIM_GREEN);
+    DrawTextRun(active ? "ENTER: stop" : "ENTER: start  D: drive  M: pattern  B: block  Q: depth",
+             x + PAD, y + 54, 12, DIM_GREEN);
+    DrawLine(x + PAD, y + 72, x + w - PAD, y + 72, DIM_GREEN);
+    if (r.engine.empty()) return;
+
+    int cy = y + 80;
+    bool shrunk = r.fileMB > 0 && r.fileMB < cfg.fileMB;
+    int len = snprintf(buf, sizeof(buf), "%s  %s  %s%s", r.engine.c_str(), r.direct ? "O_DIRECT" : "BUFFERED",
+                       r.device.empty() ? "" : "dev ", r.device.c_str());
+    if (shrunk && len > 0 && len < (int)sizeof(buf))
+        snprintf(buf + len, sizeof(buf) - len, "  FILE %d MB (LOW SPACE)", r.fileMB);
+    DrawTextRun(buf, x + PAD, cy, 12, r.direct && !shrunk ? DIM_GREEN : YELLOW_ALERT); cy += 18;
+
+    bool done = diskBenchState == DiskBenchState::DONE;
+    snprintf(buf, sizeof(buf), "IOPS %8.0f   %7.1f MB/s%s", done ? r.avgIops : r.iops, done ? r.avgMBps : r.mbps,
+             done ? "  (run avg)" : "");
+    DrawTextRun(buf, x + PAD, cy, 16, GREEN_PHOSPHOR); cy += 22;
+    snprintf(buf, sizeof(buf), "LAT  p50 %.0f us   p99 %.0f us   max %.0f us", r.p50Us, r.p99Us, r.maxUs);
+    DrawTextRun(buf, x + PAD, cy, 14, GREEN_PHOSPHOR); cy += 20;
+    if (r.devValid) {
+        // Block-layer view of the same interval: merges and readahead show up
+        // as fewer, larger device requests for the same MB/s
+        snprintf(buf, sizeof(buf), "DISKSTATS  IOPS %.0f   %.1f MB/s   await %.2f ms", r.devIops, r.devMBps, r.devAwaitMs);
+        DrawTextRun(buf, x + PAD, cy, 13, CYAN_HIGHLIGHT);
+    } else {
+        DrawTextRun("DISKSTATS  no block device behind this mount", x + PAD, cy, 13, DIM_GREEN);
+    }
+    cy += 24;
+
+    // Latency histogram over the occupied bucket range
+    int first = -1, last = -1;
+    uint64_t peak = 1;
+    for (int i = 0; i < (int)r.latHist.size(); i++) {
+        if (r.latHist[i] == 0) continue;
+        if (first < 0) first = i;
+        last = i;
+        peak = std::max(peak, r.latHist[i]);
+    }
+    int gx = x + PAD, gy = cy, gw = w - PAD * 2, gh = y + h - PAD - 14 - gy;
+    if (first < 0 || gh < 30) return;
+    DrawRectangleLines(gx, gy, gw, gh, DIM_GREEN);
+    int n = last - first + 1;
+    int slot = std::max(1, (gw - 4) / n);
+    for (int i = 0; i < n && 2 + i * slot < gw; i++) {
+        int bh = (int)((gh - 16) * ((float)r.latHist[first + i] / peak));
+        DrawRectangle(gx + 2 + i * slot, gy + gh - 2 - bh, std::max(1, slot - 1), bh, GREEN_PHOSPHOR);
+    }
+    auto usLabel = [&](int bucket, char* out, int sz) {
+        float us = powf(2.f, bucket / 4.f);
+        if (us >= 1000.f) snprintf(out, sz, "%.1f ms", us / 1000.f);
+        else              snprintf(out, sz, "%.0f us", us);
+    };
+    usLabel(first, buf, sizeof(buf));
+    DrawTextRun(buf, gx, gy + gh + 2, 11, DIM_GREEN);
+    usLabel(last + 1, buf, sizeof(buf));
+    DrawTextRun(buf, gx + gw - MeasureTextRun(buf, 11), gy + gh + 2, 11, DIM_GREEN);
+    DrawTextRun("LATENCY HISTOGRAM", gx + 4, gy + 3, 11, DIM_GREEN);
+}
+
+void DrawBenchmarks() {
+    const int PAD = 10;
+    const int HDR = 55;
+    const int BOT = 30;
+    const int RX  = 640 + PAD * 3;
+    const int RW  = layout.width - RX - PAD;
+    const int CT  = HDR + PAD * 2;
+    const int CH  = layout.height - BOT - PAD * 2 - CT;
+
+    DrawPanel(RX, CT, RW, CH, BENCH_PAGE_NAMES[benchPage]);
+    char pages[32];
+    snprintf(pages, sizeof(pages), "< %d/%d >", benchPage + 1, (int)BENCH_COUNT);
+    int pw = MeasureTextRun(pages, 12);
+    DrawRectangle(RX + RW - pw - 18, CT - 8, pw + 8, 16, COLOR_BLACK);
+    DrawTextRun(pages, RX + RW - pw - 14, CT - 6, 12, DIM_GREEN);
+
+    switch (benchPage) {
+        case BENCH_MEMORY:       DrawMemoryBench(RX, CT, RW, CH); break;
+        case BENCH_CORE_LATENCY: DrawCoreLatency(RX, CT, RW, CH); break;
+        case BENCH_DISK:         DrawDiskBench(RX, CT, RW, CH); break;
+        default: break;
+    }
+}
+
+static void FormatMB(char* buf, size_t sz, uint64_t bytes) {
+    double mb = bytes / (1024.0 * 1024.0);
+    if (mb >= 10240.0) snprintf(buf, sz, "%.1fG", mb / 1024.0);
+    else               snprintf(buf, sz, "%.0fM", mb);
+}
+
+// ── Memory detail view ────────────────────────────────────────────────────────
+static void DrawMemoryBreakdown(int RX, int CT, int RW) {
+    const int X = RX + 12;
+    MemInfo m = ReadMemInfo();
+    if (!m.valid) {
+        DrawTextRun("/proc/meminfo not available on this platform", X, CT + 18, 14, DIM_GREEN);
+        return;
+    }
+    const uint64_t* kb = m.kb;
+    char buf[128], a[16], b[16];
+    uint64_t total = kb[MI_MEM_TOTAL];
+
+    // Headline: the same "used" the RAM bar shows
+    FormatMB(a, sizeof(a), m.UsedKB() * 1024);
+    FormatMB(b, sizeof(b), total * 1024);
+    snprintf(buf, sizeof(buf), "USED %s / %s  (%.1f%%)   = MemTotal - MemAvailable", a, b,
+             m.UsedKB() * 100.0 / total);
+    DrawTextRun(buf, X, CT + 18, 14, GREEN_PHOSPHOR);
+
+    // Composition bar: anon / kernel / buffers+cache / free
+    int bx = X, by = CT + 40, bw = RW - 24, bh = 14;
+    uint64_t cache   = kb[MI_BUFFERS] + kb[MI_CACHED];
+    uint64_t kernel  = kb[MI_SLAB] + kb[MI_KERNEL_STACK] + kb[MI_PAGE_TABLES];
+    uint64_t freeKB  = kb[MI_MEM_FREE];
+    uint64_t other   = total > cache + kernel + freeKB ? total - cache - kernel - freeKB : 0;
+    struct { uint64_t v; Color c; const char* name; } segs[] = {
+        { other,  GREEN_PHOSPHOR, "APPS" }, { kernel, AMBER_PHOSPHOR, "KERNEL" },
+        { cache,  DIM_GREEN,      "CACHE" }, { freeKB, COLOR_BLACK,   "FREE" },
+    };
+    DrawRectangleLines(bx - 1, by - 1, bw + 2, bh + 2, DIM_GREEN);
+    int sx = bx, lx = bx;
+    for (const auto& sg : segs) {
+        int sw = (int)((double)sg.v / total * bw);
+        DrawRectangle(sx, by, sw, bh, sg.c);
+        sx += sw;
+        snprintf(buf, sizeof(buf), "%s %.0f%%", sg.name, sg.v * 100.0 / total);
+        DrawTextRun(buf, lx, by + bh + 4, 11, sg.c.r + sg.c.g + sg.c.b == 0 ? DIM_GREEN : sg.c);
+        lx += MeasureTextRun(buf, 11) + 16;
+    }
+
+    // Two columns of label / value rows
+    struct Row { const char* label; uint64_t kb; };
+    const Row left[] = {
+        { "MemFree",      kb[MI_MEM_FREE] },      { "MemAvailable", kb[MI_MEM_AVAILABLE] },
+        { "Buffers",      kb[MI_BUFFERS] },       { "Cached",       kb[MI_CACHED] },
+        { "Shmem",        kb[MI_SHMEM] },         { "AnonPages",    kb[MI_ANON_PAGES] },
+        { "Mapped",       kb[MI_MAPPED] },        { "Active(file)", kb[MI_ACTIVE_FILE] },
+        { "Inact(file)",  kb[MI_INACTIVE_FILE] }, { "Unevictable",  kb[MI_UNEVICTABLE] },
+    };
+    const Row right[] = {
+        { "Slab",         kb[MI_SLAB] },          { " reclaimable", kb[MI_SRECLAIMABLE] },
+        { " unreclaim",   kb[MI_SUNRECLAIM] },    { "KernelStack",  kb[MI_KERNEL_STACK] },
+        { "PageTables",   kb[MI_PAGE_TABLES] },   { "VmallocUsed",  kb[MI_VMALLOC_USED] },
+        { "Dirty",        kb[MI_DIRTY] },         { "Writeback",    kb[MI_WRITEBACK] },
+        { "AnonHuge",     kb[MI_ANON_HUGE_PAGES] }, { "Committed",  kb[MI_COMMITTED_AS] },
+    };
+    int ry = by + bh + 24, half = (RW - 24) / 2;
+    DrawLine(X, ry - 4, RX + RW - 12, ry - 4, DIM_GREEN);
+    for (int i = 0; i < 10; i++) {
+        FormatMB(a, sizeof(a), left[i].kb * 1024);
+        DrawTextRun(left[i].label, X, ry + i * 16, 12, DIM_GREEN);
+        DrawTextRun(a, X + 120, ry + i * 16, 12, GREEN_PHOSPHOR);
+        FormatMB(a, sizeof(a), right[i].kb * 1024);
+        DrawTextRun(right[i].label, X + half, ry + i * 16, 12, DIM_GREEN);
+        // Dirty + writeback piling up means the disks can't keep up with writers
+        bool warn = (i == 6 || i == 7) && right[i].kb * 20 > total;
+        DrawTextRun(a, X + half + 120, ry + i * 16, 12, warn ? YELLOW_ALERT : GREEN_PHOSPHOR);
+    }
+    ry += 10 * 16 + 8;
+
+    // Swap and hugepages
+    DrawLine(X, ry - 4, RX + RW - 12, ry - 4, DIM_GREEN);
+    uint64_t swapUsed = kb[MI_SWAP_TOTAL] > kb[MI_SWAP_FREE] ? kb[MI_SWAP_TOTAL] - kb[MI_SWAP_FREE] : 0;
+    if (kb[MI_SWAP_TOTAL] > 0) {
+        FormatMB(a, sizeof(a), swapUsed * 1024);
+        FormatMB(b, sizeof(b), kb[MI_SWAP_TOTAL] * 1024);
+        snprintf(buf, sizeof(buf), "SWAP %s / %s   cached %lluM", a, b,
+                 (unsigned long long)(kb[MI_SWAP_CACHED] / 1024));
+    } else {
+        snprintf(buf, sizeof(buf), "SWAP none");
+    }
+    DrawTextRun(buf, X, ry, 12, GREEN_PHOSPHOR);
+    if (kb[MI_HUGEPAGES_TOTAL] > 0) {
+        snprintf(buf, sizeof(buf), "HUGEPAGES %llu x %lluK   free %llu  rsvd %llu  surp %llu",
+                 (unsigned long long)kb[MI_HUGEPAGES_TOTAL], (unsigned long long)kb[MI_HUGEPAGE_SIZE],
+                 (unsigned long long)kb[MI_HUGEPAGES_FREE], (unsigned long long)kb[MI_HUGEPAGES_RSVD],
+                 (unsigned long long)kb[MI_HUGEPAGES_SURP]);
+    } else {
+        snprintf(buf, sizeof(buf), "HUGEPAGES none reserved (%lluK pages)", (unsigned long long)kb[MI_HUGEPAGE_SIZE]);
+    }
+    DrawTextRun(buf, X + half, ry, 12, GREEN_PHOSPHOR);
+    ry += 24;
+
+    // Rates from /proc/vmstat
+    DrawLine(X, ry - 4, RX + RW - 12, ry - 4, DIM_GREEN);
+    DrawTextRun("ACTIVITY  per second", X, ry, 12, AMBER_PHOSPHOR);
+    ry += 18;
+    snprintf(buf, sizeof(buf), "page faults %8.0f   major %6.0f", m.faultsPerSec, m.majFaultsPerSec);
+    DrawTextRun(buf, X, ry, 14, m.majFaultsPerSec > 100.f ? YELLOW_ALERT : GREEN_PHOSPHOR);
+    ry += 20;
+    snprintf(buf, sizeof(buf), "swap in %6.0f pg   out %6.0f pg", m.swapInPerSec, m.swapOutPerSec);
+    DrawTextRun(buf, X, ry, 14, m.swapOutPerSec > 0.f ? YELLOW_ALERT : GREEN_PHOSPHOR);
+    ry += 20;
+    snprintf(buf, sizeof(buf), "page in %7.0f KB   out %7.0f KB   reclaim scan %6.0f pg",
+             m.pageInKBps, m.pageOutKBps, m.scanPerSec);
+    DrawTextRun(buf, X, ry, 14, m.scanPerSec > 0.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR);
+    ry += 20;
+    if (m.vm[VM_OOM_KILL] > 0) {
+        snprintf(buf, sizeof(buf), "OOM KILLS since boot: %llu", (unsigned long long)m.vm[VM_OOM_KILL]);
+        DrawTextRun(buf, X, ry, 14, RED);
+    }
+}
+
+// Sparkline of a node's remote-allocation share, scaled to its own peak
+static void DrawRemoteHistory(int x, int y, int w, int h, const std::vector<float>& hist) {
+    DrawRectangleLines(x, y, w, h, DIM_GREEN);
+    if (hist.size() < 2) return;
+    float peak = 5.f;
+    for (float v : hist) peak = std::max(peak, v);
+    float step = (float)(w - 2) / (NUMA_HISTORY - 1);
+    float x0 = x + 1 + (NUMA_HISTORY - (int)hist.size()) * step;
+    for (size_t i = 1; i < hist.size(); i++) {
+        Vector2 a = { x0 + (i - 1) * step, y + h - 1 - hist[i - 1] / peak * (h - 2) };
+        Vector2 b = { x0 + i * step,       y + h - 1 - hist[i]     / peak * (h - 2) };
+        DrawLineV(a, b, AMBER_PHOSPHOR);
+    }
+    char buf[16]; snprintf(buf, sizeof(buf), "%.0f%%", peak);
+    DrawTextRun(buf, x + w - MeasureTextRun(buf, 10) - 3, y + 2, 10, DIM_GREEN);
+}
+
+static void DrawNumaNodes(int RX, int CT, int RW, int CH) {
+    const int X = RX + 12;
+    NumaStats ns = ReadNumaStats();
+    if (!ns.valid) {
+        DrawTextRun("No NUMA node information on this platform", X, CT + 18, 14, DIM_GREEN);
+        return;
+    }
+    int n = (int)ns.nodes.size();
+    char buf[160], a[16], b[16];
+    snprintf(buf, sizeof(buf), "%d NODE%s", n, n == 1 ? "" : "S");
+    DrawTextRun(buf, X, CT + 18, 14, GREEN_PHOSPHOR);
+    // SLIT distances: 10 = local, ~20 = one socket hop
+    if (n > 1 && n <= 8) {
+        std::string d = "DISTANCE";
+        for (int i = 0; i < n; i++) {
+            d += (i == 0 ? "  N" : " | N") + std::to_string(ns.nodes[i].id) + ":";
+            for (int j = 0; j < n; j++) d += (j ? " " : "") + std::to_string(ns.distance[(size_t)i * n + j]);
+        }
+        DrawTextRun(d.c_str(), X + 100, CT + 20, 12, DIM_GREEN);
+    }
+    DrawLine(X, CT + 40, RX + RW - 12, CT + 40, DIM_GREEN);
+
+    const int BH = 84, barW = 220;
+    int y = CT + 48, shown = 0;
+    for (const NumaNode& nd : ns.nodes) {
+        if (y + BH > CT + CH - 24) break;
+        std::string cpus = FormatCpuList(nd.cpus);
+        if (cpus.size() > 40) cpus = cpus.substr(0, 37) + "...";
+        snprintf(buf, sizeof(buf), "NODE %d   cpus %s", nd.id, cpus.empty() ? "(memory only)" : cpus.c_str());
+        DrawTextRun(buf, X, y, 14, AMBER_PHOSPHOR);
+
+        // CPU and memory bars
+        int bx = X + 40, by = y + 20;
+        DrawTextRun("CPU", X, by, 12, DIM_GREEN);
+        DrawRectangleLines(bx, by, barW, 10, DIM_GREEN);
+        DrawRectangle(bx + 1, by + 1, (int)((barW - 2) * std::min(nd.cpuPct, 100.f) / 100.f), 8,
+                      nd.cpuPct > 90.f ? YELLOW_ALERT : GREEN_PHOSPHOR);
+        snprintf(buf, sizeof(buf), "%.0f%%", nd.cpuPct);
+        DrawTextRun(buf, bx + barW + 8, by, 12, GREEN_PHOSPHOR);
+
+        by += 16;
+        uint64_t used = nd.memTotalKB > nd.memFreeKB ? nd.memTotalKB - nd.memFreeKB : 0;
+        float usedPct = nd.memTotalKB ? used * 100.f / nd.memTotalKB : 0.f;
+        float filePct = nd.memTotalKB ? std::min<uint64_t>(nd.filePagesKB, used) * 100.f / nd.memTotalKB : 0.f;
+        DrawTextRun("MEM", X, by, 12, DIM_GREEN);
+        DrawRectangleLines(bx, by, barW, 10, DIM_GREEN);
+        // Page cache drawn dim on the right end of the used span: it can be reclaimed
+        int usedW = (int)((barW - 2) * usedPct / 100.f), fileW = (int)((barW - 2) * filePct / 100.f);
+        DrawRectangle(bx + 1, by + 1, usedW - fileW, 8, usedPct > 90.f ? YELLOW_ALERT : GREEN_PHOSPHOR);
+        DrawRectangle(bx + 1 + usedW - fileW, by + 1, fileW, 8, DIM_GREEN);
+        FormatMB(a, sizeof(a), used * 1024);
+        FormatMB(b, sizeof(b), nd.memTotalKB * 1024);
+        snprintf(buf, sizeof(buf), "%s / %s  file %lluM", a, b, (unsigned long long)(nd.filePagesKB / 1024));
+        DrawTextRun(buf, bx + barW + 8, by, 12, GREEN_PHOSPHOR);
+
+        // Allocation locality. A remote share well above the node's own
+        // recent average is the early warning: a process migrated off its
+        // memory, or a node filled up and allocations spill over.
+        float avg = 0.f;
+        for (float v : nd.remoteHistory) avg += v;
+        if (!nd.remoteHistory.empty()) avg /= nd.remoteHistory.size();
+        bool growing = nd.remoteHistory.size() >= 10 && nd.remotePct > 5.f && nd.remotePct > avg * 2.f;
+        by += 18;
+        snprintf(buf, sizeof(buf), "local %.0f/s  remote %.0f/s  (%.1f%% remote)%s", nd.localPerSec, nd.otherPerSec,
+                 nd.remotePct, growing ? "  GROWING" : "");
+        DrawTextRun(buf, X, by, 12, growing ? YELLOW_ALERT : nd.remotePct > 10.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR);
+        by += 14;
+        snprintf(buf, sizeof(buf), "hit %.0f/s  miss %.0f/s  foreign %.0f/s", nd.hitPerSec, nd.missPerSec,
+                 nd.foreignPerSec);
+        DrawTextRun(buf, X, by, 12, nd.missPerSec > 0.f ? AMBER_PHOSPHOR : DIM_GREEN);
+        DrawRemoteHistory(RX + RW - 12 - 150, y + 34, 150, 40, nd.remoteHistory);
+
+        y += BH;
+        shown++;
+    }
+    if (shown < n) {
+        snprintf(buf, sizeof(buf), "+%d more nodes", n - shown);
+        DrawTextRun(buf, X, y, 12, DIM_GREEN);
+    }
+}
+
+void DrawMemoryDetail() {
+    const int PAD = 10;
+    const int HDR = 55;
+    const int BOT = 30;
+    const int RX  = 640 + PAD * 3;
+    const int RW  = layout.width - RX - PAD;
+    const int CT  = HDR + PAD * 2;
+    const int CH  = layout.height - BOT - PAD * 2 - CT;
+
+    DrawPanel(RX, CT, RW, CH, MEM_PAGE_NAMES[memPage]);
+    char pages[32];
+    snprintf(pages, sizeof(pages), "< %d/%d >", memPage + 1, (int)MEM_PAGE_COUNT);
+    int pw = MeasureTextRun(pages, 12);
+    DrawRectangle(RX + RW - pw - 18, CT - 8, pw + 8, 16, COLOR_BLACK);
+    DrawTextRun(pages, RX + RW - pw - 14, CT - 6, 12, DIM_GREEN);
+
+    switch (memPage) {
+        case MEM_PAGE_BREAKDOWN: DrawMemoryBreakdown(RX, CT, RW); break;
+        case MEM_PAGE_NUMA:      DrawNumaNodes(RX, CT, RW, CH); break;
+        default: break;
+    }
+    DrawTextRun("LEFT/RIGHT  page   ESC  return to dashboard", RX + 12, CT + CH - 20, 12, DIM_GREEN);
+}
+
+// ── cgroups view ──────────────────────────────────────────────────────────────
+
+void DrawCgroups() {
+    const int PAD = 10;
+    const int HDR = 55;
+    const int BOT = 30;
+    const int RX  = 640 + PAD * 3;
+    const int RW  = layout.width - RX - PAD;
+    const int CT  = HDR + PAD * 2;
+    const int CH  = layout.height - BOT - PAD * 2 - CT;
+    const int X   = RX + 12;
+
+    DrawPanel(RX, CT, RW, CH, "CGROUPS");
+    CgroupTree t = GetCgroupTree();
+    CgroupLimits l = GetCgroupLimits();
+    char buf[160], a[16], b[16];
+
+    if (!l.valid) {
+        DrawTextRun("cgroup v2 not mounted", X, CT + 18, 14, DIM_GREEN);
+        return;
+    }
+    snprintf(buf, sizeof(buf), "v2 at %s   %d groups   %d listed   %.1f ms", t.mount.c_str(), t.groups,
+             t.listed, t.sampleMs);
+    DrawTextRun(buf, X, CT + 18, 14, t.available ? GREEN_PHOSPHOR : DIM_GREEN);
+
+    // Our own limits: these are what the CPU / RAM rows report against
+    if (l.cpuCores > 0.f) snprintf(a, sizeof(a), "%.2f cores", l.cpuCores);
+    else                  snprintf(a, sizeof(a), "unlimited");
+    if (l.memMax > 0)     FormatMB(b, sizeof(b), l.memMax);
+    else                  snprintf(b, sizeof(b), "unlimited");
+    snprintf(buf, sizeof(buf), "THIS PROCESS  %s   cpu.max %s   memory.max %s", l.path.c_str(), a, b);
+    DrawTextRun(buf, X, CT + 38, 12, l.cpuCores > 0.f || l.memMax > 0 ? AMBER_PHOSPHOR : DIM_GREEN);
+    snprintf(buf, sizeof(buf), "S: sort (%s)   UP/DOWN: scroll   ESC: back", CGROUP_SORT_NAMES[(int)cgroupSort.load()]);
+    DrawTextRun(buf, X, CT + 54, 12, DIM_GREEN);
+    DrawLine(X, CT + 72, RX + RW - 12, CT + 72, DIM_GREEN);
+
+    const int cPath = X, cCpu = X + 290, cMem = X + 350, cLim = X + 410, cIo = X + 470;
+    int y = CT + 80;
+    DrawTextRun("CGROUP", cPath, y, 12, DIM_GREEN);
+    DrawTextRun("CPU%",   cCpu,  y, 12, DIM_GREEN);
+    DrawTextRun("MEM",    cMem,  y, 12, DIM_GREEN);
+    DrawTextRun("LIMIT",  cLim,  y, 12, DIM_GREEN);
+    DrawTextRun("IO R/W KB/s", cIo, y, 12, DIM_GREEN);
+    y += 18;
+
+    int rows = (CT + CH - 10 - y) / 16;
+    int maxScroll = std::max(0, (int)t.top.size() - rows);
+    cgroupScroll = std::min(std::max(cgroupScroll, 0), maxScroll);
+    for (int i = cgroupScroll; i < (int)t.top.size() && i < cgroupScroll + rows; i++, y += 16) {
+        const CgroupEntry& e = t.top[i];
+        // Long paths keep their tail: the leaf (service / container id) is what identifies them
+        std::string path = e.path;
+        while (path.size() > 4 && MeasureTextRun(path.c_str(), 12) > cCpu - cPath - 10)
+            path = "..." + path.substr(4);
+        bool hot = e.cpuCores > 0.f && e.cpuPct >= e.cpuCores * 90.f;
+        DrawTextRun(path.c_str(), cPath, y, 12, GREEN_PHOSPHOR);
+        snprintf(buf, sizeof(buf), "%.1f", e.cpuPct);
+        DrawTextRun(buf, cCpu, y, 12, hot ? YELLOW_ALERT : GREEN_PHOSPHOR);
+        if (e.hasMem) {
+            FormatMB(a, sizeof(a), e.memBytes);
+            bool full = e.memMax > 0 && e.memBytes >= e.memMax / 10 * 9;
+            DrawTextRun(a, cMem, y, 12, full ? YELLOW_ALERT : GREEN_PHOSPHOR);
+        } else {
+            DrawTextRun("-", cMem, y, 12, DIM_GREEN);
+        }
+        // Limit column: cores and/or memory, whichever is set on this group
+        a[0] = b[0] = 0;
+        if (e.cpuCores > 0.f) snprintf(a, sizeof(a), "%.1fc", e.cpuCores);
+        if (e.memMax > 0)     FormatMB(b, sizeof(b), e.memMax);
+        snprintf(buf, sizeof(buf), "%s%s%s", a, a[0] && b[0] ? " " : "", b[0] || a[0] ? b : "-");
+        DrawTextRun(buf, cLim, y, 12, DIM_GREEN);
+        snprintf(buf, sizeof(buf), "%.0f / %.0f", e.ioReadKBps, e.ioWriteKBps);
+        DrawTextRun(buf, cIo, y, 12, GREEN_PHOSPHOR);
+    }
+}
+
+// ── Disk usage explorer (opened from a storage row of System Information) ───
+static void DrawDiskUsage(int X0, int CT, int W, int CH) {
+    DuView v = GetDuView();
+    const int X = X0 + 14;
+    char title[160], buf[200], a[16], b[16];
+    snprintf(title, sizeof(title), "DISK USAGE  %s", v.root.c_str());
+    DrawPanel(X0, CT, W, CH, title);
+
+    if (duScanState == DuScanState::FAILED) {
+        DrawTextRun(v.error.c_str(), X, CT + 20, 14, YELLOW_ALERT);
+        DrawTextRun("ESC  back", X, CT + CH - 22, 12, DIM_GREEN);
+        return;
+    }
+    const char* st = duScanState == DuScanState::RUNNING   ? "SCANNING" :
+                     duScanState == DuScanState::CANCELLED ? "CANCELLED" : "DONE";
+    FormatMB(a, sizeof(a), v.bytes);
+    float rate = v.seconds > 0.f ? v.files / v.seconds : 0.f;
+    snprintf(buf, sizeof(buf), "%s  %.1fs   %llu files  %llu dirs  %s   %.0f files/s   %d threads, %s",
+             st, v.seconds, (unsigned long long)v.files, (unsigned long long)v.dirs, a, rate, v.threads,
+             v.engine.c_str());
+    DrawTextRun(buf, X, CT + 18, 14, duScanState == DuScanState::RUNNING ? AMBER_PHOSPHOR : GREEN_PHOSPHOR);
+    if (v.otherFs || v.errors) {
+        snprintf(buf, sizeof(buf), "%llu mount points not entered   %llu unreadable",
+                 (unsigned long long)v.otherFs, (unsigned long long)v.errors);
+        DrawTextRun(buf, X, CT + 36, 12, v.errors ? YELLOW_ALERT : DIM_GREEN);
+    }
+
+    FormatMB(a, sizeof(a), v.focus.bytes);
+    FormatMB(b, sizeof(b), v.focusOwnBytes);
+    snprintf(buf, sizeof(buf), "%s   %s   (%s in files here)", v.path.c_str(), a, b);
+    DrawTextRun(buf, X, CT + 56, 14, CYAN_HIGHLIGHT);
+    DrawTextRun("UP/DOWN  select   ENTER  open   BACKSPACE  up   X  cancel scan   ESC  back",
+             X, CT + CH - 22, 12, DIM_GREEN);
+    DrawLine(X, CT + 76, X0 + W - 14, CT + 76, DIM_GREEN);
+
+    const int cBar = X + 14, cSize = X + 230, cPct = X + 320, cFiles = X + 380, cName = X + 480;
+    int y = CT + 84;
+    DrawTextRun("SIZE",  cSize,  y, 12, DIM_GREEN);
+    DrawTextRun("%",     cPct,   y, 12, DIM_GREEN);
+    DrawTextRun("FILES", cFiles, y, 12, DIM_GREEN);
+    DrawTextRun("DIRECTORY", cName, y, 12, DIM_GREEN);
+    y += 18;
+
+    // Selection scrolls the list; rows still growing are drawn dim with a "+"
+    int rows = (CT + CH - 30 - y) / 18;
+    duSelected = v.children.empty() ? 0 : std::min(std::max(duSelected, 0), (int)v.children.size() - 1);
+    int first = std::max(0, duSelected - rows + 1);
+    for (int i = first; i < (int)v.children.size() && i < first + rows; i++, y += 18) {
+        const DuEntry& e = v.children[i];
+        float pct = v.focus.bytes ? (float)e.bytes * 100.f / (float)v.focus.bytes : 0.f;
+        Color col = e.done ? GREEN_PHOSPHOR : DIM_GREEN;
+        if (i == duSelected) {
+            DrawRectangle(X - 4, y - 2, W - 20, 17, {38, 38, 38, 255});
+            col = e.done ? CYAN_HIGHLIGHT : col;
+        }
+        int bw = cSize - cBar - 16;
+        DrawRectangleLines(cBar, y + 2, bw, 10, DIM_GREEN);
+        int fill = (int)(bw * pct / 100.f);
+        if (fill > 2) DrawRectangle(cBar + 1, y + 3, fill - 2, 8, col);
+        FormatMB(a, sizeof(a), e.bytes);
+        snprintf(buf, sizeof(buf), "%s%s", a, e.done ? "" : "+");
+        DrawTextRun(buf, cSize, y, 14, col);
+        snprintf(buf, sizeof(buf), "%.1f", pct);
+        DrawTextRun(buf, cPct, y, 14, col);
+        snprintf(buf, sizeof(buf), "%llu", (unsigned long long)e.files);
+        DrawTextRun(buf, cFiles, y, 14, col);
+        std::string name = e.name + "/";
+        while (name.size() > 4 && MeasureTextRun(name.c_str(), 14) > X0 + W - 20 - cName)
+            name = name.substr(0, name.size() - 4) + "..";
+        DrawTextRun(name.c_str(), cName, y, 14, col);
+    }
+    if (v.children.empty())
+        DrawTextRun(duScanState == DuScanState::RUNNING ? "listing..." : "no subdirectories", cName, y, 14, DIM_GREEN);
+}
+
 // ── System Information view ───────────────────────────────────────────────────
+// CPU / GPU model names: split across two lines at a space near the middle
+// when one line is too wide
+static void RecordWrappedName(RetainedWidget& w, const std::string& name, int x, int& y, int maxW, int fs, int lh) {
+    if (MeasureTextRun(name.c_str(), fs) > maxW) {
+        size_t sp = name.rfind(' ', name.size() / 2 + 10);
+        if (sp != std::string::npos) {
+            char first[256];
+            snprintf(first, sizeof(first), "%.*s", (int)sp, name.c_str());
+            w.Text(first, x, y, fs, GREEN_PHOSPHOR); y += lh;
+            w.Text(name.c_str() + sp + 1, x, y, fs, GREEN_PHOSPHOR); y += lh;
+            return;
+        }
+    }
+    w.Text(name.c_str(), x, y, fs, GREEN_PHOSPHOR); y += lh;
+}
+
 void DrawSystemInfo() {
     const int PAD  = 10;
     const int HDR  = 55;
     const int BOT  = 30;
     const int CT   = HDR + PAD * 2;
-    const int CB   = WINDOW_HEIGHT - BOT - PAD;
+    const int CB   = layout.height - BOT - PAD;
     const int CH   = CB - CT;
-    const int HALF = (WINDOW_WIDTH - PAD * 3) / 2;
+    const int HALF = (layout.width - PAD * 3) / 2;
     const int LX   = PAD;
     const int RX   = LX + HALF + PAD;
     const int LH   = 20;   // line height
     const int FS   = 15;   // font size body
     const int FS_H = 13;   // font size sub-header
 
+    if (showDiskUsage) {
+        DrawDiskUsage(LX, CT, layout.width - PAD * 2, CH);
+        return;
+    }
+
     // ── Left panel: Processor & Memory ───────────────────────────────────────
-    DrawPanel(LX, CT, HALF, CH, "PROCESSOR & MEMORY");
-    int y = CT + 20;
-
-    // CPU
-    DrawText("PROCESSOR", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
-    DrawLine(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
-
-    if (s_hwReady.load() && !s_hwInfo.cpuName.empty()) {
-        // Word-wrap the CPU name across two lines if needed
-        std::string cn = s_hwInfo.cpuName;
-        if ((int)MeasureText(cn.c_str(), FS) > HALF - 28) {
-            // Split at last space before midpoint
-            size_t mid = cn.size() / 2;
-            size_t sp  = cn.rfind(' ', mid + 10);
-            if (sp != std::string::npos) {
-                DrawText(cn.substr(0, sp).c_str(), LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-                DrawText(cn.substr(sp + 1).c_str(), LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-            } else {
-                DrawText(cn.c_str(), LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-            }
+    // Rebuilt on a new sample (memory figures are read then) or when the
+    // uptime's seconds tick; otherwise replayed
+    bool hwReady = s_hwReady.load();
+    unsigned long long up = GetSystemUptimeSeconds();
+    static RetainedWidget left;
+    if (left.Begin(WidgetKey() << hwReady << stats.useRealData << (int)(stats.cpu * 10.f) << StatsSampleCount()
+                               << stats.computerName << stats.processCount << up)) {
+        left.Panel(LX, CT, HALF, CH, "PROCESSOR & MEMORY");
+        int y = CT + 20;
+
+        // CPU
+        left.Text("PROCESSOR", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
+        left.Line(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
+
+        if (hwReady && !s_hwInfo.cpuName.empty())
+            RecordWrappedName(left, s_hwInfo.cpuName, LX + 14, y, HALF - 28, FS, LH);
+        else {
+            left.Text(hwReady ? "Unknown" : "Detecting...", LX + 14, y, FS, DIM_GREEN); y += LH;
+        }
+
+        // Live CPU usage
+        if (stats.useRealData) {
+            Color cpuCol = stats.cpu > 90.f ? YELLOW_ALERT : stats.cpu > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+            left.TextF(LX + 14, y, FS, cpuCol, "Usage: %.1f%%", stats.cpu);
         } else {
-            DrawText(cn.c_str(), LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
+            left.Text("Usage: -- (enable real monitoring)", LX + 14, y, FS, DIM_GREEN);
         }
-    } else {
-        DrawText(s_hwReady.load() ? "Unknown" : "Detecting...", LX + 14, y, FS, DIM_GREEN); y += LH;
-    }
+        y += LH + 8;
 
-    // Live CPU usage
-    if (stats.useRealData) {
-        char cpuBuf[48];
-        snprintf(cpuBuf, sizeof(cpuBuf), "Usage: %.1f%%", stats.cpu);
-        Color cpuCol = stats.cpu > 90.f ? YELLOW_ALERT : stats.cpu > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-        DrawText(cpuBuf, LX + 14, y, FS, cpuCol);
-    } else {
-        DrawText("Usage: -- (enable real monitoring)", LX + 14, y, FS, DIM_GREEN);
-    }
-    y += LH + 8;
+        // RAM
+        left.Text("MEMORY", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
+        left.Line(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
 
-    // RAM
-    DrawText("MEMORY", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
-    DrawLine(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
+        unsigned long long totalRam = GetTotalRAM_MB();
+        unsigned long long usedRam  = GetUsedRAM_MB();
+        left.TextF(LX + 14, y, FS, GREEN_PHOSPHOR, "Installed: %llu MB (%.1f GB)", totalRam, totalRam / 1024.f); y += LH;
 
-    unsigned long long totalRam = GetTotalRAM_MB();
-    unsigned long long usedRam  = GetUsedRAM_MB();
-    char ramTotal[32], ramUsed[32];
-    snprintf(ramTotal, sizeof(ramTotal), "Installed: %llu MB (%.1f GB)", totalRam, totalRam / 1024.f);
-    DrawText(ramTotal, LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
+        if (stats.useRealData) {
+            float ramPct = totalRam > 0 ? (usedRam * 100.f / totalRam) : 0.f;
+            Color ramCol = ramPct > 90.f ? YELLOW_ALERT : ramPct > 75.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+            left.TextF(LX + 14, y, FS, ramCol, "In use:    %llu MB", usedRam); y += LH;
+            // Mini bar
+            int bw = HALF - 28;
+            left.Rect(LX + 14, y, bw, 10, COLOR_BLACK);
+            left.RectLines(LX + 14, y, bw, 10, DIM_GREEN);
+            int fill = (int)(bw * ramPct / 100.f);
+            if (fill > 2) left.Rect(LX + 15, y + 1, fill - 2, 8, ramCol);
+            y += 16;
+        } else {
+            left.Text("In use:    -- (enable real monitoring)", LX + 14, y, FS, DIM_GREEN); y += LH;
+        }
+        y += 8;
 
-    if (stats.useRealData) {
-        snprintf(ramUsed, sizeof(ramUsed), "In use:    %llu MB", usedRam);
-        float ramPct = totalRam > 0 ? (usedRam * 100.f / totalRam) : 0.f;
-        Color ramCol = ramPct > 90.f ? YELLOW_ALERT : ramPct > 75.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-        DrawText(ramUsed, LX + 14, y, FS, ramCol); y += LH;
-        // Mini bar
-        int bw = HALF - 28;
-        DrawRectangle(LX + 14, y, bw, 10, COLOR_BLACK);
-        DrawRectangleLines(LX + 14, y, bw, 10, DIM_GREEN);
-        int fill = (int)(bw * ramPct / 100.f);
-        if (fill > 2) DrawRectangle(LX + 15, y + 1, fill - 2, 8, ramCol);
-        y += 16;
-    } else {
-        DrawText("In use:    -- (enable real monitoring)", LX + 14, y, FS, DIM_GREEN); y += LH;
-    }
-    y += 8;
+        // OS / System
+        left.Text("SYSTEM", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
+        left.Line(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
 
-    // OS / System
-    DrawText("SYSTEM", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
-    DrawLine(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
+        left.TextF(LX + 14, y, FS, GREEN_PHOSPHOR, "Hostname:  %s",
+                   stats.computerName[0] ? stats.computerName : "Unknown"); y += LH;
 
-    char hostBuf[80];
-    snprintf(hostBuf, sizeof(hostBuf), "Hostname:  %s",
-             stats.computerName[0] ? stats.computerName : "Unknown");
-    DrawText(hostBuf, LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
+        // OS version from HardwareInfo (fetched via wmic on background thread)
+        if (hwReady && !s_hwInfo.osVersion.empty()) {
+            left.TextF(LX + 14, y, FS, GREEN_PHOSPHOR, "Windows:   %s", s_hwInfo.osVersion.c_str()); y += LH;
+        }
 
-    // OS version from HardwareInfo (fetched via wmic on background thread)
-    if (s_hwReady.load() && !s_hwInfo.osVersion.empty()) {
-        std::string osLine = "Windows:   " + s_hwInfo.osVersion;
-        DrawText(osLine.c_str(), LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-    }
+        // Uptime
+        left.TextF(LX + 14, y, FS, GREEN_PHOSPHOR, "Uptime:    %llud %02lluh %02llum %02llus",
+                   up/86400, (up%86400)/3600, (up%3600)/60, up%60); y += LH;
 
-    // Uptime
-    unsigned long long up = GetSystemUptimeSeconds();
-    char upBuf[64];
-    snprintf(upBuf, sizeof(upBuf), "Uptime:    %llud %02lluh %02llum %02llus",
-             up/86400, (up%86400)/3600, (up%3600)/60, up%60);
-    DrawText(upBuf, LX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
+        // Process count
+        if (stats.useRealData)
+            left.TextF(LX + 14, y, FS, GREEN_PHOSPHOR, "Processes: %d running", stats.processCount);
+        else
+            left.Text("Processes: -- (enable real monitoring)", LX + 14, y, FS, DIM_GREEN);
+        y += LH + 8;
+
+        // Collector costs, as far as the panel has room: cadence, then the
+        // average and worst run; over budget in yellow
+        left.Text("COLLECTORS", LX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
+        left.Line(LX + 14, y, LX + HALF - 14, y, DIM_GREEN); y += 6;
+        for (const CollectorInfo& c : GetCollectorInfo()) {
+            if (y + LH > CB - 16) break;
+            left.TextF(LX + 14, y, FS, c.overBudget > 0 ? YELLOW_ALERT : GREEN_PHOSPHOR,
+                       "%-9s %6d ms   avg %6.2f  max %6.2f ms", c.name.c_str(), c.cadenceMs, c.avgMs, c.maxMs);
+            y += LH;
+        }
 
-    // Process count
-    if (stats.useRealData) {
-        char procBuf[40];
-        snprintf(procBuf, sizeof(procBuf), "Processes: %d running", stats.processCount);
-        DrawText(procBuf, LX + 14, y, FS, GREEN_PHOSPHOR);
-    } else {
-        DrawText("Processes: -- (enable real monitoring)", LX + 14, y, FS, DIM_GREEN);
+        // Bottom hint
+        left.Text("UP/DOWN  select drive   ENTER  disk usage   ESC  return to dashboard", LX + 14, CB - 2, 12, DIM_GREEN);
     }
+    left.Draw();
 
     // ── Right panel: GPU & Storage ────────────────────────────────────────────
-    DrawPanel(RX, CT, HALF, CH, "GPU & STORAGE");
-    y = CT + 20;
-
-    // GPU
-    DrawText("GRAPHICS", RX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
-    DrawLine(RX + 14, y, RX + HALF - 14, y, DIM_GREEN); y += 6;
-
-    if (s_hwReady.load() && !s_hwInfo.gpuName.empty()) {
-        std::string gn = s_hwInfo.gpuName;
-        if ((int)MeasureText(gn.c_str(), FS) > HALF - 28) {
-            size_t mid = gn.size() / 2;
-            size_t sp  = gn.rfind(' ', mid + 10);
-            if (sp != std::string::npos) {
-                DrawText(gn.substr(0, sp).c_str(), RX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-                DrawText(gn.substr(sp + 1).c_str(), RX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-            } else {
-                DrawText(gn.c_str(), RX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
-            }
-        } else {
-            DrawText(gn.c_str(), RX + 14, y, FS, GREEN_PHOSPHOR); y += LH;
+    RefreshDrives();
+    const std::vector<DiskInfo>& siDrives = s_drives;
+    if (!siDrives.empty()) siDriveSel = std::min(std::max(siDriveSel, 0), (int)siDrives.size() - 1);
+
+    static RetainedWidget right;
+    if (right.Begin(WidgetKey() << hwReady << s_drivesGen << siDriveSel)) {
+        right.Panel(RX, CT, HALF, CH, "GPU & STORAGE");
+        int y = CT + 20;
+
+        // GPU
+        right.Text("GRAPHICS", RX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
+        right.Line(RX + 14, y, RX + HALF - 14, y, DIM_GREEN); y += 6;
+
+        if (hwReady && !s_hwInfo.gpuName.empty())
+            RecordWrappedName(right, s_hwInfo.gpuName, RX + 14, y, HALF - 28, FS, LH);
+        else {
+            right.Text(hwReady ? "Unknown" : "Detecting...", RX + 14, y, FS, DIM_GREEN); y += LH;
         }
-    } else {
-        DrawText(s_hwReady.load() ? "Unknown" : "Detecting...", RX + 14, y, FS, DIM_GREEN); y += LH;
-    }
-
-    if (s_hwReady.load() && !s_hwInfo.gpuDriverVersion.empty()) {
-        std::string drv = "Driver:    " + s_hwInfo.gpuDriverVersion;
-        DrawText(drv.c_str(), RX + 14, y, FS, DIM_GREEN); y += LH;
-    }
-    y += 8;
-
-    // Storage
-    DrawText("STORAGE", RX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
-    DrawLine(RX + 14, y, RX + HALF - 14, y, DIM_GREEN); y += 6;
-
-    static std::vector<DiskInfo> siDrives;
-    static float siDriveTimer = 5.f;
-    siDriveTimer += GetFrameTime();
-    if (siDriveTimer >= 5.f) { siDrives = GetAllDrives(); siDriveTimer = 0.f; }
-
-    for (const auto& drv : siDrives) {
-        if (y + LH * 2 + 16 > CB) break;
-        char drvBuf[64];
-        snprintf(drvBuf, sizeof(drvBuf), "%c:  %llu / %llu GB",
-                 drv.letter, drv.usedGB, drv.totalGB);
-        Color dCol = drv.usedPct > 90.f ? YELLOW_ALERT :
-                     drv.usedPct > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
-        DrawText(drvBuf, RX + 14, y, FS, dCol); y += LH;
-        // Bar
-        int bw = HALF - 28;
-        DrawRectangle(RX + 14, y, bw, 8, COLOR_BLACK);
-        DrawRectangleLines(RX + 14, y, bw, 8, DIM_GREEN);
-        int fill = (int)(bw * drv.usedPct / 100.f);
-        if (fill > 2) DrawRectangle(RX + 15, y + 1, fill - 2, 6, dCol);
-        y += 14;
-    }
-    y += 8;
-
-    // Bottom hint
-    DrawText("ESC  return to dashboard", LX + 14, CB - 2, 12, DIM_GREEN);
+
+        if (hwReady && !s_hwInfo.gpuDriverVersion.empty()) {
+            right.TextF(RX + 14, y, FS, DIM_GREEN, "Driver:    %s", s_hwInfo.gpuDriverVersion.c_str()); y += LH;
+        }
+        y += 8;
+
+        // Storage
+        right.Text("STORAGE", RX + 14, y, FS_H, AMBER_PHOSPHOR); y += LH;
+        right.Line(RX + 14, y, RX + HALF - 14, y, DIM_GREEN); y += 6;
+
+        for (size_t i = 0; i < siDrives.size(); i++) {
+            const DiskInfo& drv = siDrives[i];
+            if (y + LH * 2 + 16 > CB) break;
+            Color dCol = drv.usedPct > 90.f ? YELLOW_ALERT :
+                         drv.usedPct > 70.f ? AMBER_PHOSPHOR : GREEN_PHOSPHOR;
+            if ((int)i == siDriveSel) right.Text(">", RX + 4, y, FS, CYAN_HIGHLIGHT);
+            right.TextF(RX + 14, y, FS, dCol, "%c:  %llu / %llu GB   %s",
+                        drv.letter, drv.usedGB, drv.totalGB, drv.mountPoint.c_str()); y += LH;
+            // Bar
+            int bw = HALF - 28;
+            right.Rect(RX + 14, y, bw, 8, COLOR_BLACK);
+            right.RectLines(RX + 14, y, bw, 8, DIM_GREEN);
+            int fill = (int)(bw * drv.usedPct / 100.f);
+            if (fill > 2) right.Rect(RX + 15, y + 1, fill - 2, 6, dCol);
+            y += 14;
+        }
+    }
+    right.Draw();
 }
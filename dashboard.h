@@ -15,6 +15,9 @@ enum MenuOption {
     MENU_REAL_MONITORING,
     MENU_NETWORK_TEST,
     MENU_SYSTEM_INFO,
+    MENU_MEMORY,
+    MENU_BENCHMARKS,
+    MENU_CGROUPS,
     MENU_CUSTOMIZE_WIDGETS,
     MENU_COLOR_THEMES,
     MENU_TERMINAL,
@@ -26,11 +29,40 @@ inline const char* MENU_OPTIONS[] = {
     "REAL-TIME MONITORING",
     "NETWORK DIAGNOSTICS",
     "SYSTEM INFORMATION",
+    "MEMORY & NUMA",
+    "BENCHMARKS",
+    "CGROUPS",
     "CUSTOMIZE WIDGETS",
     "COLOR THEMES",
     "TERMINAL"
 };
 
+// ── Benchmark pages (LEFT/RIGHT in the benchmarks view) ──────────────────────
+enum BenchPage {
+    BENCH_MEMORY = 0,
+    BENCH_CORE_LATENCY,
+    BENCH_DISK,
+    BENCH_COUNT
+};
+
+inline const char* BENCH_PAGE_NAMES[] = {
+    "MEMORY BENCHMARK",
+    "CORE-TO-CORE LATENCY",
+    "DISK I/O BENCHMARK"
+};
+
+// ── Memory view pages (LEFT/RIGHT in the memory view) ────────────────────────
+enum MemPage {
+    MEM_PAGE_BREAKDOWN = 0,
+    MEM_PAGE_NUMA,
+    MEM_PAGE_COUNT
+};
+
+inline const char* MEM_PAGE_NAMES[] = {
+    "MEMORY DETAIL",
+    "NUMA NODES"
+};
+
 // ── Widget system ─────────────────────────────────────────────────────────────
 struct DashboardWidgets {
     bool showCPU         = true;
@@ -43,6 +75,7 @@ struct DashboardWidgets {
     bool showProcesses   = true;
     bool showUptime      = true;
     bool showComputerName= true;
+    bool showPSI         = true;
 };
 
 enum WidgetOption {
@@ -56,13 +89,14 @@ enum WidgetOption {
     WIDGET_PROCESSES,
     WIDGET_UPTIME,
     WIDGET_COMPUTERNAME,
+    WIDGET_PSI,
     WIDGET_COUNT
 };
 
 inline const char* WIDGET_NAMES[] = {
     "CPU Monitor", "RAM Monitor", "Disk Monitor", "Network Stats",
     "Anomaly Detector", "System Log", "System Time",
-    "Process Count", "System Uptime", "Computer Name"
+    "Process Count", "System Uptime", "Computer Name", "Pressure (PSI)"
 };
 
 // ── System stats ──────────────────────────────────────────────────────────────
@@ -86,16 +120,8 @@ struct AnomalyState {
     float       netBaseline = -1.f;
 };
 
-// ── Log entry ─────────────────────────────────────────────────────────────────
-struct LogEntry {
-    std::string message;
-    double      time;
-    Color       color;
-};
-
 // ── Globals (defined in dashboard.cpp) ───────────────────────────────────────
 extern SystemStats      stats;
-extern std::vector<LogEntry> logEntries;
 extern float            timeAccumulator;
 extern Font             retroFont;
 extern bool             hasCustomFont;
@@ -108,12 +134,34 @@ extern bool             showWidgetMenu;
 extern int              selectedWidget;
 extern bool             isFirstRun;
 extern AnomalyState     anomaly;
+extern bool             showSpeedHistory;
+extern bool             showCapture;     // dashboard: last adaptive capture instead of the history
+extern int              benchPage;
+extern int              cgroupScroll;
+extern int              memPage;
+extern bool             showDiskUsage;   // System Information: du explorer open
+extern int              siDriveSel;      // System Information: selected storage row
+extern int              duSelected;      // du explorer: selected child row
+extern int              logMinLevel;     // System Log panel: lowest EventLevel shown
+extern int              logSourceFilter; // System Log panel: source id shown, 0 = all
 
 // ── Functions ─────────────────────────────────────────────────────────────────
 void GetWidgetStates(bool* states[WIDGET_COUNT]);
 void AddLogEntry(const std::string& message, Color entryColor);
 void InitializeStats();
-void UpdateStats(float deltaTime);
+bool UpdateStats(float deltaTime);   // true when something visible changed
+double StatsNextSampleTime();        // GetTime() of the next metrics sample, an estimate
+unsigned long long StatsSampleCount();   // bumped whenever UpdateStats takes in new readings
+// Registers the metric collectors (cadence_<name>_ms in dashboard.cfg) and
+// starts the scheduler; after LoadConfig. Trigger: real data was just
+// switched on, read it now rather than at the next turn.
+void StartStatsCollectors();
+void TriggerStatsCollectors();
+bool DashboardAnimating();           // something moves between samples
+// Metric history graphs: UpdateStats pushes a sample each second; the
+// GPU buffers must go before CloseWindow
+void PushMetricHistory(float cpu, float ram, float netDownKBps);
+void UnloadMetricHistory();
 void GenerateRandomLog();
 void DrawProgressBar(int x, int y, int w, int h, float pct, Color col);
 void DrawPanel(int x, int y, int w, int h, const char* title);
@@ -121,4 +169,7 @@ void DrawDashboard();
 void DrawMenu();
 void DrawNetworkDiagnostics();
 void DrawSystemInfo();
+void DrawBenchmarks();
+void DrawCgroups();
+void DrawMemoryDetail();
 void HandleMenuSelection();
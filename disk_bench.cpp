@@ -0,0 +1,560 @@
+// disk_bench.cpp - storage benchmark: io_uring + O_DIRECT, pread/pwrite pool fallback
+// Pure logic, NO raylib/drawing includes (results are drawn in dashboard.cpp)
+#include "disk_bench.h"
+#include "system_monitor.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/stat.h>
+  #include <sys/statvfs.h>
+  #include <sys/mman.h>
+  #include <sys/types.h>
+  #if defined(__linux__)
+    #include <sys/syscall.h>
+    #include <sys/sysmacros.h>
+    #include <sys/uio.h>
+    #include <linux/io_uring.h>
+    #if defined(__NR_io_uring_setup)
+      #define DISK_HAVE_URING 1
+    #endif
+  #endif
+#endif
+
+DiskBenchState  diskBenchState = DiskBenchState::IDLE;
+DiskBenchConfig diskBenchConfig;
+
+static std::atomic<bool> s_stop{false};
+static std::atomic<bool> s_busy{false};   // coordinator thread alive
+static std::mutex        s_mutex;
+static DiskBenchResult   s_result;
+
+// Hot counters, bumped once per completed I/O
+static std::atomic<uint64_t> s_ios{0};
+static std::atomic<uint64_t> s_bytes{0};
+static std::atomic<uint64_t> s_maxNs{0};
+static std::atomic<uint64_t> s_hist[DISK_LAT_BUCKETS];
+
+static const int PUBLISH_MS = 250;
+
+// ── Latency accounting ────────────────────────────────────────────────────────
+static int LatBucket(uint64_t ns) {
+    double us = ns / 1000.0;
+    if (us < 1.0) return 0;
+    int b = (int)(4.0 * std::log2(us));
+    return std::min(b, DISK_LAT_BUCKETS - 1);
+}
+
+static void RecordIo(uint64_t ns, uint32_t bytes) {
+    s_ios.fetch_add(1, std::memory_order_relaxed);
+    s_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    s_hist[LatBucket(ns)].fetch_add(1, std::memory_order_relaxed);
+    uint64_t prev = s_maxNs.load(std::memory_order_relaxed);
+    while (ns > prev && !s_maxNs.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {}
+}
+
+// Upper edge of the bucket holding the q-th quantile
+static float Percentile(const std::vector<uint64_t>& hist, double q) {
+    uint64_t total = 0;
+    for (uint64_t c : hist) total += c;
+    if (total == 0) return 0.f;
+    uint64_t rank = (uint64_t)(q * (total - 1)), seen = 0;
+    for (int i = 0; i < (int)hist.size(); i++) {
+        seen += hist[i];
+        if (seen > rank) return std::pow(2.f, (i + 1) / 4.f);
+    }
+    return std::pow(2.f, DISK_LAT_BUCKETS / 4.f);
+}
+
+static void Fail(const std::string& why) {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.error = why;
+    }
+    diskBenchState = DiskBenchState::FAILED;
+}
+
+#if !defined(_WIN32)
+// ── /proc/diskstats ───────────────────────────────────────────────────────────
+struct DiskStatsSample {
+    bool     valid = false;
+    uint64_t reads = 0, sectorsRead = 0, msRead = 0;
+    uint64_t writes = 0, sectorsWritten = 0, msWrite = 0;
+};
+
+static DiskStatsSample ReadDiskStats(unsigned maj, unsigned min, std::string* name) {
+    DiskStatsSample s;
+    FILE* f = fopen("/proc/diskstats", "r");
+    if (!f) return s;
+    char line[512], dev[64];
+    while (fgets(line, sizeof(line), f)) {
+        unsigned ma, mi;
+        unsigned long long r, rm, sr, msr, w, wm, sw, msw;
+        if (sscanf(line, "%u %u %63s %llu %llu %llu %llu %llu %llu %llu %llu",
+                   &ma, &mi, dev, &r, &rm, &sr, &msr, &w, &wm, &sw, &msw) != 11) continue;
+        if (ma != maj || mi != min) continue;
+        s.valid = true;
+        s.reads = r; s.sectorsRead = sr; s.msRead = msr;
+        s.writes = w; s.sectorsWritten = sw; s.msWrite = msw;
+        if (name) *name = dev;
+        break;
+    }
+    fclose(f);
+    return s;
+}
+
+// ── io_uring (raw syscalls, no liburing dependency) ───────────────────────────
+#if defined(DISK_HAVE_URING)
+struct Uring {
+    int            fd = -1;
+    unsigned*      sqHead = nullptr; unsigned* sqTail = nullptr; unsigned* sqMask = nullptr;
+    unsigned*      sqArray = nullptr;
+    unsigned*      cqHead = nullptr; unsigned* cqTail = nullptr; unsigned* cqMask = nullptr;
+    io_uring_sqe*  sqes = nullptr;
+    io_uring_cqe*  cqes = nullptr;
+    void*          sqRing = nullptr; size_t sqRingSize = 0;
+    void*          cqRing = nullptr; size_t cqRingSize = 0;
+    size_t         sqesSize = 0;
+};
+
+static bool UringInit(Uring& r, unsigned entries) {
+    io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    r.fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (r.fd < 0) return false;   // ENOSYS, or disabled by sysctl/seccomp
+    r.sqRingSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    r.cqRingSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+    bool single = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single) r.sqRingSize = r.cqRingSize = std::max(r.sqRingSize, r.cqRingSize);
+    r.sqRing = mmap(nullptr, r.sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                    r.fd, IORING_OFF_SQ_RING);
+    if (r.sqRing == MAP_FAILED) { close(r.fd); r.fd = -1; return false; }
+    r.cqRing = single ? r.sqRing
+                      : mmap(nullptr, r.cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                             r.fd, IORING_OFF_CQ_RING);
+    r.sqesSize = p.sq_entries * sizeof(io_uring_sqe);
+    r.sqes = (io_uring_sqe*)mmap(nullptr, r.sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                                 r.fd, IORING_OFF_SQES);
+    if (r.cqRing == MAP_FAILED || r.sqes == MAP_FAILED) {
+        munmap(r.sqRing, r.sqRingSize);
+        if (!single && r.cqRing != MAP_FAILED) munmap(r.cqRing, r.cqRingSize);
+        close(r.fd); r.fd = -1;
+        return false;
+    }
+    char* sq = (char*)r.sqRing;
+    char* cq = (char*)r.cqRing;
+    r.sqHead  = (unsigned*)(sq + p.sq_off.head);
+    r.sqTail  = (unsigned*)(sq + p.sq_off.tail);
+    r.sqMask  = (unsigned*)(sq + p.sq_off.ring_mask);
+    r.sqArray = (unsigned*)(sq + p.sq_off.array);
+    r.cqHead  = (unsigned*)(cq + p.cq_off.head);
+    r.cqTail  = (unsigned*)(cq + p.cq_off.tail);
+    r.cqMask  = (unsigned*)(cq + p.cq_off.ring_mask);
+    r.cqes    = (io_uring_cqe*)(cq + p.cq_off.cqes);
+    return true;
+}
+
+static void UringClose(Uring& r) {
+    if (r.fd < 0) return;
+    munmap(r.sqes, r.sqesSize);
+    if (r.cqRing != r.sqRing) munmap(r.cqRing, r.cqRingSize);
+    munmap(r.sqRing, r.sqRingSize);
+    close(r.fd);
+    r.fd = -1;
+}
+
+static int UringEnter(Uring& r, unsigned submit, unsigned minComplete) {
+    return (int)syscall(__NR_io_uring_enter, r.fd, submit, minComplete,
+                        minComplete ? IORING_ENTER_GETEVENTS : 0, nullptr, 0);
+}
+#endif
+
+// ── Run ───────────────────────────────────────────────────────────────────────
+struct BenchRun {
+    int         fd = -1;
+    bool        write = false, random = false;
+    uint64_t    blockBytes = 0, blocks = 0;
+    int         qd = 1;
+    char*       bufs = nullptr;        // qd aligned blocks, one per slot
+    std::chrono::steady_clock::time_point deadline;
+    std::atomic<uint64_t> cursor{0};   // sequential patterns
+};
+
+static uint64_t NextOffset(BenchRun& run, std::mt19937_64& rng) {
+    uint64_t block = run.random ? rng() % run.blocks
+                                : run.cursor.fetch_add(1, std::memory_order_relaxed) % run.blocks;
+    return block * run.blockBytes;
+}
+
+static uint64_t NowNs() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Publishes live numbers; called every PUBLISH_MS by whichever thread drives I/O
+struct Publisher {
+    unsigned          maj = 0, min = 0;
+    bool              devOk = false;
+    uint64_t          lastIos = 0, lastBytes = 0, lastNs = 0;
+    DiskStatsSample   lastDev;
+    uint64_t          startIos = 0, startBytes = 0, startNs = 0;
+    DiskStatsSample   startDev;
+
+    void Begin() {
+        startIos = lastIos = s_ios.load(); startBytes = lastBytes = s_bytes.load();
+        startNs = lastNs = NowNs();
+        if (devOk) startDev = lastDev = ReadDiskStats(maj, min, nullptr);
+    }
+
+    // whole = true: report over the entire run instead of the last interval
+    void Publish(float progress, bool whole) {
+        uint64_t ios = s_ios.load(), bytes = s_bytes.load(), now = NowNs();
+        uint64_t fromIos = whole ? startIos : lastIos, fromBytes = whole ? startBytes : lastBytes;
+        uint64_t fromNs = whole ? startNs : lastNs;
+        double sec = (now - fromNs) / 1e9;
+        std::vector<uint64_t> hist(DISK_LAT_BUCKETS);
+        for (int i = 0; i < DISK_LAT_BUCKETS; i++) hist[i] = s_hist[i].load(std::memory_order_relaxed);
+        DiskStatsSample dev;
+        if (devOk) dev = ReadDiskStats(maj, min, nullptr);
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            DiskBenchResult& r = s_result;
+            r.progress = progress;
+            if (sec > 0.0) {
+                r.iops = (float)((ios - fromIos) / sec);
+                r.mbps = (float)((bytes - fromBytes) / sec / (1024.0 * 1024.0));
+            }
+            double total = (now - startNs) / 1e9;
+            if (total > 0.0) {
+                r.avgIops = (float)((ios - startIos) / total);
+                r.avgMBps = (float)((bytes - startBytes) / total / (1024.0 * 1024.0));
+            }
+            r.ios     = ios - startIos;
+            r.p50Us   = Percentile(hist, 0.50);
+            r.p99Us   = Percentile(hist, 0.99);
+            r.maxUs   = s_maxNs.load() / 1000.f;
+            r.latHist = hist;
+            if (dev.valid && sec > 0.0) {
+                const DiskStatsSample& from = whole ? startDev : lastDev;
+                uint64_t dIos = (dev.reads - from.reads) + (dev.writes - from.writes);
+                uint64_t dSec = (dev.sectorsRead - from.sectorsRead) + (dev.sectorsWritten - from.sectorsWritten);
+                uint64_t dMs  = (dev.msRead - from.msRead) + (dev.msWrite - from.msWrite);
+                r.devValid   = true;
+                r.devIops    = (float)(dIos / sec);
+                r.devMBps    = (float)(dSec * 512.0 / sec / (1024.0 * 1024.0));
+                r.devAwaitMs = dIos > 0 ? (float)dMs / dIos : 0.f;
+            }
+        }
+        lastIos = ios; lastBytes = bytes; lastNs = now;
+        if (dev.valid) lastDev = dev;
+    }
+};
+
+static float RunProgress(const BenchRun& run, int durationSec) {
+    auto left = std::chrono::duration<float>(run.deadline - std::chrono::steady_clock::now()).count();
+    return std::min(1.f, std::max(0.f, 1.f - left / (float)durationSec));
+}
+
+#if defined(DISK_HAVE_URING)
+// Keeps qd I/Os in flight from one thread. Returns false if io_uring is
+// unavailable so the caller can fall back to the thread pool.
+static bool RunUring(BenchRun& run, Publisher& pub, int durationSec, std::string& engine, std::string& err) {
+    Uring ring;
+    if (!UringInit(ring, (unsigned)run.qd)) return false;
+
+    // Registered buffers skip per-I/O page pinning; plain READ/WRITE if refused
+    std::vector<iovec> iov(run.qd);
+    for (int i = 0; i < run.qd; i++) iov[i] = { run.bufs + (size_t)i * run.blockBytes, (size_t)run.blockBytes };
+    bool fixed = syscall(__NR_io_uring_register, ring.fd, IORING_REGISTER_BUFFERS, iov.data(), run.qd) == 0;
+    engine = fixed ? "io_uring (fixed bufs)" : "io_uring";
+    uint8_t op = run.write ? (fixed ? IORING_OP_WRITE_FIXED : IORING_OP_WRITE)
+                           : (fixed ? IORING_OP_READ_FIXED  : IORING_OP_READ);
+
+    std::mt19937_64 rng(0xD15C);
+    std::vector<uint64_t> started(run.qd);
+    auto queue = [&](int slot) {
+        unsigned tail = *ring.sqTail;
+        unsigned idx  = tail & *ring.sqMask;
+        io_uring_sqe* sqe = &ring.sqes[idx];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode    = op;
+        sqe->fd        = run.fd;
+        sqe->off       = NextOffset(run, rng);
+        sqe->addr      = (uint64_t)(uintptr_t)iov[slot].iov_base;
+        sqe->len       = (uint32_t)run.blockBytes;
+        sqe->buf_index = fixed ? (uint16_t)slot : 0;
+        sqe->user_data = (uint64_t)slot;
+        ring.sqArray[idx] = idx;
+        started[slot] = NowNs();
+        __atomic_store_n(ring.sqTail, tail + 1, __ATOMIC_RELEASE);
+    };
+
+    for (int i = 0; i < run.qd; i++) queue(i);
+    unsigned inflight = (unsigned)run.qd;
+    auto nextPublish = std::chrono::steady_clock::now() + std::chrono::milliseconds(PUBLISH_MS);
+    bool draining = false;
+    while (inflight > 0) {
+        // Everything between the kernel's head and our tail is still unsubmitted
+        // (an interrupted enter may have taken only part of it)
+        unsigned pending = *ring.sqTail - __atomic_load_n(ring.sqHead, __ATOMIC_ACQUIRE);
+        int rc = UringEnter(ring, pending, 1);
+        if (rc < 0 && errno != EINTR) { err = std::string("io_uring_enter: ") + strerror(errno); break; }
+        unsigned head = *ring.cqHead;
+        unsigned tail = __atomic_load_n(ring.cqTail, __ATOMIC_ACQUIRE);
+        uint64_t now = NowNs();
+        for (; head != tail; head++) {
+            const io_uring_cqe& cqe = ring.cqes[head & *ring.cqMask];
+            int slot = (int)cqe.user_data;
+            inflight--;
+            if (cqe.res < 0) {
+                if (err.empty()) err = strerror(-cqe.res);
+                draining = true;
+                continue;
+            }
+            RecordIo(now - started[slot], (uint32_t)cqe.res);
+            if (!draining) { queue(slot); inflight++; }
+        }
+        __atomic_store_n(ring.cqHead, head, __ATOMIC_RELEASE);
+
+        auto t = std::chrono::steady_clock::now();
+        if (t >= nextPublish) {
+            pub.Publish(RunProgress(run, durationSec), false);
+            nextPublish = t + std::chrono::milliseconds(PUBLISH_MS);
+        }
+        if (t >= run.deadline || s_stop.load()) draining = true;
+    }
+    UringClose(ring);
+    return true;
+}
+#endif
+
+// One synchronous I/O in flight per thread: queue depth = thread count
+static void PoolWorker(BenchRun* run, int slot, std::string* err, std::mutex* errMutex) {
+    std::mt19937_64 rng(0xD15C + slot);
+    char* buf = run->bufs + (size_t)slot * run->blockBytes;
+    while (!s_stop.load(std::memory_order_relaxed) && std::chrono::steady_clock::now() < run->deadline) {
+        uint64_t off = NextOffset(*run, rng);
+        uint64_t t0 = NowNs();
+        ssize_t n = run->write ? pwrite(run->fd, buf, run->blockBytes, (off_t)off)
+                               : pread(run->fd, buf, run->blockBytes, (off_t)off);
+        if (n < 0) {
+            std::lock_guard<std::mutex> lock(*errMutex);
+            if (err->empty()) *err = strerror(errno);
+            return;
+        }
+        RecordIo(NowNs() - t0, (uint32_t)n);
+    }
+}
+
+static int OpenDirect(const std::string& path, int flags, bool& direct) {
+    int fd = -1;
+#if defined(O_DIRECT)
+    fd = open(path.c_str(), flags | O_DIRECT, 0600);
+    if (fd >= 0) { direct = true; return fd; }
+    // tmpfs and some network/FUSE filesystems refuse O_DIRECT
+#endif
+    fd = open(path.c_str(), flags, 0600);
+    direct = false;
+#if defined(F_NOCACHE)
+    if (fd >= 0 && fcntl(fd, F_NOCACHE, 1) == 0) direct = true;   // macOS equivalent
+#endif
+    return fd;
+}
+
+// The test file never outlives the run: O_TMPFILE makes it nameless from the
+// start, and the named fallback is unlinked as soon as it is open. The root
+// of a mount is rarely writable for a normal user, so any writable directory
+// on the same filesystem will do.
+static int OpenBenchFile(const std::string& mount, bool& direct, std::string& path) {
+    struct stat ms;
+    if (stat(mount.c_str(), &ms) != 0) return -1;
+    std::vector<std::string> dirs = { mount };
+    for (const char* env : { "TMPDIR", "HOME" })
+        if (const char* v = getenv(env)) if (*v) dirs.push_back(v);
+    dirs.push_back("/var/tmp");
+    dirs.push_back("/tmp");
+    int err = ENOENT;
+    for (const std::string& dir : dirs) {
+        struct stat ds;
+        if (stat(dir.c_str(), &ds) != 0 || ds.st_dev != ms.st_dev || access(dir.c_str(), W_OK) != 0) continue;
+        int fd;
+#if defined(O_TMPFILE)
+        fd = OpenDirect(dir, O_RDWR | O_TMPFILE, direct);
+        if (fd >= 0) { path = dir + " (O_TMPFILE)"; return fd; }
+#endif
+        std::string name = dir + (dir.back() == '/' ? "" : "/") + ".retroforge_diskbench." +
+                           std::to_string((long)getpid()) + ".tmp";
+        fd = OpenDirect(name, O_RDWR | O_CREAT | O_EXCL, direct);
+        if (fd >= 0) { unlink(name.c_str()); path = name + " (unlinked)"; return fd; }
+        err = errno;
+    }
+    errno = err;
+    return -1;
+}
+
+static void DiskBenchCoordinator(DiskBenchConfig cfg) {
+    for (auto& h : s_hist) h = 0;
+    s_ios = 0; s_bytes = 0; s_maxNs = 0;
+
+    // Temp file on the chosen mount
+    std::string mount = cfg.mountPoint;
+    if (mount.empty()) {
+        std::vector<DiskInfo> drives = GetAllDrives();
+        mount = drives.empty() ? "/tmp" : drives[0].mountPoint;
+    }
+    std::string path;
+    bool direct = false;
+    int fd = OpenBenchFile(mount, direct, path);
+    if (fd < 0) {
+        Fail(errno == ENOENT ? "NO WRITABLE DIRECTORY ON " + mount
+                             : "CANNOT CREATE A FILE ON " + mount + ": " + strerror(errno));
+        s_busy = false;
+        return;
+    }
+
+    std::string devName;
+    Publisher pub;
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+#if defined(__linux__)
+        pub.maj = major(st.st_dev); pub.min = minor(st.st_dev);
+        pub.devOk = ReadDiskStats(pub.maj, pub.min, &devName).valid;   // btrfs/overlay: no match
+#endif
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.path   = path;
+        s_result.direct = direct;
+        s_result.device = devName;
+    }
+
+    BenchRun run;
+    run.fd         = fd;
+    run.write      = cfg.pattern == DiskPattern::SEQ_WRITE || cfg.pattern == DiskPattern::RAND_WRITE;
+    run.random     = cfg.pattern == DiskPattern::RAND_READ || cfg.pattern == DiskPattern::RAND_WRITE;
+    run.blockBytes = (uint64_t)std::max(4, cfg.blockKB) * 1024;
+    run.qd         = std::max(1, std::min(256, cfg.queueDepth));
+    uint64_t fileBytes = (uint64_t)std::max(16, cfg.fileMB) * 1024 * 1024;
+    // The prepare pass writes the whole file: shrink it rather than push a
+    // live filesystem towards ENOSPC. The larger of 10% or 1 GB stays free.
+    struct statvfs vs;
+    if (fstatvfs(fd, &vs) == 0) {
+        uint64_t avail   = (uint64_t)vs.f_bavail * vs.f_frsize;
+        uint64_t reserve = std::max<uint64_t>((uint64_t)vs.f_blocks * vs.f_frsize / 10, 1ULL << 30);
+        uint64_t room    = avail > reserve ? avail - reserve : 0;
+        fileBytes = std::min(fileBytes, room);
+    }
+    fileBytes -= fileBytes % run.blockBytes;
+    if (fileBytes < 16ULL * 1024 * 1024) {
+        close(fd);
+        Fail("NOT ENOUGH FREE SPACE ON " + mount);
+        s_busy = false;
+        return;
+    }
+    run.blocks = fileBytes / run.blockBytes;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.fileMB = (int)(fileBytes / (1024 * 1024));
+    }
+
+    // O_DIRECT needs sector-aligned buffers; page alignment covers every device
+    const size_t PREP_CHUNK = 1024 * 1024;
+    size_t bufBytes = std::max((size_t)run.blockBytes * run.qd, PREP_CHUNK);
+    run.bufs = (char*)mmap(nullptr, bufBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (run.bufs == MAP_FAILED) { close(fd); Fail("BUFFER ALLOCATION FAILED"); s_busy = false; return; }
+    std::mt19937_64 fill(42);
+    for (size_t i = 0; i + 8 <= bufBytes; i += 8) {   // incompressible, so no controller shortcuts
+        uint64_t v = fill();
+        memcpy(run.bufs + i, &v, 8);
+    }
+
+    // Lay the file out with real data: reads of unwritten extents never reach
+    // the device, and first writes to them measure allocation, not the disk
+    diskBenchState = DiskBenchState::PREPARING;
+    std::string err;
+    for (uint64_t off = 0; off < fileBytes && !s_stop.load(); off += PREP_CHUNK) {
+        size_t n = (size_t)std::min<uint64_t>(PREP_CHUNK, fileBytes - off);
+        if (pwrite(fd, run.bufs, n, (off_t)off) != (ssize_t)n) { err = std::string("prepare: ") + strerror(errno); break; }
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.progress = (float)(off + n) / fileBytes;
+    }
+    fsync(fd);
+#if defined(POSIX_FADV_DONTNEED)
+    if (!direct) posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);   // buffered fallback: start cold
+#endif
+
+    if (err.empty() && !s_stop.load()) {
+        diskBenchState = DiskBenchState::RUNNING;
+        run.deadline = std::chrono::steady_clock::now() + std::chrono::seconds(std::max(1, cfg.durationSec));
+        pub.Begin();
+        std::string engine;
+        bool ran = false;
+#if defined(DISK_HAVE_URING)
+        ran = RunUring(run, pub, cfg.durationSec, engine, err);
+#endif
+        if (!ran) {
+            engine = "pread pool";
+            {
+                std::lock_guard<std::mutex> lock(s_mutex);
+                s_result.engine = engine;
+            }
+            std::mutex errMutex;
+            std::vector<std::thread> pool;
+            for (int i = 0; i < run.qd; i++) pool.emplace_back(PoolWorker, &run, i, &err, &errMutex);
+            while (!s_stop.load() && std::chrono::steady_clock::now() < run.deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(PUBLISH_MS));
+                pub.Publish(RunProgress(run, cfg.durationSec), false);
+            }
+            for (auto& t : pool) t.join();
+        }
+        pub.Publish(1.f, true);
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.engine = engine;
+    }
+
+    munmap(run.bufs, bufBytes);
+    close(fd);   // the file goes with it
+    if (!err.empty()) { Fail(err); s_busy = false; return; }
+    diskBenchState = DiskBenchState::DONE;
+    s_busy = false;
+}
+#endif // !_WIN32
+
+// ── Public API ────────────────────────────────────────────────────────────────
+void StartDiskBench() {
+    if (s_busy.exchange(true)) return;   // previous run still unwinding
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result = DiskBenchResult{};
+    }
+    s_stop = false;
+#if defined(_WIN32)
+    Fail("NOT SUPPORTED ON WINDOWS YET");
+    s_busy = false;
+#else
+    diskBenchState = DiskBenchState::PREPARING;
+    std::thread(DiskBenchCoordinator, diskBenchConfig).detach();
+#endif
+}
+
+void StopDiskBench() {
+    if (diskBenchState != DiskBenchState::PREPARING && diskBenchState != DiskBenchState::RUNNING) return;
+    s_stop = true;
+}
+
+DiskBenchResult GetDiskBenchResult() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_result;
+}
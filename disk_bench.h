@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class DiskBenchState { IDLE, PREPARING, RUNNING, DONE, FAILED };
+
+enum class DiskPattern { SEQ_READ = 0, SEQ_WRITE, RAND_READ, RAND_WRITE, COUNT };
+
+inline const char* DISK_PATTERN_NAMES[] = { "SEQ READ", "SEQ WRITE", "RAND READ", "RAND WRITE" };
+
+struct DiskBenchConfig {
+    std::string mountPoint;              // from GetAllDrives(); empty = first drive
+    DiskPattern pattern     = DiskPattern::RAND_READ;
+    int         blockKB     = 4;
+    int         queueDepth  = 32;
+    int         fileMB      = 1024;      // temp file size; larger than any device cache
+    int         durationSec = 20;
+};
+
+// Latency histogram: 4 buckets per power of two, bucket i starts at 2^(i/4) us
+static const int DISK_LAT_BUCKETS = 96;
+
+struct DiskBenchResult {
+    std::string path;                    // where the nameless temp file lives, on the chosen mount
+    std::string engine;                  // "io_uring", "io_uring (fixed bufs)" or "pread pool"
+    std::string device;                  // block device behind the file, if found
+    std::string error;                   // set when state is FAILED
+    bool        direct      = false;     // O_DIRECT / F_NOCACHE in effect
+    int         fileMB      = 0;         // file size used; below fileMB when free space was short
+    float       progress    = 0.f;       // 0..1 of the current phase
+    // Live: last ~250 ms. Totals: whole run.
+    float       iops        = 0.f, mbps = 0.f;
+    float       avgIops     = 0.f, avgMBps = 0.f;
+    float       p50Us       = 0.f, p99Us = 0.f, maxUs = 0.f;
+    uint64_t    ios         = 0;
+    std::vector<uint64_t> latHist;       // DISK_LAT_BUCKETS counts
+    // The same interval as seen by the block layer (/proc/diskstats deltas),
+    // so app-level and device-level numbers can be compared side by side
+    bool        devValid    = false;
+    float       devIops     = 0.f, devMBps = 0.f, devAwaitMs = 0.f;
+};
+
+extern DiskBenchState  diskBenchState;
+extern DiskBenchConfig diskBenchConfig;
+
+void            StartDiskBench();
+void            StopDiskBench();
+DiskBenchResult GetDiskBenchResult();
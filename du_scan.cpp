@@ -0,0 +1,493 @@
+// du_scan.cpp - parallel directory-size scanner: work-stealing pool, getdents64 + statx
+// Pure logic, NO raylib/drawing includes (the explorer is drawn in dashboard.cpp)
+#include "du_scan.h"
+#include "event_log.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#if !defined(_WIN32)
+  #include <dirent.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+  #include <sys/stat.h>
+  #include <sys/types.h>
+  #if defined(__linux__)
+    #include <sys/syscall.h>
+    #include <sys/sysmacros.h>
+    #if defined(__NR_getdents64) && defined(STATX_BLOCKS)
+      #define DU_HAVE_STATX 1
+    #endif
+  #endif
+#endif
+
+DuScanState duScanState = DuScanState::IDLE;
+int         duThreads   = 0;
+
+static const int PUBLISH_MS = 250;
+
+#if !defined(_WIN32)
+// ── Arena tree ────────────────────────────────────────────────────────────────
+// One 40-byte node per directory, in fixed blocks that never move, indexed by
+// an id from one atomic counter. A child is allocated while its parent is
+// being listed, so child id > parent id and a single reverse pass over the
+// ids sums every subtree bottom-up without locks or child lists.
+static const uint32_t DU_BLOCK_BITS = 15;
+static const uint32_t DU_BLOCK      = 1u << DU_BLOCK_BITS;
+static const uint32_t DU_MAX_BLOCKS = 1u << 15;            // 1G directories
+static const uint32_t DU_NO_NODE    = 0xFFFFFFFFu;
+
+enum : uint8_t { NODE_FREE = 0, NODE_LINKED, NODE_LISTED };
+
+struct DuNode {
+    uint64_t             dirBytes  = 0;      // the directory inode; set before LINKED
+    uint64_t             fileBytes = 0;      // direct non-directory entries; set before LISTED
+    uint32_t             files     = 0;
+    uint32_t             parent    = 0;
+    const char*          name      = nullptr;
+    uint16_t             nameLen   = 0;
+    std::atomic<uint8_t> state{NODE_FREE};
+};
+static_assert(sizeof(DuNode) <= 40, "DuNode grew; one block is DU_BLOCK of them");
+
+// Names live in per-worker chunks: no allocation per directory, no sharing
+struct NameArena {
+    static const size_t CHUNK = 256 * 1024;
+    std::vector<std::unique_ptr<char[]>> chunks;
+    size_t used = CHUNK;
+
+    const char* Copy(const char* s, size_t n) {
+        if (used + n > CHUNK) { chunks.emplace_back(new char[CHUNK]); used = 0; }
+        char* p = chunks.back().get() + used;
+        memcpy(p, s, n);
+        used += n;
+        return p;
+    }
+};
+
+struct DuTask {
+    uint32_t    node = 0;
+    std::string path;
+};
+
+struct DuWorker {
+    std::mutex         mutex;
+    std::deque<DuTask> queue;    // owner pops the back (depth first), thieves take the front
+    NameArena          names;
+};
+
+struct DuScan {
+    std::string           root;
+    std::string           engine;
+    dev_t                 dev = 0;
+    int                   threads = 0;
+    std::atomic<bool>     cancel{false};
+    std::atomic<uint32_t> count{0};            // node ids handed out
+    std::atomic<int64_t>  pending{0};          // queued + being listed
+    std::atomic<uint64_t> files{0}, otherFs{0}, errors{0};
+    std::unique_ptr<std::atomic<DuNode*>[]> blocks{new std::atomic<DuNode*>[DU_MAX_BLOCKS]};
+    std::vector<std::unique_ptr<DuWorker>>  workers;
+    std::mutex                   linkMutex;
+    std::unordered_set<uint64_t> links;        // inodes with nlink > 1 already counted
+    std::chrono::steady_clock::time_point t0, t1;
+    bool                  finished = false;    // t1 valid; guarded by s_mutex
+
+    DuScan() { for (uint32_t b = 0; b < DU_MAX_BLOCKS; b++) blocks[b].store(nullptr); }
+    ~DuScan() { for (uint32_t b = 0; b < DU_MAX_BLOCKS; b++) delete[] blocks[b].load(); }
+
+    DuNode* Node(uint32_t id) const {
+        DuNode* b = blocks[id >> DU_BLOCK_BITS].load(std::memory_order_acquire);
+        return b ? b + (id & (DU_BLOCK - 1)) : nullptr;
+    }
+    uint32_t Alloc() {
+        uint32_t id = count.fetch_add(1, std::memory_order_relaxed);
+        uint32_t b  = id >> DU_BLOCK_BITS;
+        if (b >= DU_MAX_BLOCKS) return DU_NO_NODE;
+        if (!blocks[b].load(std::memory_order_acquire)) {
+            DuNode* fresh = new DuNode[DU_BLOCK];
+            DuNode* expected = nullptr;
+            if (!blocks[b].compare_exchange_strong(expected, fresh)) delete[] fresh;
+        }
+        return id;
+    }
+};
+
+// Subtree sums from the last bottom-up pass, indexed by node id. Kept so the
+// view can be rebuilt for another directory without waiting for a publish.
+struct DuSums {
+    std::vector<uint64_t> bytes, files, dirs;
+    std::vector<uint32_t> parent;
+    std::vector<uint8_t>  linked, done;
+};
+
+static std::mutex              s_mutex;
+static std::shared_ptr<DuScan> s_scan;     // current or last scan
+static DuSums                  s_sums;
+static uint32_t                s_focus = 0;
+static std::vector<uint32_t>   s_childIds;  // node ids behind s_view.children
+static DuView                  s_view;
+
+// ── Listing ───────────────────────────────────────────────────────────────────
+static void Push(DuScan& s, DuWorker& w, DuTask&& t) {
+    s.pending.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(w.mutex);
+    w.queue.push_back(std::move(t));
+}
+
+// One directory entry, already stat'ed. Returns the bytes to charge to the
+// directory being listed (0 for subdirectories, which get their own node).
+static uint64_t AddEntry(DuScan& s, DuWorker& w, const DuTask& t, const char* name, bool isDir,
+                         dev_t dev, uint64_t blocks, uint64_t nlink, uint64_t ino, uint32_t& files) {
+    if (dev != s.dev) { s.otherFs.fetch_add(1, std::memory_order_relaxed); return 0; }
+    if (!isDir) {
+        files++;
+        if (nlink > 1) {
+            std::lock_guard<std::mutex> lock(s.linkMutex);
+            if (!s.links.insert(ino).second) return 0;
+        }
+        return blocks * 512;
+    }
+    uint32_t id = s.Alloc();
+    DuNode* c = id != DU_NO_NODE ? s.Node(id) : nullptr;
+    if (!c) { s.errors.fetch_add(1, std::memory_order_relaxed); return 0; }
+    size_t len = strlen(name);
+    c->parent   = t.node;
+    c->name     = w.names.Copy(name, len);
+    c->nameLen  = (uint16_t)len;
+    c->dirBytes = blocks * 512;
+    c->state.store(NODE_LINKED, std::memory_order_release);
+    DuTask sub;
+    sub.node = id;
+    sub.path.reserve(t.path.size() + len + 1);
+    sub.path = t.path;
+    if (sub.path.back() != '/') sub.path += '/';
+    sub.path.append(name, len);
+    Push(s, w, std::move(sub));
+    return 0;
+}
+
+static bool IsDots(const char* n) { return n[0] == '.' && (n[1] == 0 || (n[1] == '.' && n[2] == 0)); }
+
+#if defined(DU_HAVE_STATX)
+struct DuDirent64 {
+    uint64_t       ino;
+    int64_t        off;
+    unsigned short reclen;
+    unsigned char  type;
+    char           name[256];
+};
+
+// Raw getdents64 into a 64 KB buffer (hundreds of entries per syscall) and
+// statx relative to the directory fd, asking only for what is summed.
+// AT_STATX_DONT_SYNC keeps network filesystems from round-tripping per file.
+static void ListDir(DuScan& s, DuWorker& w, const DuTask& t, char* buf, size_t bufSize) {
+    DuNode* node = s.Node(t.node);
+    uint64_t bytes = 0;
+    uint32_t files = 0;
+    int fd = open(t.path.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC);
+    if (fd < 0) s.errors.fetch_add(1, std::memory_order_relaxed);
+    while (fd >= 0) {
+        long n = syscall(SYS_getdents64, fd, buf, bufSize);
+        if (n <= 0) { if (n < 0) s.errors.fetch_add(1, std::memory_order_relaxed); break; }
+        for (long off = 0; off < n; ) {
+            const DuDirent64* d = (const DuDirent64*)(buf + off);
+            off += d->reclen;
+            if (IsDots(d->name)) continue;
+            if (s.cancel.load(std::memory_order_relaxed)) { off = n; break; }
+            unsigned mask = STATX_BLOCKS | STATX_NLINK | STATX_INO;
+            if (d->type == DT_UNKNOWN) mask |= STATX_TYPE;
+            struct statx sx;
+            if (statx(fd, d->name, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT | AT_STATX_DONT_SYNC, mask, &sx) != 0) {
+                s.errors.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            bool isDir = d->type == DT_DIR || (d->type == DT_UNKNOWN && S_ISDIR(sx.stx_mode));
+            bytes += AddEntry(s, w, t, d->name, isDir, makedev(sx.stx_dev_major, sx.stx_dev_minor),
+                              sx.stx_blocks, sx.stx_nlink, sx.stx_ino, files);
+        }
+        if (s.cancel.load(std::memory_order_relaxed)) break;
+    }
+    if (fd >= 0) close(fd);
+    node->fileBytes = bytes;
+    node->files     = files;
+    node->state.store(NODE_LISTED, std::memory_order_release);
+    s.files.fetch_add(files, std::memory_order_relaxed);
+}
+#else
+static void ListDir(DuScan& s, DuWorker& w, const DuTask& t, char*, size_t) {
+    DuNode* node = s.Node(t.node);
+    uint64_t bytes = 0;
+    uint32_t files = 0;
+    DIR* dir = opendir(t.path.c_str());
+    if (!dir) s.errors.fetch_add(1, std::memory_order_relaxed);
+    while (dir && !s.cancel.load(std::memory_order_relaxed)) {
+        struct dirent* e = readdir(dir);
+        if (!e) break;
+        if (IsDots(e->d_name)) continue;
+        struct stat st;
+        if (fstatat(dirfd(dir), e->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+            s.errors.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        bytes += AddEntry(s, w, t, e->d_name, S_ISDIR(st.st_mode), st.st_dev, (uint64_t)st.st_blocks,
+                          (uint64_t)st.st_nlink, (uint64_t)st.st_ino, files);
+    }
+    if (dir) closedir(dir);
+    node->fileBytes = bytes;
+    node->files     = files;
+    node->state.store(NODE_LISTED, std::memory_order_release);
+    s.files.fetch_add(files, std::memory_order_relaxed);
+}
+#endif
+
+// ── Work-stealing pool ────────────────────────────────────────────────────────
+// Each worker drains its own deque depth first, which keeps the directories it
+// just found hot in the dentry cache. An idle worker steals the oldest entry
+// of another queue: the shallowest directory, so the biggest piece of work.
+static void DuWorkerLoop(std::shared_ptr<DuScan> sp, int self) {
+    DuScan& s = *sp;
+    DuWorker& w = *s.workers[self];
+    std::vector<char> buf(64 * 1024);
+    int n = (int)s.workers.size(), idle = 0;
+    while (!s.cancel.load(std::memory_order_relaxed)) {
+        DuTask t;
+        bool got = false;
+        {
+            std::lock_guard<std::mutex> lock(w.mutex);
+            if (!w.queue.empty()) { t = std::move(w.queue.back()); w.queue.pop_back(); got = true; }
+        }
+        for (int k = 1; !got && k < n; k++) {
+            DuWorker& v = *s.workers[(self + k) % n];
+            std::lock_guard<std::mutex> lock(v.mutex);
+            if (!v.queue.empty()) { t = std::move(v.queue.front()); v.queue.pop_front(); got = true; }
+        }
+        if (!got) {
+            // Nothing queued anywhere: done, unless someone is still listing
+            if (s.pending.load(std::memory_order_acquire) == 0) break;
+            if (++idle < 64) std::this_thread::yield();
+            else             std::this_thread::sleep_for(std::chrono::microseconds(200));
+            continue;
+        }
+        idle = 0;
+        ListDir(s, w, t, buf.data(), buf.size());
+        s.pending.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+// ── Publishing ────────────────────────────────────────────────────────────────
+static void SumTree(const DuScan& s, DuSums& out) {
+    uint32_t n = std::min(s.count.load(std::memory_order_acquire), DU_MAX_BLOCKS * DU_BLOCK);
+    out.bytes.assign(n, 0); out.files.assign(n, 0); out.dirs.assign(n, 0);
+    out.parent.assign(n, 0); out.linked.assign(n, 0); out.done.assign(n, 0);
+    for (uint32_t i = 0; i < n; i++) {
+        const DuNode* d = s.Node(i);
+        uint8_t st = d ? d->state.load(std::memory_order_acquire) : (uint8_t)NODE_FREE;
+        if (st == NODE_FREE) continue;   // id handed out, not filled in yet: its parent is still listing
+        out.linked[i] = 1;
+        out.parent[i] = d->parent;
+        out.bytes[i]  = d->dirBytes;
+        if (st == NODE_LISTED) {
+            out.bytes[i] += d->fileBytes;
+            out.files[i]  = d->files;
+            out.done[i]   = 1;
+        }
+    }
+    for (uint32_t i = n; i-- > 1; ) {
+        if (!out.linked[i]) continue;
+        uint32_t p = out.parent[i];
+        out.bytes[p] += out.bytes[i];
+        out.files[p] += out.files[i];
+        out.dirs[p]  += out.dirs[i] + 1;
+        out.done[p]  &= out.done[i];
+    }
+}
+
+static DuEntry MakeEntry(const DuSums& sums, uint32_t id, std::string name) {
+    DuEntry e;
+    e.name  = std::move(name);
+    e.bytes = sums.bytes[id];
+    e.files = sums.files[id];
+    e.dirs  = sums.dirs[id];
+    e.done  = sums.done[id] != 0;
+    return e;
+}
+
+// Rebuilds s_view for s_focus from s_sums. Caller holds s_mutex.
+static void BuildView(const DuScan& s) {
+    DuView& v = s_view;
+    v.root    = s.root;
+    v.engine  = s.engine;
+    v.threads = s.threads;
+    auto end  = s.finished ? s.t1 : std::chrono::steady_clock::now();
+    v.seconds = std::chrono::duration<float>(end - s.t0).count();
+    v.files   = s.files.load(std::memory_order_relaxed);
+    v.otherFs = s.otherFs.load(std::memory_order_relaxed);
+    v.errors  = s.errors.load(std::memory_order_relaxed);
+    v.children.clear();
+    s_childIds.clear();
+    uint32_t n = (uint32_t)s_sums.bytes.size();
+    if (n == 0) return;
+    v.bytes = s_sums.bytes[0];
+    v.dirs  = s_sums.dirs[0] + 1;
+    if (s_focus >= n) s_focus = 0;
+
+    // Path of the focus: walk up the parent links
+    std::string rel;
+    for (uint32_t id = s_focus; id != 0; id = s_sums.parent[id]) {
+        const DuNode* d = s.Node(id);
+        rel = "/" + std::string(d->name, d->nameLen) + rel;
+    }
+    v.path  = s.root == "/" ? (rel.empty() ? "/" : rel) : s.root + rel;
+    v.focus = MakeEntry(s_sums, s_focus, v.path);
+    const DuNode* f = s.Node(s_focus);
+    v.focusOwnBytes = f->dirBytes + (f->state.load(std::memory_order_acquire) == NODE_LISTED ? f->fileBytes : 0);
+
+    for (uint32_t i = s_focus + 1; i < n; i++)
+        if (s_sums.linked[i] && s_sums.parent[i] == s_focus) s_childIds.push_back(i);
+    size_t keep = std::min(s_childIds.size(), (size_t)DU_LIST_MAX);
+    std::partial_sort(s_childIds.begin(), s_childIds.begin() + keep, s_childIds.end(),
+                      [](uint32_t a, uint32_t b) { return s_sums.bytes[a] > s_sums.bytes[b]; });
+    s_childIds.resize(keep);
+    for (uint32_t id : s_childIds) {
+        const DuNode* d = s.Node(id);
+        v.children.push_back(MakeEntry(s_sums, id, std::string(d->name, d->nameLen)));
+    }
+}
+
+static void Publish(const std::shared_ptr<DuScan>& sp, DuSums& scratch) {
+    SumTree(*sp, scratch);
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_scan != sp) return;   // superseded by a newer scan
+    std::swap(s_sums, scratch);
+    BuildView(*sp);
+}
+
+static void DuCoordinator(std::shared_ptr<DuScan> sp) {
+    DuScan& s = *sp;
+    std::vector<std::thread> pool;
+    for (int i = 0; i < s.threads; i++) pool.emplace_back(DuWorkerLoop, sp, i);
+
+    DuSums scratch;
+    while (!s.cancel.load() && s.pending.load() > 0) {
+        for (int t = 0; t < PUBLISH_MS / 10 && !s.cancel.load() && s.pending.load() > 0; t++)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        Publish(sp, scratch);
+    }
+    for (auto& t : pool) t.join();
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (!s.finished) { s.finished = true; s.t1 = std::chrono::steady_clock::now(); }
+    }
+    Publish(sp, scratch);
+    if (!s.cancel.load()) {
+        char msg[EVENT_TEXT_MAX];
+        snprintf(msg, sizeof(msg), "[DU] %s: %llu files in %.1f s",
+                 s.root.c_str(), (unsigned long long)s.files.load(),
+                 std::chrono::duration<double>(s.t1 - s.t0).count());
+        LogEvent(s.errors.load() ? EV_WARN : EV_INFO, msg);
+    }
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_scan == sp && !s.cancel.load()) duScanState = DuScanState::DONE;
+}
+#endif // !_WIN32
+
+// ── Public API ────────────────────────────────────────────────────────────────
+static void Fail(const std::string& msg) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_view.error = msg;
+    duScanState  = DuScanState::FAILED;
+}
+
+void StartDuScan(const std::string& root) {
+    StopDuScan();
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_view  = DuView();
+        s_view.root = root;
+        s_focus = 0;
+    }
+#if defined(_WIN32)
+    Fail("NOT SUPPORTED ON WINDOWS YET");
+#else
+    struct stat st;
+    if (root.empty() || stat(root.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+        Fail("CANNOT OPEN " + root + ": " + strerror(errno));
+        return;
+    }
+    auto sp = std::make_shared<DuScan>();
+    sp->root = root;
+    sp->dev  = st.st_dev;
+    sp->t0   = std::chrono::steady_clock::now();
+#if defined(DU_HAVE_STATX)
+    sp->engine = "getdents64 + statx";
+#else
+    sp->engine = "readdir + fstatat";
+#endif
+    // Metadata walks wait on the device far more than on the CPU, so run
+    // more threads than cores to keep a queue of lookups in flight
+    int hw = (int)std::thread::hardware_concurrency();
+    sp->threads = duThreads > 0 ? std::min(duThreads, 256) : std::max(4, std::min(32, hw * 2));
+    for (int i = 0; i < sp->threads; i++) sp->workers.emplace_back(new DuWorker);
+
+    uint32_t rootId = sp->Alloc();   // always 0
+    DuNode* r = sp->Node(rootId);
+    r->parent   = 0;
+    r->name     = "";
+    r->dirBytes = (uint64_t)st.st_blocks * 512;
+    r->state.store(NODE_LINKED, std::memory_order_release);
+    Push(*sp, *sp->workers[0], DuTask{ rootId, root });
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_scan = sp;
+        s_sums = DuSums();
+        s_view.engine  = sp->engine;
+        s_view.threads = sp->threads;
+    }
+    duScanState = DuScanState::RUNNING;
+    std::thread(DuCoordinator, sp).detach();
+#endif
+}
+
+void StopDuScan() {
+#if !defined(_WIN32)
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (duScanState != DuScanState::RUNNING || !s_scan) return;
+    s_scan->cancel   = true;
+    s_scan->finished = true;
+    s_scan->t1       = std::chrono::steady_clock::now();
+    duScanState = DuScanState::CANCELLED;
+#endif
+}
+
+DuView GetDuView() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_view;
+}
+
+void DuEnter(int child) {
+#if !defined(_WIN32)
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_scan || child < 0 || child >= (int)s_childIds.size()) return;
+    s_focus = s_childIds[child];
+    BuildView(*s_scan);
+#else
+    (void)child;
+#endif
+}
+
+void DuLeave() {
+#if !defined(_WIN32)
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_scan || s_focus == 0 || s_focus >= s_sums.parent.size()) return;
+    s_focus = s_sums.parent[s_focus];
+    BuildView(*s_scan);
+#endif
+}
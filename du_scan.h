@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ── Disk usage scanner ────────────────────────────────────────────────────────
+// Walks one mount with a work-stealing thread pool and never crosses into
+// another filesystem. Each directory becomes one node in an arena; sizes are
+// summed bottom-up from those nodes every publish, so the largest directories
+// show up while the scan is still running. Sizes are allocated bytes
+// (st_blocks * 512), hard-linked files counted once, like du -x.
+enum class DuScanState { IDLE, RUNNING, DONE, CANCELLED, FAILED };
+
+static const int DU_LIST_MAX = 200;   // children kept per view, largest first
+
+struct DuEntry {
+    std::string name;
+    uint64_t    bytes = 0;            // whole subtree
+    uint64_t    files = 0;            // non-directory entries in the subtree
+    uint64_t    dirs  = 0;            // directories below this one
+    bool        done  = false;        // every directory in the subtree listed
+};
+
+struct DuView {
+    std::string root;                 // mount being scanned
+    std::string engine;               // "getdents64 + statx" or "readdir + fstatat"
+    std::string error;                // set when state is FAILED
+    int         threads = 0;
+    float       seconds = 0.f;
+    uint64_t    files   = 0, dirs = 0, bytes = 0;   // everything seen so far
+    uint64_t    otherFs = 0;          // mount points below the root, not entered
+    uint64_t    errors  = 0;          // unreadable directories / entries
+    // The directory being looked at: the root unless the user descended
+    std::string path;
+    DuEntry     focus;
+    uint64_t    focusOwnBytes = 0;    // the directory itself plus its direct files
+    std::vector<DuEntry> children;    // largest first, at most DU_LIST_MAX
+};
+
+extern DuScanState duScanState;
+extern int         duThreads;         // worker count, 0 = auto
+
+// Starts a scan of the directory tree under root, replacing the previous
+// result. A scan that is still unwinding after StopDuScan() is left to finish
+// on its own; it never touches the new one.
+void   StartDuScan(const std::string& root);
+// Returns at once; workers drop their queues at the next entry they look at
+void   StopDuScan();
+DuView GetDuView();
+// Navigation works during and after the scan
+void   DuEnter(int child);            // index into GetDuView().children
+void   DuLeave();                     // back to the parent directory
@@ -0,0 +1,203 @@
+// event_log.cpp - lock-free multi-producer event ring, source interning, async file writer
+// Pure logic, NO raylib/drawing includes
+#include "event_log.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+
+std::string eventLogFile = "events.log";
+
+// ── Ring ──────────────────────────────────────────────────────────────────────
+// Slot state is a sequence word: 2t+1 while entry t is being written, 2t+2
+// once it is complete. Readers check it before and after copying (seqlock),
+// so a slot overwritten mid-copy is detected and skipped. The payload is
+// copied in and out as relaxed atomic words to keep that race well-defined.
+static const size_t EVENT_WORDS = (sizeof(EventLogEntry) + 7) / 8;
+static_assert((EVENT_LOG_CAPACITY & (EVENT_LOG_CAPACITY - 1)) == 0, "capacity must be a power of two");
+
+struct alignas(64) EventSlot {
+    std::atomic<uint64_t> seq{0};
+    std::atomic<uint64_t> words[EVENT_WORDS];
+};
+
+static EventSlot             s_ring[EVENT_LOG_CAPACITY];
+static std::atomic<uint64_t> s_head{0};
+
+static const auto s_epoch = std::chrono::steady_clock::now();
+
+double EventLogNow() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - s_epoch).count();
+}
+
+uint64_t EventLogHead() { return s_head.load(std::memory_order_acquire); }
+
+// ── Source interning ──────────────────────────────────────────────────────────
+// Open addressing on a 64-bit hash of the tag. A new tag claims its slot
+// with one CAS; the name is published after it, so a reader may briefly see
+// an id whose name is still empty.
+struct SourceSlot {
+    std::atomic<uint64_t> hash{0};
+    std::atomic<bool>     ready{false};
+    char                  name[16] = {};
+};
+static SourceSlot s_sources[EVENT_SOURCE_MAX];
+
+static uint8_t InternSource(const char* tag, size_t len) {
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < len; i++) h = (h ^ (unsigned char)tag[i]) * 1099511628211ull;
+    h |= 1;   // 0 marks an empty slot
+    for (int probe = 0; probe < EVENT_SOURCE_MAX - 1; probe++) {
+        int id = 1 + (int)((h + probe) % (EVENT_SOURCE_MAX - 1));
+        SourceSlot& s = s_sources[id];
+        uint64_t cur = s.hash.load(std::memory_order_acquire);
+        if (cur == 0) {
+            if (s.hash.compare_exchange_strong(cur, h, std::memory_order_acq_rel)) {
+                memcpy(s.name, tag, len < sizeof(s.name) - 1 ? len : sizeof(s.name) - 1);
+                s.ready.store(true, std::memory_order_release);
+                return (uint8_t)id;
+            }
+        }
+        if (cur == h) return (uint8_t)id;
+    }
+    return 0;   // table full: untagged
+}
+
+const char* EventSourceName(uint8_t id) {
+    if (id == 0 || id >= EVENT_SOURCE_MAX || !s_sources[id].ready.load(std::memory_order_acquire)) return "";
+    return s_sources[id].name;
+}
+
+// ── Producers ─────────────────────────────────────────────────────────────────
+void LogEvent(EventLevel level, const char* text, uint32_t rgba) {
+    EventLogEntry e;
+    e.time   = EventLogNow();
+    e.wallUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::system_clock::now().time_since_epoch()).count();
+    e.level  = level;
+    e.rgba   = rgba;
+    size_t len = strlen(text);
+    if (len > (size_t)EVENT_TEXT_MAX - 1) len = EVENT_TEXT_MAX - 1;
+    memcpy(e.text, text, len);
+    if (text[0] == '[') {
+        const char* close = (const char*)memchr(text, ']', len);
+        if (close && close - text > 1 && close - text <= 16) e.source = InternSource(text + 1, (size_t)(close - text - 1));
+    }
+
+    uint64_t t = s_head.fetch_add(1, std::memory_order_relaxed);
+    e.seq = t;
+    EventSlot& slot = s_ring[t & (EVENT_LOG_CAPACITY - 1)];
+    uint64_t want = 2 * t + 1;
+    uint64_t cur = slot.seq.load(std::memory_order_acquire);
+    for (;;) {
+        // Only possible after a whole ring of entries while one writer was
+        // preempted mid-copy: wait for it, or give up if a newer entry won
+        if (cur & 1) { std::this_thread::yield(); cur = slot.seq.load(std::memory_order_acquire); continue; }
+        if (cur > want) return;
+        if (slot.seq.compare_exchange_weak(cur, want, std::memory_order_acq_rel)) break;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    uint64_t words[EVENT_WORDS] = {};
+    memcpy(words, &e, sizeof(e));
+    for (size_t i = 0; i < EVENT_WORDS; i++) slot.words[i].store(words[i], std::memory_order_relaxed);
+    slot.seq.store(want + 1, std::memory_order_release);
+}
+
+// ── Readers ───────────────────────────────────────────────────────────────────
+size_t ReadEventLog(uint64_t& cursor, EventLogEntry* out, size_t max, uint64_t* lost) {
+    uint64_t head = s_head.load(std::memory_order_acquire);
+    uint64_t gone = 0;
+    if (head - cursor > EVENT_LOG_CAPACITY) {
+        gone  += head - EVENT_LOG_CAPACITY - cursor;
+        cursor = head - EVENT_LOG_CAPACITY;
+    }
+    size_t n = 0;
+    while (cursor < head && n < max) {
+        EventSlot& slot = s_ring[cursor & (EVENT_LOG_CAPACITY - 1)];
+        uint64_t done = 2 * cursor + 2;
+        uint64_t s1 = slot.seq.load(std::memory_order_acquire);
+        if (s1 < done) break;                                 // still being written: next call
+        if (s1 > done) { gone++; cursor++; continue; }        // already overwritten
+        uint64_t words[EVENT_WORDS];
+        for (size_t i = 0; i < EVENT_WORDS; i++) words[i] = slot.words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != s1) { gone++; cursor++; continue; }
+        memcpy(&out[n++], words, sizeof(EventLogEntry));
+        cursor++;
+    }
+    if (lost) *lost += gone;
+    return n;
+}
+
+// ── File writer ───────────────────────────────────────────────────────────────
+static const long ROLL_BYTES = 8L * 1024 * 1024;
+
+static std::atomic<bool> s_writerStop{false};
+static std::atomic<bool> s_writerRunning{false};
+
+static void AppendLine(std::string& out, const EventLogEntry& e) {
+    time_t secs = (time_t)(e.wallUs / 1000000);
+    struct tm tmv;
+#if defined(_WIN32)
+    localtime_s(&tmv, &secs);
+#else
+    localtime_r(&secs, &tmv);
+#endif
+    char head[64];
+    size_t n = strftime(head, sizeof(head), "%Y-%m-%d %H:%M:%S", &tmv);
+    snprintf(head + n, sizeof(head) - n, ".%03d %-5s ", (int)(e.wallUs / 1000 % 1000), EVENT_LEVEL_NAMES[e.level]);
+    out += head;
+    out += e.text;
+    out += '\n';
+}
+
+static void WriterThread(std::string path) {
+    FILE* f = fopen(path.c_str(), "ab");
+    uint64_t cursor = 0, lost = 0;
+    EventLogEntry batch[256];
+    std::string out;
+    for (;;) {
+        bool stopping = s_writerStop.load();
+        out.clear();
+        size_t n;
+        while ((n = ReadEventLog(cursor, batch, 256, &lost)) > 0 || lost > 0) {
+            if (lost > 0) {
+                out += "... " + std::to_string(lost) + " entries overwritten before they were written\n";
+                lost = 0;
+            }
+            for (size_t i = 0; i < n; i++) AppendLine(out, batch[i]);
+        }
+        if (f && !out.empty()) {
+            fwrite(out.data(), 1, out.size(), f);
+            fflush(f);
+            if (ftell(f) > ROLL_BYTES) {
+                fclose(f);
+                std::string old = path + ".1";
+                remove(old.c_str());
+                rename(path.c_str(), old.c_str());
+                f = fopen(path.c_str(), "ab");
+            }
+        }
+        if (stopping) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+    if (f) fclose(f);
+    s_writerRunning = false;
+}
+
+void StartEventLogWriter(const std::string& path) {
+    if (path.empty() || s_writerRunning.exchange(true)) return;
+    s_writerStop = false;
+    std::thread(WriterThread, path).detach();
+}
+
+void StopEventLogWriter() {
+    if (!s_writerRunning.load()) return;
+    s_writerStop = true;
+    // Give the final flush a moment; the thread is detached like the other workers
+    for (int i = 0; i < 50 && s_writerRunning.load(); i++)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
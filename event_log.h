@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ── Event log ─────────────────────────────────────────────────────────────────
+// Bounded multi-producer ring: any thread logs with one fetch_add and a copy
+// into the slot, never a lock or an allocation. Readers keep their own
+// cursor (the System Log panel and the file writer each have one); when a
+// reader falls a whole ring behind, the overwritten entries are reported as
+// lost rather than blocking producers. Message text is stored inline in the
+// ring slot; "[TAG]" prefixes are interned into a small source table.
+enum EventLevel : uint8_t { EV_DEBUG = 0, EV_INFO, EV_WARN, EV_ERROR, EV_LEVEL_COUNT };
+
+inline const char* EVENT_LEVEL_NAMES[] = { "DEBUG", "INFO", "WARN", "ERROR" };
+
+static const size_t EVENT_LOG_CAPACITY = 4096;   // power of two
+static const int    EVENT_TEXT_MAX     = 120;    // longer messages are cut
+static const int    EVENT_SOURCE_MAX   = 64;     // distinct [TAG]s, 0 = untagged
+
+struct EventLogEntry {
+    uint64_t   seq    = 0;       // position in the log, from 0
+    double     time   = 0.0;     // EventLogNow() when logged
+    int64_t    wallUs = 0;       // wall clock, microseconds since the epoch
+    EventLevel level  = EV_INFO;
+    uint8_t    source = 0;       // EventSourceName()
+    uint32_t   rgba   = 0;       // display colour chosen by the caller, 0 = by level
+    char       text[EVENT_TEXT_MAX] = {};
+};
+
+// Thread-safe, lock-free. The source comes from a leading "[TAG]".
+void        LogEvent(EventLevel level, const char* text, uint32_t rgba = 0);
+inline void LogEvent(EventLevel level, const std::string& text, uint32_t rgba = 0) { LogEvent(level, text.c_str(), rgba); }
+
+// Copies up to max entries from cursor onwards into out and advances cursor.
+// Entries a whole ring older than the newest are gone; their count is added
+// to *lost. Start a reader at 0 to get everything still in the ring.
+size_t      ReadEventLog(uint64_t& cursor, EventLogEntry* out, size_t max, uint64_t* lost);
+uint64_t    EventLogHead();              // seq the next entry will get
+double      EventLogNow();               // clock used for EventLogEntry::time
+const char* EventSourceName(uint8_t id); // "" for 0 and for ids not in use yet
+
+// Background writer: appends every entry to path as a text line, flushing a
+// batch at a time. The file is rolled over to path + ".1" at 8 MB.
+extern std::string eventLogFile;         // dashboard.cfg event_log_file; empty = off
+void        StartEventLogWriter(const std::string& path);
+void        StopEventLogWriter();        // flushes what is left
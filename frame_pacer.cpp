@@ -0,0 +1,226 @@
+// frame_pacer.cpp - frame pacing decisions, input-wait wakeups, self CPU accounting
+// Pure logic, NO raylib/drawing includes
+#include "frame_pacer.h"
+#include "event_log.h"
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32)
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+#else
+  #include <sys/resource.h>
+#endif
+
+// raylib's desktop backend links GLFW in; its empty-event post is the only
+// thread-safe way to make a blocked event wait return. Declared weak so a
+// build against a backend without GLFW still links and falls back to sleeping.
+#if defined(__linux__)
+extern "C" void glfwPostEmptyEvent(void) __attribute__((weak));
+#endif
+
+FramePacerConfig framePacerConfig;
+
+// ── Self CPU time ─────────────────────────────────────────────────────────────
+static void ReadCpuTimes(double& proc, double& mainThread) {
+#if defined(_WIN32)
+    FILETIME c, e, k, u;
+    auto secs = [](const FILETIME& a, const FILETIME& b) {
+        ULARGE_INTEGER x, y;
+        x.LowPart = a.dwLowDateTime; x.HighPart = a.dwHighDateTime;
+        y.LowPart = b.dwLowDateTime; y.HighPart = b.dwHighDateTime;
+        return (double)(x.QuadPart + y.QuadPart) * 1e-7;
+    };
+    proc = mainThread = -1.0;
+    if (GetProcessTimes(GetCurrentProcess(), &c, &e, &k, &u)) proc = secs(k, u);
+    if (GetThreadTimes(GetCurrentThread(), &c, &e, &k, &u))   mainThread = secs(k, u);
+#else
+    auto secs = [](const struct rusage& r) {
+        return r.ru_utime.tv_sec + r.ru_stime.tv_sec + (r.ru_utime.tv_usec + r.ru_stime.tv_usec) * 1e-6;
+    };
+    struct rusage ru;
+    proc = getrusage(RUSAGE_SELF, &ru) == 0 ? secs(ru) : -1.0;
+  #if defined(__linux__)
+    mainThread = getrusage(RUSAGE_THREAD, &ru) == 0 ? secs(ru) : -1.0;
+  #else
+    mainThread = -1.0;
+  #endif
+#endif
+}
+
+// ── Accounting ────────────────────────────────────────────────────────────────
+// Cumulative readings once a second; the last minute is the difference
+// between the newest and the oldest kept. Cleared on a mode switch so the
+// window only ever covers one mode.
+struct CpuSample { double t, proc, main; uint64_t frames, allocs; };
+static const int WINDOW = 61;
+
+static CpuSample     s_window[WINDOW];
+static int           s_windowHead = 0, s_windowCount = 0;
+static PaceModeStats s_total[(int)PaceMode::COUNT];
+static PaceModeStats s_period;              // current mode since the last switch
+static CpuSample     s_last = { -1.0, 0, 0, 0, 0 };
+static uint64_t      s_frames = 0, s_allocs = 0, s_lastFrameAllocs = 0;
+static double        s_lastDraw = -1.0;
+static bool          s_pending  = true;
+
+static void Account(double now, bool force) {
+    if (!force && s_last.t >= 0.0 && now - s_last.t < 1.0) return;
+    CpuSample cur;
+    cur.t = now;
+    cur.frames = s_frames;
+    cur.allocs = s_allocs;
+    ReadCpuTimes(cur.proc, cur.main);
+    if (s_last.t >= 0.0) {
+        PaceModeStats d;
+        d.wallSec    = cur.t - s_last.t;
+        d.cpuSec     = cur.proc >= 0.0 ? cur.proc - s_last.proc : 0.0;
+        d.mainCpuSec = cur.main >= 0.0 ? cur.main - s_last.main : 0.0;
+        d.frames     = cur.frames - s_last.frames;
+        for (PaceModeStats* s : { &s_total[(int)framePacerConfig.mode], &s_period }) {
+            s->wallSec += d.wallSec; s->cpuSec += d.cpuSec;
+            s->mainCpuSec += d.mainCpuSec; s->frames += d.frames;
+        }
+    }
+    s_last = cur;
+    s_window[s_windowHead] = cur;
+    s_windowHead = (s_windowHead + 1) % WINDOW;
+    if (s_windowCount < WINDOW) s_windowCount++;
+}
+
+void FramePacerSetMode(PaceMode mode, double now) {
+    if (s_last.t >= 0.0) Account(now, true);
+    if (s_period.wallSec >= 5.0) {
+        char msg[EVENT_TEXT_MAX];
+        double perMin = 60.0 / s_period.wallSec;
+        snprintf(msg, sizeof(msg), "[PACE] %s: %.0f ms CPU/min (render thread %.0f), %.1f fps over %.1f min",
+                 PACE_MODE_NAMES[(int)framePacerConfig.mode], s_period.cpuSec * 1000.0 * perMin,
+                 s_period.mainCpuSec * 1000.0 * perMin, s_period.frames / s_period.wallSec,
+                 s_period.wallSec / 60.0);
+        LogEvent(EV_INFO, msg);
+    }
+    framePacerConfig.mode = mode;
+    s_period = PaceModeStats();
+    s_windowCount = 0;
+    s_pending = true;
+    if (s_last.t >= 0.0) {
+        s_window[s_windowHead] = s_last;
+        s_windowHead = (s_windowHead + 1) % WINDOW;
+        s_windowCount = 1;
+    }
+}
+
+FramePacerStatus GetFramePacerStatus() {
+    FramePacerStatus st;
+    st.mode = framePacerConfig.mode;
+    st.canBlock = FramePacerCanBlock();
+    st.lastFrameAllocs = s_lastFrameAllocs;
+    for (int m = 0; m < (int)PaceMode::COUNT; m++) st.total[m] = s_total[m];
+    if (s_windowCount >= 2) {
+        const CpuSample& a = s_window[(s_windowHead - s_windowCount + WINDOW) % WINDOW];
+        const CpuSample& b = s_window[(s_windowHead - 1 + WINDOW) % WINDOW];
+        double span = b.t - a.t;
+        if (span > 0.0) {
+            st.windowSec = (float)span;
+            st.fps = (float)((b.frames - a.frames) / span);
+            if (b.frames > a.frames) st.allocsPerFrame = (float)(b.allocs - a.allocs) / (float)(b.frames - a.frames);
+            if (b.proc >= 0.0) st.cpuMsPerMin  = (float)((b.proc - a.proc) * 60000.0 / span);
+            if (b.main >= 0.0) st.mainMsPerMin = (float)((b.main - a.main) * 60000.0 / span);
+        }
+    }
+    return st;
+}
+
+// ── Pacing ────────────────────────────────────────────────────────────────────
+double FramePacerPlan(double now, bool dirty, bool animating, double nextEvent) {
+    Account(now, false);
+    if (framePacerConfig.mode != PaceMode::ON_DEMAND || s_lastDraw < 0.0) return 0.0;
+
+    if (dirty) s_pending = true;
+    double burstGap = 1.0 / std::max(framePacerConfig.fps, 1);
+    double animGap  = 1.0 / std::max(framePacerConfig.animFps, 1);
+    double due = 1e300;
+    if (s_pending) due = s_lastDraw + burstGap;
+    if (animating) due = std::min(due, s_lastDraw + animGap);
+    if (now >= due) return 0.0;
+    // Never sleep past a second: anything that forgot to report itself
+    // still shows up within one
+    double wake = std::min(due, nextEvent) - now;
+    return std::min(std::max(wake, 0.001), 1.0);
+}
+
+void FramePacerFrameDrawn(double now, uint64_t allocs) {
+    s_lastDraw = now;
+    s_pending  = false;
+    s_frames++;
+    s_allocs += allocs;
+    s_lastFrameAllocs = allocs;
+}
+
+// ── Input wait ────────────────────────────────────────────────────────────────
+static std::mutex              s_wakeMutex;
+static std::condition_variable s_wakeCv;
+static bool                    s_wakeThread = false, s_wakeArmed = false, s_wakeStop = false;
+static std::chrono::steady_clock::time_point s_wakeAt;
+
+bool FramePacerCanBlock() {
+#if defined(__linux__)
+    return glfwPostEmptyEvent != nullptr;
+#else
+    return false;
+#endif
+}
+
+#if defined(__linux__)
+static void WakeThread() {
+    std::unique_lock<std::mutex> lock(s_wakeMutex);
+    while (!s_wakeStop) {
+        if (!s_wakeArmed) { s_wakeCv.wait(lock); continue; }
+        if (std::chrono::steady_clock::now() >= s_wakeAt) {
+            s_wakeArmed = false;
+            glfwPostEmptyEvent();   // under the lock, so never after StopFramePacer()
+            continue;
+        }
+        s_wakeCv.wait_until(lock, s_wakeAt);
+    }
+}
+#endif
+
+void FramePacerArmWake(double seconds) {
+#if defined(__linux__)
+    if (!FramePacerCanBlock()) return;
+    std::lock_guard<std::mutex> lock(s_wakeMutex);
+    if (s_wakeStop) return;
+    if (!s_wakeThread) { s_wakeThread = true; std::thread(WakeThread).detach(); }
+    s_wakeAt    = std::chrono::steady_clock::now() + std::chrono::microseconds((long long)(seconds * 1e6));
+    s_wakeArmed = true;
+    s_wakeCv.notify_one();
+#else
+    (void)seconds;
+#endif
+}
+
+// Posted straight away, not through the helper: the empty event stays
+// queued, so a wait that starts after this still returns at once
+void FramePacerWakeNow() {
+#if defined(__linux__)
+    if (!FramePacerCanBlock()) return;
+    std::lock_guard<std::mutex> lock(s_wakeMutex);
+    if (!s_wakeStop) glfwPostEmptyEvent();
+#endif
+}
+
+void FramePacerSleep(double seconds) {
+    std::this_thread::sleep_for(std::chrono::microseconds((long long)(seconds * 1e6)));
+}
+
+void StopFramePacer() {
+    std::lock_guard<std::mutex> lock(s_wakeMutex);
+    s_wakeStop  = true;
+    s_wakeArmed = false;
+    s_wakeCv.notify_one();
+}
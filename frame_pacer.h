@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+
+// ── Frame pacing ──────────────────────────────────────────────────────────────
+// FIXED caps the loop with SetTargetFPS, VSYNC swaps on the display refresh,
+// ON_DEMAND only draws when something changed: a new metrics sample, input,
+// or an animation that is running (menus, flashing alerts, live benchmarks).
+// Between those the loop blocks on input with a timeout.
+enum class PaceMode { FIXED = 0, VSYNC, ON_DEMAND, COUNT };
+
+inline const char* PACE_MODE_NAMES[] = { "FIXED", "VSYNC", "ON-DEMAND" };
+
+struct FramePacerConfig {
+    PaceMode mode    = PaceMode::ON_DEMAND;
+    int      fps     = 60;   // FIXED cap, and the ON_DEMAND cap for input bursts
+    int      animFps = 30;   // ON_DEMAND rate while something animates
+};
+
+// The dashboard's own cost, from getrusage: whole process (all threads) and
+// the render thread alone. -1 where the platform can't tell them apart.
+struct PaceModeStats {
+    double   wallSec    = 0.0;
+    double   cpuSec     = 0.0;
+    double   mainCpuSec = 0.0;
+    uint64_t frames     = 0;
+};
+
+struct FramePacerStatus {
+    PaceMode      mode = PaceMode::ON_DEMAND;
+    bool          canBlock = false;       // input wait with timeout available
+    float         fps = 0.f;              // frames drawn, last minute
+    float         cpuMsPerMin  = -1.f;    // process CPU, last minute (or less after a switch)
+    float         mainMsPerMin = -1.f;    // render thread CPU, same window
+    float         windowSec = 0.f;        // how much of that minute is covered
+    float         allocsPerFrame = 0.f;   // render heap allocations, same window
+    uint64_t      lastFrameAllocs = 0;
+    PaceModeStats total[(int)PaceMode::COUNT];   // since start, per mode
+};
+
+extern FramePacerConfig framePacerConfig;
+
+// Call once per loop iteration. Returns 0 when a frame should be drawn now,
+// otherwise how long to wait for input. dirty = new data or input this pass;
+// nextEvent = when something is due without input (GetTime() clock).
+double FramePacerPlan(double now, bool dirty, bool animating, double nextEvent);
+void   FramePacerFrameDrawn(double now, uint64_t allocs);   // allocs: made while drawing it
+
+// Closes the accounting period of the old mode (and logs its cost) before
+// switching. The caller applies the mode to the window.
+void   FramePacerSetMode(PaceMode mode, double now);
+FramePacerStatus GetFramePacerStatus();
+
+// Blocking wait support. FramePacerCanBlock() is true when the window
+// library's empty-event post is linked in; then FramePacerArmWake() makes a
+// helper thread post one after the timeout, so an event wait returns.
+// Otherwise the caller sleeps in short slices with FramePacerSleep().
+bool   FramePacerCanBlock();
+void   FramePacerArmWake(double seconds);
+void   FramePacerWakeNow();   // any thread: new data, end the current wait now
+void   FramePacerSleep(double seconds);
+void   StopFramePacer();   // before the window closes: no posts after this
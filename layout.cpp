@@ -0,0 +1,48 @@
+#include "layout.h"
+#include <algorithm>
+#include <cmath>
+
+Layout layout;
+int    uiScalePct     = 0;
+int    renderScalePct = 100;
+
+static const int TARGET_MAX = 8192;   // a texture size every GL 3.3 driver takes
+
+bool UpdateLayout() {
+    int fbW = GetRenderWidth(), fbH = GetRenderHeight();
+    if (fbW <= 0 || fbH <= 0) return false;   // minimised: keep the last layout
+
+    float ui = uiScalePct > 0 ? uiScalePct / 100.f : GetWindowScaleDPI().x;
+    if (!(ui > 0.f)) ui = 1.f;
+    // Never a canvas smaller than the designed size: scale the UI down to fit
+    ui = std::min(ui, std::min(fbW / (float)WINDOW_WIDTH, fbH / (float)WINDOW_HEIGHT));
+
+    Layout next;
+    next.uiScale     = ui;
+    next.width       = std::max(WINDOW_WIDTH,  (int)std::lround(fbW / ui));
+    next.height      = std::max(WINDOW_HEIGHT, (int)std::lround(fbH / ui));
+    next.renderScale = std::min(renderScalePct / 100.f, TARGET_MAX / (float)std::max(fbW, fbH));
+    next.targetW     = std::max(1, (int)std::lround(fbW * next.renderScale));
+    next.targetH     = std::max(1, (int)std::lround(fbH * next.renderScale));
+    next.zoom        = next.targetW / (float)next.width;
+
+    if (next.width == layout.width && next.height == layout.height && next.uiScale == layout.uiScale &&
+        next.targetW == layout.targetW && next.targetH == layout.targetH)
+        return false;
+    next.gen = layout.gen + 1;
+    layout = next;
+    return true;
+}
+
+Camera2D LayoutTargetCamera() {
+    Camera2D cam = {};
+    cam.zoom = layout.zoom;
+    return cam;
+}
+
+// Screen coordinates, which are not framebuffer pixels on high-DPI macOS
+Camera2D LayoutScreenCamera() {
+    Camera2D cam = {};
+    cam.zoom = GetScreenWidth() / (float)layout.width;
+    return cam;
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "raylib.h"
+#include "dashboard.h"
+
+// ── Layout ────────────────────────────────────────────────────────────────────
+// Views are laid out on a logical canvas in layout pixels: the window's
+// framebuffer divided by the UI scale, and never smaller than the
+// WINDOW_WIDTH x WINDOW_HEIGHT the panels were designed for (a smaller
+// window lowers the UI scale instead). A bigger canvas gives the views more
+// room, such as a wider log or per-core CPU bars, rather than bigger pixels.
+//
+// The canvas is drawn into an internal render target sized renderScale
+// times the framebuffer, through a camera that maps layout pixels onto it,
+// so text is rasterised at the target's resolution instead of being
+// magnified afterwards. A render scale below 1 trades sharpness for fill
+// rate (the CRT passes shrink with it); above 1 supersamples.
+struct Layout {
+    int   width       = WINDOW_WIDTH;    // canvas, layout pixels
+    int   height      = WINDOW_HEIGHT;
+    float uiScale     = 1.f;             // framebuffer pixels per layout pixel
+    float renderScale = 1.f;             // internal target / framebuffer
+    int   targetW     = WINDOW_WIDTH;    // internal target, pixels
+    int   targetH     = WINDOW_HEIGHT;
+    float zoom        = 1.f;             // target pixels per layout pixel
+    int   gen         = 0;               // bumped on every change
+};
+
+extern Layout layout;
+extern int    uiScalePct;       // dashboard.cfg ui_scale: 0 = monitor DPI, else 50..400
+extern int    renderScalePct;   // dashboard.cfg render_scale: 25..200
+
+// Recomputes the layout from the framebuffer size, the DPI and the two
+// settings. True when it changed; the internal target must then be
+// recreated at targetW x targetH.
+bool UpdateLayout();
+
+// Layout pixels into the internal target / straight into the window
+Camera2D LayoutTargetCamera();
+Camera2D LayoutScreenCamera();
@@ -0,0 +1,383 @@
+// log_tail.cpp - inotify log follower with SSE2 line splitting and off-thread filtering
+// Pure logic, NO raylib/drawing includes (the tail is drawn in dashboard.cpp)
+#include "log_tail.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <regex>
+#include <thread>
+#include <utility>
+
+#if !defined(_WIN32)
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <unistd.h>
+  #include <sys/stat.h>
+  #if defined(__linux__)
+    #include <sys/inotify.h>
+  #endif
+  #if defined(__SSE2__)
+    #include <emmintrin.h>
+    #define TAIL_SSE2 1
+  #endif
+#endif
+
+LogTailConfig logTailConfig;
+
+static std::atomic<uint32_t> s_run{0};   // id of the live tail; older threads exit when it moves on
+static std::mutex            s_mutex;
+static LogTailSnapshot       s_snap;
+
+static void SetError(const std::string& path, const std::string& msg) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    uint64_t gen = s_snap.generation;
+    s_snap = LogTailSnapshot();
+    s_snap.generation = gen + 1;
+    s_snap.path  = path;
+    s_snap.error = msg;
+}
+
+#if !defined(_WIN32)
+static const size_t   CHUNK        = 1 << 20;            // bytes per read
+static const size_t   CARRY_MAX    = 64 * 1024;          // partial line kept between reads
+static const uint64_t BACKLOG_MAX  = 64ull << 20;        // further behind than this: skip ahead
+static const uint64_t START_BACK   = 64 * 1024;          // history shown when the tail starts
+static const int      PUBLISH_MS   = 50;
+
+// ── Newline search ────────────────────────────────────────────────────────────
+// 16 bytes per compare; the scalar loops finish the tail (and are the whole
+// search on non-x86 builds)
+static const char* FindNewline(const char* p, const char* end) {
+#if defined(TAIL_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; end - p >= 16; p += 16) {
+        int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), nl));
+        if (m) return p + __builtin_ctz((unsigned)m);
+    }
+#endif
+    for (; p < end; p++) if (*p == '\n') return p;
+    return end;
+}
+
+// Last '\n' in [begin, p), or nullptr
+static const char* FindNewlineBack(const char* begin, const char* p) {
+#if defined(TAIL_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; p - begin >= 16; p -= 16) {
+        int m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(p - 16)), nl));
+        if (m) return p - 16 + (31 - __builtin_clz((unsigned)m));
+    }
+#endif
+    while (p > begin) if (*--p == '\n') return p;
+    return nullptr;
+}
+
+static uint64_t CountNewlines(const char* p, const char* end) {
+    uint64_t n = 0;
+#if defined(TAIL_SSE2)
+    const __m128i nl = _mm_set1_epi8('\n');
+    for (; end - p >= 16; p += 16)
+        n += __builtin_popcount((unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)p), nl)));
+#endif
+    for (; p < end; p++) n += *p == '\n';
+    return n;
+}
+
+// ── Tail state (owned by the tail thread) ─────────────────────────────────────
+struct Tail {
+    uint32_t      id = 0;
+    LogTailConfig cfg;
+    std::regex    re;
+    int           fd = -1;
+    dev_t         dev = 0;
+    ino_t         ino = 0;
+    uint64_t      offset = 0;
+    bool          resync = false;      // drop everything up to the next newline
+    std::string   carry;
+    std::vector<char> buf;
+    std::vector<std::pair<const char*, const char*>> hits;
+    std::deque<std::string> lines;
+    uint64_t lineCount = 0, matched = 0, bytes = 0, skipped = 0;
+    int      rotations = 0;
+    // Rates
+    std::chrono::steady_clock::time_point rateT, pubT;
+    uint64_t rateBytes = 0, rateLines = 0;
+    float    mbps = 0.f, lps = 0.f;
+    bool     dirty = true;
+#if defined(__linux__)
+    int      ino_fd = -1, fileWd = -1;
+#endif
+};
+
+// Lines [p, end): end is one past a '\n'. Only the last LOG_TAIL_LINES
+// matches can be shown, so those are the only ones turned into strings.
+static void ProcessLines(Tail& t, const char* p, const char* end) {
+    uint64_t n = CountNewlines(p, end);
+    t.lineCount += n;
+    auto& hits = t.hits;
+    hits.clear();
+    auto keep = [&hits]() {
+        if (hits.size() >= (size_t)LOG_TAIL_LINES * 4)
+            hits.erase(hits.begin(), hits.end() - LOG_TAIL_LINES);
+    };
+    if (t.cfg.filter.empty()) {
+        // No filter: walk back from the end, LOG_TAIL_LINES lines at most
+        t.matched += n;
+        const char* e = end - 1;
+        while ((int)hits.size() < LOG_TAIL_LINES) {
+            const char* nl = FindNewlineBack(p, e);
+            hits.push_back({ nl ? nl + 1 : p, e });
+            if (!nl) break;
+            e = nl;
+        }
+        std::reverse(hits.begin(), hits.end());
+    } else if (!t.cfg.regex) {
+        // Substring: search the whole chunk, widen each hit to its line
+        const std::string& f = t.cfg.filter;
+        for (const char* q = p; q < end; ) {
+            const char* h = (const char*)memmem(q, (size_t)(end - q), f.data(), f.size());
+            if (!h) break;
+            const char* nl = FindNewlineBack(q, h);
+            const char* e  = FindNewline(h, end);
+            hits.push_back({ nl ? nl + 1 : q, e });
+            t.matched++;
+            keep();
+            q = e + 1;
+        }
+    } else {
+        for (const char* s = p; s < end; ) {
+            const char* e = FindNewline(s, end);
+            if (std::regex_search(s, e, t.re)) { hits.push_back({ s, e }); t.matched++; keep(); }
+            s = e + 1;
+        }
+    }
+
+    size_t from = hits.size() > (size_t)LOG_TAIL_LINES ? hits.size() - LOG_TAIL_LINES : 0;
+    for (size_t i = from; i < hits.size(); i++) {
+        const char* s = hits[i].first;
+        const char* e = hits[i].second;
+        if (e > s && e[-1] == '\r') e--;
+        t.lines.emplace_back(s, std::min<size_t>((size_t)(e - s), LOG_TAIL_LINE_MAX));
+    }
+    while ((int)t.lines.size() > LOG_TAIL_LINES) t.lines.pop_front();
+    if (!hits.empty()) t.dirty = true;
+}
+
+static void Publish(Tail& t, bool force) {
+    auto now = std::chrono::steady_clock::now();
+    double rdt = std::chrono::duration<double>(now - t.rateT).count();
+    if (rdt >= 1.0) {
+        t.mbps = (float)((t.bytes - t.rateBytes) / rdt / (1024.0 * 1024.0));
+        t.lps  = (float)((t.lineCount - t.rateLines) / rdt);
+        t.rateBytes = t.bytes;
+        t.rateLines = t.lineCount;
+        t.rateT = now;
+        t.dirty = true;
+    }
+    if (!t.dirty) return;
+    if (!force && now - t.pubT < std::chrono::milliseconds(PUBLISH_MS)) return;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_run.load() != t.id) return;
+    LogTailSnapshot& s = s_snap;
+    s.generation++;
+    s.active       = true;
+    s.open         = t.fd >= 0;
+    s.path         = t.cfg.path;
+    s.filter       = t.cfg.filter;
+    s.mbps         = t.mbps;
+    s.linesPerSec  = t.lps;
+    s.lines        = t.lineCount;
+    s.matched      = t.matched;
+    s.skippedBytes = t.skipped;
+    s.rotations    = t.rotations;
+    s.text.assign(t.lines.begin(), t.lines.end());
+    t.pubT  = now;
+    t.dirty = false;
+}
+
+// Reads everything appended since the last call, CHUNK bytes at a time
+static void ReadAppended(Tail& t) {
+    while (t.fd >= 0 && s_run.load() == t.id) {
+        struct stat st;
+        if (fstat(t.fd, &st) != 0) break;
+        uint64_t size = (uint64_t)st.st_size;
+        if (size < t.offset) {
+            // copytruncate rotation: same inode, starts again from zero
+            t.offset = 0;
+            t.carry.clear();
+            t.resync = false;
+            t.rotations++;
+        }
+        if (size - t.offset > BACKLOG_MAX) {
+            // Too far behind to be live: show the newest data, count the rest
+            uint64_t to = size - CHUNK;
+            t.skipped += to - t.offset;
+            t.offset = to;
+            t.carry.clear();
+            t.resync = true;
+        }
+        if (size == t.offset) break;
+
+        size_t c = t.carry.size();
+        memcpy(t.buf.data(), t.carry.data(), c);
+        ssize_t n = pread(t.fd, t.buf.data() + c, CHUNK, (off_t)t.offset);
+        if (n <= 0) break;
+        t.offset += (uint64_t)n;
+        t.bytes  += (uint64_t)n;
+        const char* b = t.buf.data();
+        const char* e = b + c + n;
+        if (t.resync) {
+            const char* nl = FindNewline(b, e);
+            if (nl == e) { t.carry.clear(); continue; }
+            b = nl + 1;
+            t.resync = false;
+        }
+        const char* last = FindNewlineBack(b, e);
+        if (last) {
+            ProcessLines(t, b, last + 1);
+            b = last + 1;
+        }
+        t.carry.assign(b, e);
+        if (t.carry.size() > CARRY_MAX) {
+            // A "line" this long is binary data or a runaway writer: skip to its end
+            t.skipped += t.carry.size();
+            t.carry.clear();
+            t.resync = true;
+        }
+        Publish(t, false);
+    }
+}
+
+static void CloseFile(Tail& t) {
+    if (t.fd < 0) return;
+    close(t.fd);
+    t.fd = -1;
+#if defined(__linux__)
+    if (t.fileWd >= 0) inotify_rm_watch(t.ino_fd, t.fileWd);
+    t.fileWd = -1;
+#endif
+}
+
+static bool OpenFile(Tail& t, bool fromEnd) {
+    int fd = open(t.cfg.path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) { close(fd); return false; }
+    t.fd  = fd;
+    t.dev = st.st_dev;
+    t.ino = st.st_ino;
+    uint64_t size = (uint64_t)st.st_size;
+    t.offset = fromEnd && size > START_BACK ? size - START_BACK : 0;
+    t.resync = t.offset > 0;
+    t.carry.clear();
+#if defined(__linux__)
+    if (t.ino_fd >= 0) t.fileWd = inotify_add_watch(t.ino_fd, t.cfg.path.c_str(), IN_MODIFY);
+#endif
+    t.dirty = true;
+    return true;
+}
+
+// Rename / delete + create rotation: the path now names a different inode.
+// Whatever was still appended to the old file is read before switching.
+static void CheckRotation(Tail& t) {
+    struct stat st;
+    if (stat(t.cfg.path.c_str(), &st) != 0) return;   // gone; the writer recreates it shortly
+    if (t.fd >= 0 && st.st_dev == t.dev && st.st_ino == t.ino) return;
+    if (t.fd >= 0) {
+        ReadAppended(t);
+        CloseFile(t);
+        t.rotations++;
+        OpenFile(t, false);
+    } else {
+        OpenFile(t, t.rotations == 0 && t.lineCount == 0);
+    }
+}
+
+// Sleeps until the file or its directory changes, or timeoutMs passes
+static void WaitForChange(Tail& t, int timeoutMs) {
+#if defined(__linux__)
+    if (t.ino_fd >= 0) {
+        struct pollfd pfd = { t.ino_fd, POLLIN, 0 };
+        if (poll(&pfd, 1, timeoutMs) > 0) {
+            alignas(struct inotify_event) char ev[4096];
+            while (read(t.ino_fd, ev, sizeof(ev)) > 0) {}   // contents don't matter: re-check everything
+        }
+        return;
+    }
+#endif
+    std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+}
+
+static void TailThread(uint32_t id, LogTailConfig cfg) {
+    Tail t;
+    t.id  = id;
+    t.cfg = cfg;
+    if (cfg.regex) t.re = std::regex(cfg.filter, std::regex::ECMAScript | std::regex::optimize);
+    t.buf.resize(CARRY_MAX + CHUNK);
+    t.rateT = t.pubT = std::chrono::steady_clock::now();
+#if defined(__linux__)
+    t.ino_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (t.ino_fd >= 0) {
+        // The directory watch sees rotation: rename away, create, move into place
+        std::string dir = cfg.path.substr(0, cfg.path.find_last_of('/') + 1);
+        if (dir.empty()) dir = ".";
+        inotify_add_watch(t.ino_fd, dir.c_str(), IN_CREATE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE);
+    }
+#endif
+    OpenFile(t, true);
+    while (s_run.load() == id) {
+        ReadAppended(t);
+        CheckRotation(t);
+        Publish(t, true);
+        WaitForChange(t, 250);
+    }
+    CloseFile(t);
+#if defined(__linux__)
+    if (t.ino_fd >= 0) close(t.ino_fd);
+#endif
+}
+#endif // !_WIN32
+
+// ── Public API ────────────────────────────────────────────────────────────────
+void StartLogTail() {
+    uint32_t id = ++s_run;
+    LogTailConfig cfg = logTailConfig;
+    if (cfg.path.empty()) { SetError("", ""); return; }
+#if defined(_WIN32)
+    SetError(cfg.path, "NOT SUPPORTED ON WINDOWS YET");
+#else
+    if (cfg.regex) {
+        try { std::regex check(cfg.filter); }
+        catch (const std::regex_error&) { SetError(cfg.path, "BAD FILTER REGEX: " + cfg.filter); return; }
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        uint64_t gen = s_snap.generation;
+        s_snap = LogTailSnapshot();
+        s_snap.generation = gen + 1;
+        s_snap.active = true;
+        s_snap.path   = cfg.path;
+        s_snap.filter = cfg.filter;
+    }
+    std::thread(TailThread, id, cfg).detach();
+#endif
+}
+
+void StopLogTail() {
+    ++s_run;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_snap.generation++;
+    s_snap.active = false;
+    s_snap.open   = false;
+}
+
+bool GetLogTail(LogTailSnapshot& snap) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (snap.generation == s_snap.generation) return false;
+    snap = s_snap;
+    return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ── Log file tail ─────────────────────────────────────────────────────────────
+// Follows one text file (e.g. /var/log/syslog) from a background thread:
+// inotify wakes it on appends and on rotation (rename or delete + create,
+// copytruncate), appended data is read in 1 MB chunks and split with an SSE2
+// newline search, and the optional filter runs there too. The render thread
+// only ever copies the last few matching lines. POSIX only; inotify on Linux,
+// a 250 ms stat poll elsewhere.
+static const int LOG_TAIL_LINES   = 200;   // matching lines kept for display
+static const int LOG_TAIL_LINE_MAX = 400;  // longer lines are cut
+
+struct LogTailConfig {
+    std::string path;                      // empty = tail off
+    std::string filter;                    // substring, or ECMAScript regex when regex is set
+    bool        regex = false;
+};
+
+struct LogTailSnapshot {
+    uint64_t    generation = 0;            // bumped on every publish
+    bool        active  = false;           // thread running
+    bool        open    = false;           // file currently open
+    std::string path, filter, error;
+    float       mbps        = 0.f;         // appended data, last second
+    float       linesPerSec = 0.f;
+    uint64_t    lines   = 0, matched = 0;  // since the tail started
+    uint64_t    skippedBytes = 0;          // backlog dropped to stay live
+    int         rotations = 0;
+    std::vector<std::string> text;         // oldest first, at most LOG_TAIL_LINES
+};
+
+extern LogTailConfig logTailConfig;
+
+// (Re)starts the tail with logTailConfig; stops it when the path is empty
+void StartLogTail();
+void StopLogTail();
+// Copies the current state into snap unless snap is already at the latest
+// generation. Returns true when snap changed. Cheap enough for every frame.
+bool GetLogTail(LogTailSnapshot& snap);
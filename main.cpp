@@ -1,4 +1,5 @@
 #include "raylib.h"
+#include "rlgl.h"
 #include "theme.h"
 #include "dashboard.h"
 #include "ui_menus.h"
@@ -6,9 +7,27 @@
 #include "config.h"
 #include "system_monitor.h"
 #include "speedtest.h"
+#include "speedtest_history.h"
 #include "stress_test.h"
+#include "mem_stress.h"
+#include "disk_bench.h"
+#include "psi.h"
+#include "cgroup.h"
+#include "du_scan.h"
+#include "log_tail.h"
+#include "event_log.h"
+#include "frame_pacer.h"
+#include "alloc_counter.h"
+#include "text_cache.h"
+#include "crt_quality.h"
+#include "render_bench.h"
+#include "layout.h"
+#include "collector.h"
 #include <string>
 #include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <cmath>
 
 // ── HandleMenuSelection ───────────────────────────────────────────────────────
 // Defined here (not dashboard.cpp) to avoid circular includes with ui_menus/terminal
@@ -26,9 +45,7 @@ void HandleMenuSelection() {
             stats.useRealData = true;
             showMenu = false;
             AddLogEntry("[MENU] Real-time monitoring ENABLED", CYAN_HIGHLIGHT);
-            stats.targetCpu  = GetRealCPUUsage();
-            stats.targetRam  = GetRealRAMUsage();
-            stats.targetDisk = GetRealDiskUsage();
+            TriggerStatsCollectors();
             break;
 
         case MENU_NETWORK_TEST:
@@ -43,6 +60,25 @@ void HandleMenuSelection() {
             AddLogEntry("[MENU] System Information", CYAN_HIGHLIGHT);
             break;
 
+        case MENU_MEMORY:
+            currentMenu = MENU_MEMORY;
+            showMenu = false;
+            AddLogEntry("[MENU] Memory detail", CYAN_HIGHLIGHT);
+            break;
+
+        case MENU_BENCHMARKS:
+            currentMenu = MENU_BENCHMARKS;
+            showMenu = false;
+            AddLogEntry("[MENU] Benchmarks", CYAN_HIGHLIGHT);
+            break;
+
+        case MENU_CGROUPS:
+            currentMenu = MENU_CGROUPS;
+            showMenu = false;
+            cgroupScroll = 0;
+            AddLogEntry("[MENU] cgroups", CYAN_HIGHLIGHT);
+            break;
+
         case MENU_CUSTOMIZE_WIDGETS:
             showWidgetMenu = true;
             showMenu = false;
@@ -65,22 +101,361 @@ void HandleMenuSelection() {
     }
 }
 
+// ── Frame pacing ──────────────────────────────────────────────────────────────
+static void ApplyPaceMode() {
+    switch (framePacerConfig.mode) {
+        case PaceMode::FIXED:
+            ClearWindowState(FLAG_VSYNC_HINT);
+            SetTargetFPS(framePacerConfig.fps);
+            break;
+        case PaceMode::VSYNC:
+            SetWindowState(FLAG_VSYNC_HINT);
+            SetTargetFPS(0);
+            break;
+        default:
+            // The pacer decides when to draw; EndDrawing must not sleep too
+            ClearWindowState(FLAG_VSYNC_HINT);
+            SetTargetFPS(0);
+            break;
+    }
+}
+
+// ── CRT post-processing ───────────────────────────────────────────────────────
+static Shader          s_crtFull, s_crtLite, s_crtGlow;
+static int             s_fullTimeLoc, s_fullTintLoc, s_fullGlowLoc, s_liteTintLoc;
+static RenderTexture2D s_glowTarget;
+
+// Next to the executable first, then the working directory
+static Shader LoadPostShader(const char* file) {
+    std::string path = std::string(GetApplicationDirectory()) + "resources/shaders/" + file;
+    Shader sh = LoadShader(0, path.c_str());
+    if (sh.id == 0) sh = LoadShader(0, (std::string("resources/shaders/") + file).c_str());
+    return sh;
+}
+
+static void LoadCrtPipeline() {
+    s_crtFull = LoadPostShader("crt.fsh");
+    s_crtLite = LoadPostShader("crt_lite.fsh");
+    s_crtGlow = LoadPostShader("crt_glow.fsh");
+    s_fullTimeLoc = GetShaderLocation(s_crtFull, "time");
+    s_fullTintLoc = GetShaderLocation(s_crtFull, "phosphorTint");
+    s_fullGlowLoc = GetShaderLocation(s_crtFull, "glowTexture");
+    s_liteTintLoc = GetShaderLocation(s_crtLite, "phosphorTint");
+}
+
+// After a layout change. Scanlines follow the canvas, one per layout pixel
+// row whatever the render scale; the glow's taps are target texels.
+static void ResizeCrtPipeline() {
+    float canvas[2] = { (float)layout.width, (float)layout.height };
+    float texels[2] = { (float)layout.targetW, (float)layout.targetH };
+    SetShaderValue(s_crtFull, GetShaderLocation(s_crtFull, "resolution"), canvas, SHADER_UNIFORM_VEC2);
+    SetShaderValue(s_crtLite, GetShaderLocation(s_crtLite, "resolution"), canvas, SHADER_UNIFORM_VEC2);
+    SetShaderValue(s_crtGlow, GetShaderLocation(s_crtGlow, "resolution"), texels, SHADER_UNIFORM_VEC2);
+
+    // Bilinear, so the composite pass upsamples it smoothly
+    if (s_glowTarget.id) UnloadRenderTexture(s_glowTarget);
+    s_glowTarget = LoadRenderTexture(std::max(1, layout.targetW / 2), std::max(1, layout.targetH / 2));
+    SetTextureFilter(s_glowTarget.texture, TEXTURE_FILTER_BILINEAR);
+}
+
+static void UnloadCrtPipeline() {
+    UnloadShader(s_crtFull);
+    UnloadShader(s_crtLite);
+    UnloadShader(s_crtGlow);
+    if (s_glowTarget.id) UnloadRenderTexture(s_glowTarget);
+    s_glowTarget = {};
+}
+
+// FULL only: the glow at half resolution, before the window pass samples it.
+// Flipped like the window pass, so both sample the frame with the same uv.
+static void RenderCrtGlow(const RenderTexture2D& target) {
+    Rectangle src = { 0, 0, (float)target.texture.width, (float)-target.texture.height };
+    Rectangle dst = { 0, 0, (float)s_glowTarget.texture.width, (float)s_glowTarget.texture.height };
+    BeginTextureMode(s_glowTarget);
+        BeginShaderMode(s_crtGlow);
+            DrawTexturePro(target.texture, src, dst, {0, 0}, 0.f, WHITE);
+        EndShaderMode();
+    EndTextureMode();
+}
+
+// The frame into the whole window through the tier's shader; the layout
+// already has the window's aspect ratio
+static void DrawCrtFrame(const RenderTexture2D& target, CrtQuality tier) {
+    float tint[3] = {
+        PALETTES[currentTheme].primary.r / 255.f,
+        PALETTES[currentTheme].primary.g / 255.f,
+        PALETTES[currentTheme].primary.b / 255.f
+    };
+    if (tier == CrtQuality::FULL) {
+        SetShaderValue(s_crtFull, s_fullTimeLoc, &timeAccumulator, SHADER_UNIFORM_FLOAT);
+        SetShaderValue(s_crtFull, s_fullTintLoc, tint, SHADER_UNIFORM_VEC3);
+        BeginShaderMode(s_crtFull);
+        SetShaderValueTexture(s_crtFull, s_fullGlowLoc, s_glowTarget.texture);   // inside the mode, per raylib
+    } else if (tier == CrtQuality::LITE) {
+        SetShaderValue(s_crtLite, s_liteTintLoc, tint, SHADER_UNIFORM_VEC3);
+        BeginShaderMode(s_crtLite);
+    }
+
+    Rectangle src = { 0, 0, (float)target.texture.width, (float)-target.texture.height };
+    Rectangle dst = { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() };
+    DrawTexturePro(target.texture, src, dst, {0, 0}, 0.f, WHITE);
+
+    if (tier != CrtQuality::OFF) EndShaderMode();
+    else                         rlDrawRenderBatchActive();   // so a timed pass includes the copy
+}
+
+// AUTO's budget: a quarter of the display's frame time (of the FPS cap in
+// FIXED mode, when that is faster)
+static double CrtBudgetMs() {
+    int hz = GetMonitorRefreshRate(GetCurrentMonitor());
+    if (hz <= 0) hz = 60;
+    if (framePacerConfig.mode == PaceMode::FIXED) hz = std::max(hz, framePacerConfig.fps);
+    return 250.0 / hz;
+}
+
+// One frame: the dashboard into the render texture, then through the CRT
+// tier to the window with the overlays on top. timeCrt: bracket the CRT
+// passes with GPU waits and report their cost to AUTO.
+static void RenderFrame(const RenderTexture2D& target, CrtQuality tier, bool timeCrt, double now) {
+    BeginTextureMode(target);
+        BeginMode2D(LayoutTargetCamera());
+            DrawDashboard();
+        EndMode2D();
+    EndTextureMode();
+
+    bool   timed     = timeCrt && CrtGpuFinish();
+    double passStart = GetTime();
+    if (tier == CrtQuality::FULL) RenderCrtGlow(target);
+
+    BeginDrawing();
+        ClearBackground(COLOR_BLACK);
+        DrawCrtFrame(target, tier);
+        if (timed && CrtGpuFinish())
+            CrtQualityReport((GetTime() - passStart) * 1000.0, CrtBudgetMs(), now);
+
+        // Overlays drawn AFTER shader - no CRT tint applied to them
+        BeginMode2D(LayoutScreenCamera());
+            DrawColorMenu();
+            DrawWidgetMenu();
+            DrawOnboarding();
+            DrawTerminal();
+        EndMode2D();
+
+    EndDrawing();
+}
+
+// ── Layout ────────────────────────────────────────────────────────────────────
+static int s_fontBase = 0;
+
+// The VGA font rasterised near the size it ends up on screen, so a zoomed
+// layout draws sharp glyphs instead of magnifying a 32 px atlas
+static void LoadRetroFont(int baseSize) {
+    if (baseSize == s_fontBase) return;
+    Font font = LoadFontEx("resources/fonts/VGA.ttf", baseSize, nullptr, 0);
+    if (font.texture.id == 0 && hasCustomFont) return;   // keep the one we have
+    if (hasCustomFont) UnloadFont(retroFont);
+    hasCustomFont = font.texture.id > 0;
+    retroFont     = hasCustomFont ? font : GetFontDefault();
+    s_fontBase    = baseSize;
+    InitTextCache(retroFont, hasCustomFont);
+}
+
+// The internal target and everything sized from it, after UpdateLayout()
+static void ApplyLayout(RenderTexture2D& target) {
+    if (target.id) UnloadRenderTexture(target);
+    target = LoadRenderTexture(layout.targetW, layout.targetH);
+    // Point sampling is exact at 1:1; any other render scale is resampled
+    SetTextureFilter(target.texture, layout.targetW == GetRenderWidth() ? TEXTURE_FILTER_POINT
+                                                                        : TEXTURE_FILTER_BILINEAR);
+    ResizeCrtPipeline();
+    LoadRetroFont(32 * std::min(4, std::max(1, (int)std::lround(layout.zoom))));
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "[DISPLAY] Layout %dx%d  UI %.2fx  render %dx%d", layout.width, layout.height,
+             layout.uiScale, layout.targetW, layout.targetH);
+    AddLogEntry(msg, DIM_GREEN);
+}
+
+// ── --bench-render ────────────────────────────────────────────────────────────
+// A fixed scenario on simulated data with default settings (dashboard.cfg is
+// not read): every main view at every CRT tier and theme, the terminal with
+// full scrollback, then every widget combination. No vsync, no pacing. A frame
+// is timed from the start of drawing until the GPU has finished it, so
+// software GL (llvmpipe) gives comparable numbers.
+static const int BENCH_VIEW_FRAMES   = 30;   // per view, tier and theme
+static const int BENCH_WIDGET_FRAMES = 2;    // per widget combination: rebuild, then replay
+
+static void BenchFrame(const RenderTexture2D& target, CrtQuality tier, bool changed) {
+    const float dt = 1.f / 60.f;
+    timeAccumulator += dt;
+    menuBlinkTimer  += dt;
+    UpdateStats(dt);
+
+    uint64_t allocsBefore = ThreadAllocCount();
+    double   start        = GetTime();
+    RenderFrame(target, tier, false, 0.0);
+    CrtGpuFinish();
+    RenderBenchAddFrame((GetTime() - start) * 1000.0, ThreadAllocCount() - allocsBefore, changed);
+}
+
+// Terminal output at its 200-line cap, varied lengths like real command output
+static void FillBenchScrollback() {
+    TerminalTab& t = tabs[0];
+    t.cwd  = "/home/bench";
+    t.name = "Tab 1";
+    t.output.clear();
+    char line[160];
+    for (int i = 0; (int)t.output.size() < 200; i++) {
+        if (i % 25 == 0)
+            snprintf(line, sizeof(line), "> %s $ ls -la /var/log/bench/%d", t.cwd.c_str(), i / 25);
+        else
+            snprintf(line, sizeof(line), "-rw-r--r--  1 bench bench %8d Oct %2d 12:%02d  trace-%04d.log%s",
+                     (i * 7919) % 10000000, 1 + i % 28, i % 60, i,
+                     i % 3 ? "" : "   (rotated, compressed with zstd level 19, checksum ok)");
+        t.output.push_back(line);
+    }
+    t.input = "tail -f trace-0042.log";
+}
+
+// An hour of varied samples, so the history graphs draw at full length
+static void FillBenchHistory() {
+    for (int i = 0; i < 3600; i++)
+        PushMetricHistory(50.f + 35.f * sinf(i * 0.013f) + (float)(i * 7919 % 11),
+                          62.f + 8.f * sinf(i * 0.002f),
+                          i % 300 < 20 ? 8000.f + (float)(i * 31 % 4000) : 40.f + (float)(i * 13 % 90));
+}
+
+static int RunRenderBench(const char* outPath) {
+    ClearWindowState(FLAG_VSYNC_HINT);
+    SetTargetFPS(0);
+    InitializeStats();
+    SetRandomSeed(1);
+    InitializeSystemMonitoring();
+    LoadCrtPipeline();
+    RenderTexture2D target = {};
+    UpdateLayout();
+    ApplyLayout(target);
+    FillBenchScrollback();
+    FillBenchHistory();
+
+    struct BenchView { const char* name; int menu; bool terminal; };
+    const BenchView views[] = {
+        { "dashboard",   MENU_DASHBOARD,    false },
+        { "system_info", MENU_SYSTEM_INFO,  false },
+        { "network",     MENU_NETWORK_TEST, false },
+        { "terminal",    MENU_DASHBOARD,    true  },
+    };
+    const CrtQuality tiers[] = { CrtQuality::OFF, CrtQuality::LITE, CrtQuality::FULL };
+    char name[64];
+
+    for (CrtQuality tier : tiers) {
+        for (const BenchView& v : views) {
+            snprintf(name, sizeof(name), "%s/%s", v.name, CRT_QUALITY_NAMES[(int)tier]);
+            RenderBenchBeginScene(name);
+            currentMenu  = v.menu;
+            showTerminal = v.terminal;
+            for (int theme = 0; theme < THEME_COUNT; theme++) {
+                ApplyColorTheme(theme);
+                for (int f = 0; f < BENCH_VIEW_FRAMES; f++) BenchFrame(target, tier, f == 0);
+            }
+        }
+    }
+
+    // Every widget on/off combination on the dashboard, themes in rotation
+    RenderBenchBeginScene("widgets/FULL");
+    currentMenu  = MENU_DASHBOARD;
+    showTerminal = false;
+    bool* ws[WIDGET_COUNT];
+    GetWidgetStates(ws);
+    for (int mask = 0; mask < (1 << WIDGET_COUNT); mask++) {
+        for (int w = 0; w < WIDGET_COUNT; w++) *ws[w] = (mask >> w) & 1;
+        ApplyColorTheme(mask % THEME_COUNT);
+        for (int f = 0; f < BENCH_WIDGET_FRAMES; f++) BenchFrame(target, CrtQuality::FULL, f == 0);
+    }
+
+    TextCacheStats tc = GetTextCacheStats();
+    RenderBenchSetCounter("text_cache_hits",    tc.hits);
+    RenderBenchSetCounter("text_cache_misses",  tc.misses);
+    RenderBenchSetCounter("text_cache_flushes", tc.flushes);
+    RenderBenchSetCounter("alloc_total_process", TotalAllocCount());
+    bool ok = RenderBenchWriteJson(outPath);
+    if (!ok) fprintf(stderr, "bench-render: could not write %s\n", outPath ? outPath : "stdout");
+
+    UnloadMetricHistory();
+    UnloadRenderTexture(target);
+    UnloadCrtPipeline();
+    CleanupSystemMonitoring();
+    return ok ? 0 : 1;
+}
+
+// Input since the last poll. Runs after the handlers, so draining the key
+// and char queues here loses nothing: the next poll clears them anyway.
+static bool InputThisFrame() {
+    Vector2 md = GetMouseDelta();
+    return GetKeyPressed() != 0 || GetCharPressed() != 0 || IsWindowResized()
+        || md.x != 0.f || md.y != 0.f || GetMouseWheelMove() != 0.f
+        || IsMouseButtonPressed(MOUSE_BUTTON_LEFT) || IsMouseButtonPressed(MOUSE_BUTTON_RIGHT);
+}
+
+// Skipped frame: wait for input or the timeout, then poll. EndDrawing is
+// what normally polls, and it is not called for a frame that is not drawn.
+static void WaitForInput(double seconds) {
+    if (FramePacerCanBlock()) {
+        FramePacerArmWake(seconds);
+        EnableEventWaiting();
+        PollInputEvents();
+        DisableEventWaiting();
+    } else {
+        FramePacerSleep(seconds < 1.0 / 60.0 ? seconds : 1.0 / 60.0);
+        PollInputEvents();
+    }
+}
+
 // ── main ──────────────────────────────────────────────────────────────────────
-int main() {
+int main(int argc, char** argv) {
+    // --bench-render [--bench-out FILE]: see RunRenderBench
+    bool        benchRender = false;
+    const char* benchOut    = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if      (!strcmp(argv[i], "--bench-render"))           benchRender = true;
+        else if (!strcmp(argv[i], "--bench-out") && i + 1 < argc) benchOut = argv[++i];
+    }
+    if (benchRender) {
+        // Fixed 1280x720 canvas, so runs on different machines compare
+        uiScalePct = 100;
+        SetConfigFlags(FLAG_WINDOW_HIDDEN);
+        // raylib logs to stdout; keep it clean when the JSON goes there
+        SetTraceLogLevel(benchOut ? LOG_WARNING : LOG_NONE);
+    } else {
+        SetConfigFlags(FLAG_WINDOW_RESIZABLE);
+    }
+
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, WINDOW_TITLE);
+    SetWindowMinSize(WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2);
     SetExitKey(KEY_NULL);
 
-    // Font
-    retroFont = LoadFont("resources/fonts/VGA.ttf");
-    hasCustomFont = (retroFont.texture.id > 0);
-    if (!hasCustomFont) retroFont = GetFontDefault();
+    if (benchRender) {
+        int rc = RunRenderBench(benchOut);
+        if (hasCustomFont) UnloadFont(retroFont);
+        CloseWindow();
+        return rc;
+    }
 
     // Config (sets isFirstRun, currentTheme, widget states)
     LoadConfig();
+    if (!eventLogFile.empty())
+        StartEventLogWriter(eventLogFile[0] == '/' ? eventLogFile : std::string(GetApplicationDirectory()) + eventLogFile);
     ApplyColorTheme(currentTheme);
+    ApplyPaceMode();
 
     InitializeStats();
     InitializeSystemMonitoring();
+    SetCollectorNotify(FramePacerWakeNow);
+    StartStatsCollectors();
+    StartPsiMonitor();
+    StartLogTail();
+    LoadSpeedTestHistory();
+    if (speedTestSchedule.enabled) StartSpeedTestScheduler();
 
     // Onboarding on first run
     if (isFirstRun) {
@@ -89,29 +464,29 @@ int main() {
         selectedTheme  = THEME_GREEN_PHOSPHOR;
     }
 
-    // Shader
-    const char* appDir = GetApplicationDirectory();
-    std::string shaderPath = std::string(appDir) + "resources/shaders/crt.fsh";
-    Shader crtShader = LoadShader(0, shaderPath.c_str());
-    if (crtShader.id == 0)
-        crtShader = LoadShader(0, "resources/shaders/crt.fsh");
-
-    int resLoc  = GetShaderLocation(crtShader, "resolution");
-    int timeLoc = GetShaderLocation(crtShader, "time");
-    int tintLoc = GetShaderLocation(crtShader, "phosphorTint");
-
-    RenderTexture2D target = LoadRenderTexture(WINDOW_WIDTH, WINDOW_HEIGHT);
-    float res[2] = { (float)WINDOW_WIDTH, (float)WINDOW_HEIGHT };
-    SetShaderValue(crtShader, resLoc, res, SHADER_UNIFORM_VEC2);
+    // Shaders, internal target and font, sized from the window
+    LoadCrtPipeline();
+    RenderTexture2D target = {};
+    UpdateLayout();
+    ApplyLayout(target);
 
     AddLogEntry("[SYSTEM] Dashboard ready. Press TAB to open menu.", CYAN_HIGHLIGHT);
 
     // ── Main loop ─────────────────────────────────────────────────────────────
+    double lastTime = GetTime();
     while (!WindowShouldClose()) {
-        float dt = GetFrameTime();
+        // Measured here rather than with GetFrameTime(): frames the pacer
+        // skips never reach EndDrawing, which is what updates that
+        double now = GetTime();
+        float  dt  = (float)(now - lastTime);
+        lastTime = now;
         timeAccumulator += dt;
         menuBlinkTimer  += dt;
 
+        // The cgroup walker only runs while its view is open
+        if (currentMenu == MENU_CGROUPS) StartCgroupWalker();
+        else                             StopCgroupWalker();
+
         // ── F11: borderless fullscreen toggle (no black flash, no title bar) ─
         if (IsKeyPressed(KEY_F11)) {
             if (!IsWindowState(FLAG_BORDERLESS_WINDOWED_MODE)) {
@@ -125,6 +500,31 @@ int main() {
             }
         }
 
+        // ── F8: cycle frame pacing (fixed FPS / vsync / on demand) ────────
+        if (IsKeyPressed(KEY_F8)) {
+            FramePacerSetMode((PaceMode)(((int)framePacerConfig.mode + 1) % (int)PaceMode::COUNT), now);
+            ApplyPaceMode();
+            SaveConfig();
+            AddLogEntry(std::string("[PACE] ") + PACE_MODE_NAMES[(int)framePacerConfig.mode], DIM_GREEN);
+        }
+
+        // ── F9: cycle CRT quality (off / lite / full / auto) ───────────────
+        if (IsKeyPressed(KEY_F9)) {
+            crtQuality = (CrtQuality)(((int)crtQuality + 1) % (int)CrtQuality::COUNT);
+            SaveConfig();
+            AddLogEntry(std::string("[CRT] ") + CRT_QUALITY_NAMES[(int)crtQuality], DIM_GREEN);
+        }
+
+        // ── F10: cycle render scale (internal target vs the window) ───────
+        if (IsKeyPressed(KEY_F10)) {
+            static const int SCALES[] = { 50, 75, 100, 150, 200 };
+            int next = SCALES[0];
+            for (int pct : SCALES) if (pct > renderScalePct) { next = pct; break; }
+            renderScalePct = next;
+            SaveConfig();
+            AddLogEntry("[DISPLAY] Render scale " + std::to_string(renderScalePct) + "%", DIM_GREEN);
+        }
+
         // ── Ctrl+Escape: quit ─────────────────────────────────────────────
         if (IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)) {
             if (IsKeyPressed(KEY_ESCAPE)) break;
@@ -245,12 +645,38 @@ int main() {
                 } else {
                     if (!stats.useRealData) {
                         AddLogEntry("[STRESS] Enable real monitoring first (menu)", YELLOW_ALERT);
+                    } else if (coreLatencyState == StressTestState::RUNNING) {
+                        AddLogEntry("[STRESS] Core-to-core test is running", YELLOW_ALERT);
                     } else {
                         StartStressTest(30);
-                        AddLogEntry("[STRESS] CPU stress test started (30s)", AMBER_PHOSPHOR);
+                        AddLogEntry(std::string("[STRESS] CPU stress test started (30s, ") +
+                                    STRESS_WORKLOAD_NAMES[(int)stressWorkload] + ")", AMBER_PHOSPHOR);
                     }
                 }
             }
+            // F7: cycle load shape 100% -> 70% -> 35% -> step ramp -> sawtooth (idle only)
+            if (IsKeyPressed(KEY_F7) && stressState != StressTestState::RUNNING) {
+                StressLoadProfile& lp = stressLoad;
+                if      (lp.ramp == StressRamp::SAWTOOTH) { lp.ramp = StressRamp::CONSTANT; lp.targetPct = 100; }
+                else if (lp.ramp == StressRamp::STEP)     lp.ramp = StressRamp::SAWTOOTH;
+                else if (lp.targetPct > 70)               lp.targetPct = 70;
+                else if (lp.targetPct > 35)               lp.targetPct = 35;
+                else                                      lp.ramp = StressRamp::STEP;
+                char msg[64];
+                if (lp.ramp == StressRamp::CONSTANT) snprintf(msg, sizeof(msg), "[STRESS] Load: %d%%", lp.targetPct);
+                else snprintf(msg, sizeof(msg), "[STRESS] Load: %s ramp %d-%d%%",
+                              STRESS_RAMP_NAMES[(int)lp.ramp], lp.rampFromPct, lp.rampToPct);
+                AddLogEntry(msg, AMBER_PHOSPHOR);
+                SaveConfig();
+            }
+            // F6: cycle stress workload kernel (idle only)
+            if (IsKeyPressed(KEY_F6) && stressState != StressTestState::RUNNING) {
+                stressWorkload = (StressWorkload)(((int)stressWorkload + 1) % (int)StressWorkload::COUNT);
+                std::string msg = std::string("[STRESS] Workload: ") + STRESS_WORKLOAD_NAMES[(int)stressWorkload];
+                if (stressWorkload == StressWorkload::SIMD_FMA) msg += std::string(" (") + GetStressSimdPath() + ")";
+                AddLogEntry(msg, AMBER_PHOSPHOR);
+                SaveConfig();
+            }
 
             // TAB always toggles the menu overlay
             if (IsKeyPressed(KEY_TAB)) {
@@ -266,7 +692,33 @@ int main() {
                 if (IsKeyPressed(KEY_ESCAPE)) showMenu = false;
             }
             // View-specific keys when menu is closed
+            else if (currentMenu == MENU_SYSTEM_INFO && showDiskUsage) {
+                if (IsKeyPressed(KEY_UP))   duSelected--;
+                if (IsKeyPressed(KEY_DOWN)) duSelected++;
+                if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_RIGHT)) { DuEnter(duSelected); duSelected = 0; }
+                if (IsKeyPressed(KEY_BACKSPACE) || IsKeyPressed(KEY_LEFT)) { DuLeave(); duSelected = 0; }
+                if (IsKeyPressed(KEY_X) && duScanState == DuScanState::RUNNING) {
+                    StopDuScan();
+                    AddLogEntry("[DU] Scan cancelled", AMBER_PHOSPHOR);
+                }
+                if (IsKeyPressed(KEY_ESCAPE)) {
+                    StopDuScan();
+                    showDiskUsage = false;
+                }
+            }
             else if (currentMenu == MENU_SYSTEM_INFO) {
+                if (IsKeyPressed(KEY_UP))   siDriveSel--;
+                if (IsKeyPressed(KEY_DOWN)) siDriveSel++;
+                if (IsKeyPressed(KEY_ENTER)) {
+                    std::vector<DiskInfo> drives = GetAllDrives();
+                    if (!drives.empty()) {
+                        const DiskInfo& drv = drives[std::min(std::max(siDriveSel, 0), (int)drives.size() - 1)];
+                        StartDuScan(drv.mountPoint);
+                        showDiskUsage = true;
+                        duSelected    = 0;
+                        AddLogEntry("[DU] Scanning " + drv.mountPoint, AMBER_PHOSPHOR);
+                    }
+                }
                 if (IsKeyPressed(KEY_ESCAPE)) {
                     currentMenu = MENU_DASHBOARD;
                     AddLogEntry("[MENU] Returned to dashboard", DIM_GREEN);
@@ -280,59 +732,184 @@ int main() {
                 if (IsKeyPressed(KEY_S)) {
                     SaveSpeedTestResult();
                     if (speedTestHasSaved)
-                        AddLogEntry("[SPEEDTEST] Result saved to speedtest_results.txt", CYAN_HIGHLIGHT);
+                        AddLogEntry("[SPEEDTEST] Result saved to speedtest_history.bin", CYAN_HIGHLIGHT);
+                }
+                if (IsKeyPressed(KEY_H)) showSpeedHistory = !showSpeedHistory;
+                if (IsKeyPressed(KEY_A)) {
+                    speedTestSchedule.enabled = !speedTestSchedule.enabled;
+                    if (speedTestSchedule.enabled) StartSpeedTestScheduler();
+                    else                           StopSpeedTestScheduler();
+                    SaveConfig();
+                    AddLogEntry(speedTestSchedule.enabled ? "[SPEEDTEST] Scheduled tests ON"
+                                                          : "[SPEEDTEST] Scheduled tests OFF", CYAN_HIGHLIGHT);
                 }
                 if (IsKeyPressed(KEY_ESCAPE)) {
                     currentMenu = MENU_DASHBOARD;
                     AddLogEntry("[NET] Returned to dashboard", DIM_GREEN);
                 }
             }
+            else if (currentMenu == MENU_MEMORY) {
+                if (IsKeyPressed(KEY_LEFT))  memPage = (memPage - 1 + MEM_PAGE_COUNT) % MEM_PAGE_COUNT;
+                if (IsKeyPressed(KEY_RIGHT)) memPage = (memPage + 1) % MEM_PAGE_COUNT;
+                if (IsKeyPressed(KEY_ESCAPE)) {
+                    currentMenu = MENU_DASHBOARD;
+                    AddLogEntry("[MENU] Returned to dashboard", DIM_GREEN);
+                }
+            }
+            else if (currentMenu == MENU_CGROUPS) {
+                if (IsKeyPressed(KEY_S)) cgroupSort = (CgroupSort)(((int)cgroupSort.load() + 1) % (int)CgroupSort::COUNT);
+                if (IsKeyPressed(KEY_UP))   cgroupScroll--;
+                if (IsKeyPressed(KEY_DOWN)) cgroupScroll++;
+                if (IsKeyPressed(KEY_ESCAPE)) {
+                    currentMenu = MENU_DASHBOARD;
+                    AddLogEntry("[MENU] Returned to dashboard", DIM_GREEN);
+                }
+            }
+            else if (currentMenu == MENU_DASHBOARD || currentMenu == MENU_REAL_MONITORING) {
+                // System Log filters: L = minimum level, G = one source tag
+                if (IsKeyPressed(KEY_L)) logMinLevel = (logMinLevel + 1) % EV_LEVEL_COUNT;
+                if (IsKeyPressed(KEY_G)) {
+                    int id = logSourceFilter;
+                    do { id = (id + 1) % EVENT_SOURCE_MAX; } while (id != 0 && !*EventSourceName((uint8_t)id));
+                    logSourceFilter = id;
+                }
+                // History graphs or the last adaptive capture
+                if (IsKeyPressed(KEY_C)) showCapture = !showCapture;
+            }
+            else if (currentMenu == MENU_BENCHMARKS) {
+                if (IsKeyPressed(KEY_LEFT))  benchPage = (benchPage - 1 + BENCH_COUNT) % BENCH_COUNT;
+                if (IsKeyPressed(KEY_RIGHT)) benchPage = (benchPage + 1) % BENCH_COUNT;
+                MemStressConfig& mc = memStressConfig;
+                bool memRunning = memStressState == MemStressState::RUNNING;
+                if (benchPage == BENCH_CORE_LATENCY && IsKeyPressed(KEY_ENTER)) {
+                    if (coreLatencyState == StressTestState::RUNNING) {
+                        StopCoreLatencyTest();
+                        AddLogEntry("[C2C] Core-to-core test stopped", AMBER_PHOSPHOR);
+                    } else if (stressState == StressTestState::RUNNING) {
+                        AddLogEntry("[C2C] Stop the CPU stress test first (F5)", YELLOW_ALERT);
+                    } else {
+                        StartCoreLatencyTest();
+                        AddLogEntry("[C2C] Core-to-core latency test started", AMBER_PHOSPHOR);
+                    }
+                }
+                if (benchPage == BENCH_DISK) {
+                    DiskBenchConfig& dc = diskBenchConfig;
+                    bool diskActive = diskBenchState == DiskBenchState::PREPARING ||
+                                      diskBenchState == DiskBenchState::RUNNING;
+                    if (IsKeyPressed(KEY_ENTER)) {
+                        if (diskActive) {
+                            StopDiskBench();
+                            AddLogEntry("[DISKBENCH] Stopped", AMBER_PHOSPHOR);
+                        } else {
+                            StartDiskBench();
+                            char msg[128];
+                            snprintf(msg, sizeof(msg), "[DISKBENCH] %s %dK QD%d on %s", DISK_PATTERN_NAMES[(int)dc.pattern],
+                                     dc.blockKB, dc.queueDepth, dc.mountPoint.empty() ? "first drive" : dc.mountPoint.c_str());
+                            AddLogEntry(msg, AMBER_PHOSPHOR);
+                        }
+                    }
+                    if (!diskActive) {
+                        bool changed = false;
+                        if (IsKeyPressed(KEY_D)) {
+                            std::vector<DiskInfo> drives = GetAllDrives();
+                            if (!drives.empty()) {
+                                size_t next = 0;
+                                for (size_t i = 0; i < drives.size(); i++)
+                                    if (drives[i].mountPoint == dc.mountPoint) next = (i + 1) % drives.size();
+                                dc.mountPoint = drives[next].mountPoint;
+                                changed = true;
+                            }
+                        }
+                        if (IsKeyPressed(KEY_M)) {
+                            dc.pattern = (DiskPattern)(((int)dc.pattern + 1) % (int)DiskPattern::COUNT);
+                            changed = true;
+                        }
+                        if (IsKeyPressed(KEY_B)) {
+                            static const int SIZES[] = { 4, 16, 64, 128, 1024 };
+                            int next = SIZES[0];
+                            for (int kb : SIZES) if (kb > dc.blockKB) { next = kb; break; }
+                            dc.blockKB = next;
+                            changed = true;
+                        }
+                        if (IsKeyPressed(KEY_Q)) {
+                            static const int DEPTHS[] = { 1, 4, 16, 32, 64, 128 };
+                            int next = DEPTHS[0];
+                            for (int qd : DEPTHS) if (qd > dc.queueDepth) { next = qd; break; }
+                            dc.queueDepth = next;
+                            changed = true;
+                        }
+                        if (changed) SaveConfig();
+                    }
+                }
+                if (benchPage == BENCH_MEMORY && IsKeyPressed(KEY_ENTER)) {
+                    if (memRunning) {
+                        StopMemStress();
+                        AddLogEntry("[MEMBENCH] Stopping after current phase", AMBER_PHOSPHOR);
+                    } else {
+                        StartMemStress();
+                        char msg[96];
+                        snprintf(msg, sizeof(msg), "[MEMBENCH] Started (%d%% of RAM, %s)",
+                                 mc.footprintPct, MEM_HUGEPAGE_NAMES[(int)mc.hugePages]);
+                        AddLogEntry(msg, AMBER_PHOSPHOR);
+                    }
+                }
+                if (benchPage == BENCH_MEMORY && !memRunning) {
+                    bool changed = false;
+                    if (IsKeyPressed(KEY_F)) {
+                        static const int STEPS[] = { 10, 25, 50, 75, 90 };
+                        int next = STEPS[0];
+                        for (int pct : STEPS) if (pct > mc.footprintPct) { next = pct; break; }
+                        mc.footprintPct = next;
+                        changed = true;
+                    }
+                    if (IsKeyPressed(KEY_P)) {
+                        mc.hugePages = (MemHugePages)(((int)mc.hugePages + 1) % (int)MemHugePages::COUNT);
+                        changed = true;
+                    }
+                    if (IsKeyPressed(KEY_N)) { mc.numaLocal = !mc.numaLocal; changed = true; }
+                    if (changed) SaveConfig();
+                }
+                if (IsKeyPressed(KEY_ESCAPE)) {
+                    currentMenu = MENU_DASHBOARD;
+                    AddLogEntry("[MENU] Returned to dashboard", DIM_GREEN);
+                }
+            }
         }
 
         // ── Update ────────────────────────────────────────────────────────
-        UpdateStats(dt);
-
-        // ── Shader uniforms ───────────────────────────────────────────────
-        SetShaderValue(crtShader, timeLoc, &timeAccumulator, SHADER_UNIFORM_FLOAT);
-        float tint[3] = {
-            PALETTES[currentTheme].primary.r / 255.f,
-            PALETTES[currentTheme].primary.g / 255.f,
-            PALETTES[currentTheme].primary.b / 255.f
-        };
-        SetShaderValue(crtShader, tintLoc, tint, SHADER_UNIFORM_VEC3);
+        bool changed = UpdateStats(dt);
+
+        // ── Pacing: skip the frame when nothing on screen would change ────
+        double wait = FramePacerPlan(now, changed || InputThisFrame(), DashboardAnimating(),
+                                     StatsNextSampleTime());
+        if (wait > 0.0) {
+            WaitForInput(wait);
+            continue;
+        }
 
         // ── Render ────────────────────────────────────────────────────────
-        BeginTextureMode(target);
-            DrawDashboard();
-        EndTextureMode();
-
-        BeginDrawing();
-            ClearBackground(COLOR_BLACK);
-            BeginShaderMode(crtShader);
-            {
-                int sw = GetScreenWidth(), sh = GetScreenHeight();
-                Rectangle src = { 0, 0, (float)target.texture.width, (float)-target.texture.height };
-                float scale = (sw / (float)WINDOW_WIDTH < sh / (float)WINDOW_HEIGHT)
-                              ? sw / (float)WINDOW_WIDTH : sh / (float)WINDOW_HEIGHT;
-                Rectangle dst = { (sw - WINDOW_WIDTH * scale) * 0.5f,
-                                  (sh - WINDOW_HEIGHT * scale) * 0.5f,
-                                  WINDOW_WIDTH * scale, WINDOW_HEIGHT * scale };
-                DrawTexturePro(target.texture, src, dst, {0, 0}, 0.f, WHITE);
-            }
-            EndShaderMode();
-
-            // Overlays drawn AFTER shader - no CRT tint applied to them
-            DrawColorMenu();
-            DrawWidgetMenu();
-            DrawOnboarding();
-            DrawTerminal();
-
-        EndDrawing();
+        if (UpdateLayout()) ApplyLayout(target);
+        // AUTO's timed frames wait for the GPU on both sides of the CRT
+        // passes, so it sees their cost and not the dashboard's
+        uint64_t allocsBefore = ThreadAllocCount();
+        RenderFrame(target, CrtQualityActive(), CrtQualityWantsTiming(now), now);
+        FramePacerFrameDrawn(now, ThreadAllocCount() - allocsBefore);
     }
 
     // ── Cleanup ───────────────────────────────────────────────────────────────
+    StopSpeedTestScheduler();
+    StopMemStress();
+    StopCoreLatencyTest();
+    StopDiskBench();
+    StopDuScan();
+    StopLogTail();
+    StopCollectors();
     CleanupSystemMonitoring();
-    UnloadShader(crtShader);
+    StopFramePacer();
+    StopEventLogWriter();
+    CloseSpeedTestHistory();
+    UnloadMetricHistory();
+    UnloadCrtPipeline();
     UnloadRenderTexture(target);
     if (hasCustomFont) UnloadFont(retroFont);
     CloseWindow();
@@ -0,0 +1,334 @@
+// mem_stress.cpp - memory subsystem burn-in: bandwidth passes + latency curve
+// Pure logic, NO raylib/drawing includes (results are drawn in dashboard.cpp)
+#include "mem_stress.h"
+#include "system_monitor.h"
+#include "sysfs_util.h"
+#include "event_log.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <algorithm>
+
+#if defined(_WIN32)
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+#else
+  #include <sys/mman.h>
+#endif
+
+MemStressState  memStressState    = MemStressState::IDLE;
+float           memStressProgress = 0.f;
+MemStressConfig memStressConfig;
+
+static std::atomic<bool> s_stop{false};
+static std::atomic<bool> s_busy{false};      // coordinator thread alive
+static std::mutex        s_mutex;
+static MemStressResult   s_result;
+
+static const uint64_t MB            = 1024ULL * 1024ULL;
+static const uint64_t LATENCY_MAX   = 1024ULL * MB;   // DRAM is reached long before this
+static const int      CHASE_STEPS   = 1 << 21;
+
+static void SetPhase(const char* phase) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_result.phase = phase;
+}
+
+// ── Buffer ────────────────────────────────────────────────────────────────────
+static void* AllocBuffer(size_t bytes, MemHugePages mode, const char*& got) {
+    got = MEM_HUGEPAGE_NAMES[(int)MemHugePages::OFF];
+#if defined(_WIN32)
+    // Large pages need SeLockMemoryPrivilege; plain commit is the honest default
+    (void)mode;
+    return VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+  #ifdef MAP_HUGETLB
+    if (mode == MemHugePages::EXPLICIT) {
+        void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) { got = MEM_HUGEPAGE_NAMES[(int)MemHugePages::EXPLICIT]; return p; }
+        // Pool empty or too small (vm.nr_hugepages): fall through to THP
+    }
+  #endif
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+  #ifdef MADV_HUGEPAGE
+    if (mode != MemHugePages::OFF && madvise(p, bytes, MADV_HUGEPAGE) == 0)
+        got = MEM_HUGEPAGE_NAMES[(int)MemHugePages::TRANSPARENT];
+  #endif
+    return p;
+#endif
+}
+
+static void FreeBuffer(void* p, size_t bytes) {
+#if defined(_WIN32)
+    (void)bytes;
+    VirtualFree(p, 0, MEM_RELEASE);
+#else
+    munmap(p, bytes);
+#endif
+}
+
+// Anonymous THP-backed memory of this process, from smaps_rollup (Linux 4.14+)
+static uint64_t ReadAnonHugeMB() {
+    std::ifstream f("/proc/self/smaps_rollup");
+    std::string line;
+    while (std::getline(f, line)) {
+        if (line.compare(0, 14, "AnonHugePages:") == 0)
+            return std::stoull(line.substr(14)) / 1024ULL;
+    }
+    return 0;
+}
+
+// ── Kernels ───────────────────────────────────────────────────────────────────
+// Each word holds seed ^ index, so the read pass doubles as a pattern check:
+// a flipped bit on a marginal DIMM shows up as an error count, not a crash.
+static void WriteSlice(uint64_t* p, size_t n, uint64_t seed) {
+    for (size_t i = 0; i < n; i++) p[i] = seed ^ i;
+}
+
+static uint64_t ReadSlice(const uint64_t* p, size_t n, uint64_t seed) {
+    uint64_t bad = 0;
+    for (size_t i = 0; i < n; i++) bad += p[i] != (seed ^ i);
+    return bad;
+}
+
+static void CopySlice(uint64_t* p, size_t n) {
+    memcpy(p + n / 2, p, (n / 2) * sizeof(uint64_t));
+}
+
+// ── Worker pool ───────────────────────────────────────────────────────────────
+// Workers stay alive for the whole run so each keeps its CPU and its slice
+// stays on the node that first touched it.
+enum class MemOp { TOUCH, WRITE, READ, COPY, QUIT };
+
+struct MemPool {
+    std::mutex              m;
+    std::condition_variable go, done;
+    uint64_t                gen      = 0;
+    MemOp                   op       = MemOp::TOUCH;
+    uint64_t                seed     = 0;
+    int                     finished = 0;
+    std::atomic<uint64_t>   errors{0};
+};
+
+static void MemWorker(MemPool* pool, uint64_t* slice, size_t words, int cpu) {
+    // Unpinned, the slice still gets its passes; it just may not stay local
+    if (cpu >= 0 && !PinThreadToCpu(cpu)) {
+        char buf[96];
+        snprintf(buf, sizeof(buf), "[MEM] Could not pin a worker to CPU %d; its slice may not be NUMA-local", cpu);
+        LogEvent(EV_WARN, buf);
+    }
+    uint64_t seen = 0;
+    while (true) {
+        MemOp op; uint64_t seed;
+        {
+            std::unique_lock<std::mutex> lock(pool->m);
+            pool->go.wait(lock, [&] { return pool->gen != seen; });
+            seen = pool->gen; op = pool->op; seed = pool->seed;
+        }
+        if (op == MemOp::QUIT) return;
+        switch (op) {
+            case MemOp::TOUCH: memset(slice, 0, words * sizeof(uint64_t)); break;
+            case MemOp::WRITE: WriteSlice(slice, words, seed); break;
+            case MemOp::READ:  pool->errors += ReadSlice(slice, words, seed); break;
+            case MemOp::COPY:  CopySlice(slice, words); break;
+            default: break;
+        }
+        std::lock_guard<std::mutex> lock(pool->m);
+        pool->finished++;
+        pool->done.notify_one();
+    }
+}
+
+// Runs one op on every worker and returns its wall time in seconds
+static double RunPhase(MemPool& pool, int threads, MemOp op, uint64_t seed) {
+    auto t0 = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(pool.m);
+        pool.op = op; pool.seed = seed; pool.finished = 0; pool.gen++;
+    }
+    pool.go.notify_all();
+    std::unique_lock<std::mutex> lock(pool.m);
+    pool.done.wait(lock, [&] { return pool.finished == threads; });
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// ── Latency ───────────────────────────────────────────────────────────────────
+// Dependent loads through a random single cycle of cache lines (Sattolo), so
+// neither the prefetcher nor memory-level parallelism can hide the latency.
+static float ChaseLatencyNs(char* base, uint64_t bytes, std::mt19937& rng) {
+    size_t lines = (size_t)(bytes / 64);
+    if (lines < 2) return 0.f;
+    std::vector<uint32_t> order(lines);
+    for (size_t i = 0; i < lines; i++) order[i] = (uint32_t)i;
+    for (size_t i = lines - 1; i > 0; i--) {
+        size_t j = std::uniform_int_distribution<size_t>(0, i - 1)(rng);
+        std::swap(order[i], order[j]);
+    }
+    for (size_t i = 0; i < lines; i++)
+        *(void**)(base + (size_t)order[i] * 64) = base + (size_t)order[(i + 1) % lines] * 64;
+
+    void* p = base;
+    size_t warm = std::min(lines, (size_t)CHASE_STEPS);
+    for (size_t i = 0; i < warm; i++) p = *(void**)p;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < CHASE_STEPS; i++) p = *(void**)p;
+    double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    if (p == nullptr) return -1.f;   // never true; keeps the chase observable
+    return (float)(sec * 1e9 / CHASE_STEPS);
+}
+
+// ── Coordinator ───────────────────────────────────────────────────────────────
+static void Fail(const char* why) {
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.error = why;
+        s_result.phase = "FAILED";
+    }
+    memStressState = MemStressState::FAILED;
+}
+
+static void MemStressCoordinator(MemStressConfig cfg) {
+    // Footprint: the requested share of RAM, but never more than is free now
+    uint64_t totalMB = GetTotalRAM_MB(), usedMB = GetUsedRAM_MB();
+    int pct = std::max(1, std::min(90, cfg.footprintPct));
+    uint64_t wantMB  = totalMB * pct / 100;
+    uint64_t freeMB  = totalMB > usedMB + 256 ? totalMB - usedMB - 256 : 0;
+    uint64_t footMB  = std::min(wantMB, freeMB) & ~1ULL;   // whole 2 MB huge pages
+    if (footMB < 64) { Fail("NOT ENOUGH FREE MEMORY"); s_busy = false; return; }
+    size_t bytes = (size_t)(footMB * MB);
+
+    // One worker per logical CPU, enumerated node by node so consecutive
+    // slices land on the same node
+    std::vector<int> usable = GetUsableCpus();
+    std::vector<NumaNodeCpus> nodes = GetNumaNodeCpus();
+    std::vector<int> cpus;
+    for (const auto& n : nodes)
+        for (int c : n.cpus) if (std::find(usable.begin(), usable.end(), c) != usable.end()) cpus.push_back(c);
+    if (cpus.empty()) cpus = usable;
+    int threads = (int)cpus.size();
+
+    SetPhase("ALLOCATING");
+    const char* pageMode = "";
+    char* buf = (char*)AllocBuffer(bytes, cfg.hugePages, pageMode);
+    if (!buf) { Fail("ALLOCATION FAILED"); s_busy = false; return; }
+
+    size_t words = (bytes / sizeof(uint64_t) / threads) & ~(size_t)7;   // 64 B multiple
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.footprintMB = footMB;
+        s_result.pageMode    = pageMode;
+        s_result.threads     = threads;
+        s_result.numaNodes   = nodes.empty() ? 1 : (int)nodes.size();
+    }
+
+    // Without NUMA-local placement the coordinator touches everything, so
+    // all pages land on one node: useful as the "misconfigured" comparison
+    SetPhase("FIRST TOUCH");
+    if (!cfg.numaLocal) memset(buf, 0, bytes);
+
+    MemPool pool;
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (int i = 0; i < threads; i++)
+        workers.emplace_back(MemWorker, &pool, (uint64_t*)buf + (size_t)i * words, words,
+                             cfg.numaLocal ? cpus[i] : -1);
+    if (cfg.numaLocal) RunPhase(pool, threads, MemOp::TOUCH, 0);
+
+    uint64_t hugeMB = pageMode == MEM_HUGEPAGE_NAMES[(int)MemHugePages::EXPLICIT] ? footMB
+                                                                                 : std::min(footMB, ReadAnonHugeMB());
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result.hugeMB = hugeMB;
+    }
+
+    double gb = (double)words * sizeof(uint64_t) * threads / 1e9;
+    auto start = std::chrono::steady_clock::now();
+    std::mt19937 rng(0x5EED);
+    bool latencyDone = false;
+    for (int pass = 1; !s_stop.load(); pass++) {
+        uint64_t seed = 0x9E3779B97F4A7C15ULL * (uint64_t)pass;
+        SetPhase("WRITE");
+        double w = RunPhase(pool, threads, MemOp::WRITE, seed);
+        SetPhase("READ + VERIFY");
+        double r = RunPhase(pool, threads, MemOp::READ, seed);
+        SetPhase("COPY");
+        double c = RunPhase(pool, threads, MemOp::COPY, seed);
+        {
+            std::lock_guard<std::mutex> lock(s_mutex);
+            MemStressResult& res = s_result;
+            res.passes        = pass;
+            res.errors        = pool.errors.load();
+            res.lastWriteGBps = (float)(gb / w);
+            res.lastReadGBps  = (float)(gb / r);
+            res.lastCopyGBps  = (float)(gb / c);   // half read + half written
+            res.writeGBps     = std::max(res.writeGBps, res.lastWriteGBps);
+            res.readGBps      = std::max(res.readGBps,  res.lastReadGBps);
+            res.copyGBps      = std::max(res.copyGBps,  res.lastCopyGBps);
+        }
+
+        // Latency curve once, after the first pass, from thread 0's slice so
+        // the chase runs node-local; the chase overwrites that slice, the next
+        // pass rewrites it before verifying
+        if (!latencyDone) {
+            SetPhase("LATENCY");
+            PinThreadToCpu(cpus[0]);   // best effort: the curve is per-size, not per-CPU
+            uint64_t maxBytes = std::min<uint64_t>(LATENCY_MAX, (uint64_t)words * sizeof(uint64_t));
+            for (uint64_t sz = 4096; sz <= maxBytes && !s_stop.load(); sz *= 2) {
+                float ns = ChaseLatencyNs(buf, sz, rng);
+                std::lock_guard<std::mutex> lock(s_mutex);
+                s_result.latency.push_back({sz, ns});
+            }
+            latencyDone = true;
+        }
+
+        float elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+        memStressProgress = std::min(1.f, elapsed / (float)std::max(1, cfg.durationSec));
+        if (memStressProgress >= 1.f) break;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pool.m);
+        pool.op = MemOp::QUIT; pool.gen++;
+    }
+    pool.go.notify_all();
+    for (auto& t : workers) t.join();
+    FreeBuffer(buf, bytes);
+
+    SetPhase(s_stop.load() ? "STOPPED" : "COMPLETE");
+    memStressProgress = 1.f;
+    memStressState    = MemStressState::DONE;
+    s_busy = false;
+}
+
+// ── Public API ────────────────────────────────────────────────────────────────
+void StartMemStress() {
+    if (s_busy.exchange(true)) return;   // previous run still unwinding
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_result = MemStressResult{};
+        s_result.phase = "STARTING";
+    }
+    s_stop            = false;
+    memStressProgress = 0.f;
+    memStressState    = MemStressState::RUNNING;
+    std::thread(MemStressCoordinator, memStressConfig).detach();
+}
+
+void StopMemStress() {
+    if (memStressState != MemStressState::RUNNING) return;
+    s_stop = true;
+}
+
+MemStressResult GetMemStressResult() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_result;
+}
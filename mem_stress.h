@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+enum class MemStressState { IDLE, RUNNING, DONE, FAILED };
+
+// How the test buffer is backed
+enum class MemHugePages {
+    OFF = 0,       // plain 4K pages
+    TRANSPARENT,   // madvise(MADV_HUGEPAGE), kernel promotes when it can
+    EXPLICIT,      // MAP_HUGETLB from the reserved pool (falls back to THP)
+    COUNT
+};
+
+inline const char* MEM_HUGEPAGE_NAMES[] = { "4K PAGES", "THP", "HUGETLB" };
+
+struct MemStressConfig {
+    int          footprintPct = 25;     // of GetTotalRAM_MB(); capped to what is free
+    MemHugePages hugePages    = MemHugePages::TRANSPARENT;
+    bool         numaLocal    = true;   // each slice first-touched by a thread on its node
+    int          durationSec  = 60;     // bandwidth passes repeat until this elapses
+};
+
+// Dependent-load latency at one working-set size
+struct MemLatencyPoint {
+    uint64_t bytes;
+    float    ns;
+};
+
+struct MemStressResult {
+    std::string phase;                 // what the run is doing right now
+    std::string error;                 // set when state is FAILED
+    uint64_t    footprintMB   = 0;
+    uint64_t    hugeMB        = 0;     // huge-page backed part of the buffer
+    const char* pageMode      = "";    // what was actually obtained
+    int         threads       = 0;
+    int         numaNodes     = 1;
+    int         passes        = 0;
+    uint64_t    errors        = 0;     // words that read back wrong (burn-in)
+    // GB/s over all threads; "best" is the max over passes, "last" the latest
+    float       readGBps      = 0.f, writeGBps = 0.f, copyGBps = 0.f;
+    float       lastReadGBps  = 0.f, lastWriteGBps = 0.f, lastCopyGBps = 0.f;
+    std::vector<MemLatencyPoint> latency;   // ascending size, L1 to DRAM
+};
+
+extern MemStressState  memStressState;
+extern float           memStressProgress;   // 0..1
+extern MemStressConfig memStressConfig;
+
+void            StartMemStress();
+void            StopMemStress();
+MemStressResult GetMemStressResult();
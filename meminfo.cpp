@@ -0,0 +1,189 @@
+// meminfo.cpp - /proc/meminfo + /proc/vmstat parser with compile-time perfect hashing
+// Pure logic, NO raylib/drawing includes
+#include "meminfo.h"
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+// ── Perfect hash ──────────────────────────────────────────────────────────────
+// FNV-1a over the key, mixed and cut to the table size. The seed is searched
+// at compile time until every key lands in its own slot, so a lookup is one
+// hash (computed while scanning the key), one slot read and one compare.
+struct HashKey {
+    std::string_view name;
+    int              field;
+};
+
+static constexpr uint32_t HashStep(uint32_t h, unsigned char c) { return (h ^ c) * 16777619u; }
+static constexpr uint32_t HashInit(uint32_t seed)              { return 2166136261u ^ (seed * 0x9E3779B9u); }
+
+template <int BITS>
+static constexpr uint32_t HashSlot(uint32_t h) { return (h * 0x85EBCA6Bu) >> (32 - BITS); }
+
+template <int BITS>
+struct PerfectTable {
+    uint32_t seed = 0;
+    int8_t   slot[1 << BITS] = {};   // index into the key list, -1 = empty
+};
+
+template <int BITS, size_t N>
+static constexpr PerfectTable<BITS> BuildTable(const HashKey (&keys)[N]) {
+    static_assert(N < (1u << BITS), "table too small");
+    for (uint32_t seed = 1; seed < 100000; seed++) {
+        PerfectTable<BITS> t;
+        t.seed = seed;
+        for (int8_t& s : t.slot) s = -1;
+        bool ok = true;
+        for (size_t k = 0; k < N && ok; k++) {
+            uint32_t h = HashInit(seed);
+            for (char c : keys[k].name) h = HashStep(h, (unsigned char)c);
+            int8_t& s = t.slot[HashSlot<BITS>(h)];
+            if (s >= 0) ok = false;
+            else        s = (int8_t)k;
+        }
+        if (ok) return t;
+    }
+    return PerfectTable<BITS>();   // seed 0: caught by the static_asserts below
+}
+
+static constexpr HashKey MEMINFO_KEYS[] = {
+    { "MemTotal", MI_MEM_TOTAL },            { "MemFree", MI_MEM_FREE },
+    { "MemAvailable", MI_MEM_AVAILABLE },    { "Buffers", MI_BUFFERS },
+    { "Cached", MI_CACHED },                 { "SwapCached", MI_SWAP_CACHED },
+    { "Active", MI_ACTIVE },                 { "Inactive", MI_INACTIVE },
+    { "Active(anon)", MI_ACTIVE_ANON },      { "Inactive(anon)", MI_INACTIVE_ANON },
+    { "Active(file)", MI_ACTIVE_FILE },      { "Inactive(file)", MI_INACTIVE_FILE },
+    { "Unevictable", MI_UNEVICTABLE },       { "Mlocked", MI_MLOCKED },
+    { "SwapTotal", MI_SWAP_TOTAL },          { "SwapFree", MI_SWAP_FREE },
+    { "Zswap", MI_ZSWAP },                   { "Dirty", MI_DIRTY },
+    { "Writeback", MI_WRITEBACK },           { "AnonPages", MI_ANON_PAGES },
+    { "Mapped", MI_MAPPED },                 { "Shmem", MI_SHMEM },
+    { "KReclaimable", MI_KRECLAIMABLE },     { "Slab", MI_SLAB },
+    { "SReclaimable", MI_SRECLAIMABLE },     { "SUnreclaim", MI_SUNRECLAIM },
+    { "KernelStack", MI_KERNEL_STACK },      { "PageTables", MI_PAGE_TABLES },
+    { "CommitLimit", MI_COMMIT_LIMIT },      { "Committed_AS", MI_COMMITTED_AS },
+    { "VmallocUsed", MI_VMALLOC_USED },      { "AnonHugePages", MI_ANON_HUGE_PAGES },
+    { "ShmemHugePages", MI_SHMEM_HUGE_PAGES }, { "FileHugePages", MI_FILE_HUGE_PAGES },
+    { "HugePages_Total", MI_HUGEPAGES_TOTAL }, { "HugePages_Free", MI_HUGEPAGES_FREE },
+    { "HugePages_Rsvd", MI_HUGEPAGES_RSVD }, { "HugePages_Surp", MI_HUGEPAGES_SURP },
+    { "Hugepagesize", MI_HUGEPAGE_SIZE },    { "Hugetlb", MI_HUGETLB },
+    { "FilePages", MI_FILE_PAGES },
+};
+static_assert(sizeof(MEMINFO_KEYS) / sizeof(MEMINFO_KEYS[0]) == MI_COUNT, "MemField / key list mismatch");
+
+static constexpr HashKey VMSTAT_KEYS[] = {
+    { "pgpgin", VM_PGPGIN },                 { "pgpgout", VM_PGPGOUT },
+    { "pswpin", VM_PSWPIN },                 { "pswpout", VM_PSWPOUT },
+    { "pgfault", VM_PGFAULT },               { "pgmajfault", VM_PGMAJFAULT },
+    { "pgscan_kswapd", VM_PGSCAN_KSWAPD },   { "pgscan_direct", VM_PGSCAN_DIRECT },
+    { "pgsteal_kswapd", VM_PGSTEAL_KSWAPD }, { "pgsteal_direct", VM_PGSTEAL_DIRECT },
+    { "oom_kill", VM_OOM_KILL },
+};
+static_assert(sizeof(VMSTAT_KEYS) / sizeof(VMSTAT_KEYS[0]) == VM_COUNT, "VmField / key list mismatch");
+
+static constexpr PerfectTable<7> MEMINFO_TABLE = BuildTable<7>(MEMINFO_KEYS);
+static constexpr PerfectTable<5> VMSTAT_TABLE  = BuildTable<5>(VMSTAT_KEYS);
+static_assert(MEMINFO_TABLE.seed != 0, "no perfect seed for meminfo keys");
+static_assert(VMSTAT_TABLE.seed != 0,  "no perfect seed for vmstat keys");
+
+// "Key:   123 kB" (meminfo, sep ':') or "key 123" (vmstat, sep ' ').
+// Unknown keys hash to an empty or mismatching slot and are skipped.
+template <int BITS, size_t N>
+static void ParseKeyed(const char* p, const char* end, char sep, const PerfectTable<BITS>& table,
+                       const HashKey (&keys)[N], uint64_t* out) {
+    while (p < end) {
+        // Per-node meminfo: "Node 0 MemTotal:  123 kB"
+        if (end - p > 5 && p[0] == 'N' && p[1] == 'o' && p[2] == 'd' && p[3] == 'e' && p[4] == ' ') {
+            p += 5;
+            while (p < end && *p >= '0' && *p <= '9') p++;
+            while (p < end && *p == ' ') p++;
+        }
+        const char* key = p;
+        uint32_t h = HashInit(table.seed);
+        while (p < end && *p != sep && *p != '\n') h = HashStep(h, (unsigned char)*p++);
+        std::string_view name(key, (size_t)(p - key));
+        int8_t s = table.slot[HashSlot<BITS>(h)];
+        if (p < end && *p == sep && s >= 0 && keys[s].name == name) {
+            p++;
+            while (p < end && *p == ' ') p++;
+            uint64_t v = 0;
+            while (p < end && *p >= '0' && *p <= '9') v = v * 10 + (uint64_t)(*p++ - '0');
+            out[keys[s].field] = v;
+        }
+        while (p < end && *p != '\n') p++;
+        p++;
+    }
+}
+
+void ParseMemInfoText(const char* text, size_t len, uint64_t kb[MI_COUNT]) {
+    ParseKeyed(text, text + len, ':', MEMINFO_TABLE, MEMINFO_KEYS, kb);
+}
+
+#if defined(__linux__)
+static std::mutex s_mutex;
+static int        s_meminfoFd = -2, s_vmstatFd = -2;   // -2 = not opened yet
+static MemInfo    s_last;
+static double     s_lastTime = 0.0;
+
+static double NowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+MemInfo ReadMemInfo() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (s_meminfoFd == -2) {
+        s_meminfoFd = open("/proc/meminfo", O_RDONLY | O_CLOEXEC);
+        s_vmstatFd  = open("/proc/vmstat", O_RDONLY | O_CLOEXEC);
+    }
+
+    MemInfo m;
+    char buf[16384];
+    ssize_t n = s_meminfoFd >= 0 ? pread(s_meminfoFd, buf, sizeof(buf), 0) : -1;
+    if (n <= 0) return m;
+    ParseKeyed(buf, buf + n, ':', MEMINFO_TABLE, MEMINFO_KEYS, m.kb);
+    m.valid = m.kb[MI_MEM_TOTAL] > 0;
+    // Kernels before 3.14 have no MemAvailable; free + page cache is the old estimate
+    if (m.kb[MI_MEM_AVAILABLE] == 0)
+        m.kb[MI_MEM_AVAILABLE] = m.kb[MI_MEM_FREE] + m.kb[MI_BUFFERS] + m.kb[MI_CACHED];
+
+    n = s_vmstatFd >= 0 ? pread(s_vmstatFd, buf, sizeof(buf), 0) : -1;
+    if (n > 0) ParseKeyed(buf, buf + n, ' ', VMSTAT_TABLE, VMSTAT_KEYS, m.vm);
+
+    double now = NowSec(), dt = now - s_lastTime;
+    if (s_last.valid && dt < 0.5) {
+        // Too soon for a meaningful rate: keep the previous one
+        m.faultsPerSec = s_last.faultsPerSec;   m.majFaultsPerSec = s_last.majFaultsPerSec;
+        m.swapInPerSec = s_last.swapInPerSec;   m.swapOutPerSec   = s_last.swapOutPerSec;
+        m.pageInKBps   = s_last.pageInKBps;     m.pageOutKBps     = s_last.pageOutKBps;
+        m.scanPerSec   = s_last.scanPerSec;
+        return m;
+    }
+    if (s_last.valid) {
+        auto rate = [&](int f) {
+            return m.vm[f] >= s_last.vm[f] ? (float)((m.vm[f] - s_last.vm[f]) / dt) : 0.f;
+        };
+        m.faultsPerSec    = rate(VM_PGFAULT);
+        m.majFaultsPerSec = rate(VM_PGMAJFAULT);
+        m.swapInPerSec    = rate(VM_PSWPIN);
+        m.swapOutPerSec   = rate(VM_PSWPOUT);
+        m.pageInKBps      = rate(VM_PGPGIN);    // pgpgin/pgpgout already count kB
+        m.pageOutKBps     = rate(VM_PGPGOUT);
+        m.scanPerSec      = rate(VM_PGSCAN_KSWAPD) + rate(VM_PGSCAN_DIRECT);
+    }
+    s_last = m;
+    s_lastTime = now;
+    return m;
+}
+
+#else
+
+MemInfo ReadMemInfo() { return MemInfo(); }
+
+#endif
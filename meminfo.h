@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// ── /proc/meminfo + /proc/vmstat collector ────────────────────────────────────
+// One parser for every RAM number the dashboard shows, so the RAM bar, the
+// MB detail and the memory view agree: used = MemTotal - MemAvailable.
+// Linux only; other platforms get valid = false.
+enum MemField {
+    MI_MEM_TOTAL = 0, MI_MEM_FREE, MI_MEM_AVAILABLE, MI_BUFFERS, MI_CACHED, MI_SWAP_CACHED,
+    MI_ACTIVE, MI_INACTIVE, MI_ACTIVE_ANON, MI_INACTIVE_ANON, MI_ACTIVE_FILE, MI_INACTIVE_FILE,
+    MI_UNEVICTABLE, MI_MLOCKED, MI_SWAP_TOTAL, MI_SWAP_FREE, MI_ZSWAP, MI_DIRTY, MI_WRITEBACK,
+    MI_ANON_PAGES, MI_MAPPED, MI_SHMEM, MI_KRECLAIMABLE, MI_SLAB, MI_SRECLAIMABLE, MI_SUNRECLAIM,
+    MI_KERNEL_STACK, MI_PAGE_TABLES, MI_COMMIT_LIMIT, MI_COMMITTED_AS, MI_VMALLOC_USED,
+    MI_ANON_HUGE_PAGES, MI_SHMEM_HUGE_PAGES, MI_FILE_HUGE_PAGES, MI_HUGEPAGES_TOTAL,
+    MI_HUGEPAGES_FREE, MI_HUGEPAGES_RSVD, MI_HUGEPAGES_SURP, MI_HUGEPAGE_SIZE, MI_HUGETLB,
+    MI_FILE_PAGES,   // per-node meminfo only
+    MI_COUNT
+};
+
+enum VmField {
+    VM_PGPGIN = 0, VM_PGPGOUT, VM_PSWPIN, VM_PSWPOUT, VM_PGFAULT, VM_PGMAJFAULT,
+    VM_PGSCAN_KSWAPD, VM_PGSCAN_DIRECT, VM_PGSTEAL_KSWAPD, VM_PGSTEAL_DIRECT, VM_OOM_KILL,
+    VM_COUNT
+};
+
+struct MemInfo {
+    bool     valid = false;
+    uint64_t kb[MI_COUNT] = {};     // meminfo values in kB (HugePages_* are page counts)
+    uint64_t vm[VM_COUNT] = {};     // cumulative vmstat counters
+    // Per-second rates between the last two samples
+    float    faultsPerSec    = 0.f, majFaultsPerSec = 0.f;
+    float    swapInPerSec    = 0.f, swapOutPerSec   = 0.f;   // pages
+    float    pageInKBps      = 0.f, pageOutKBps     = 0.f;
+    float    scanPerSec      = 0.f;                          // kswapd + direct reclaim scans
+
+    uint64_t UsedKB() const { return kb[MI_MEM_TOTAL] > kb[MI_MEM_AVAILABLE] ? kb[MI_MEM_TOTAL] - kb[MI_MEM_AVAILABLE] : 0; }
+};
+
+// Both files are kept open and re-read with one pread each. Rates update
+// when at least half a second has passed since the previous sample, so
+// calling this every frame is fine. Thread-safe.
+MemInfo ReadMemInfo();
+
+// Same parser for meminfo-format text from elsewhere, e.g. the per-node
+// /sys/devices/system/node/nodeN/meminfo ("Node N " line prefixes are skipped)
+void ParseMemInfoText(const char* text, size_t len, uint64_t kb[MI_COUNT]);
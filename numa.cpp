@@ -0,0 +1,167 @@
+// numa.cpp - per-node memory, allocation counters and CPU load
+// Pure logic, NO raylib/drawing includes
+#include "numa.h"
+#include "meminfo.h"
+#include "sysfs_util.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+static std::mutex s_mutex;
+static NumaStats  s_stats;
+static double     s_time = -1e9;
+
+// Previous counters, per node / per logical CPU
+struct NumaPrev {
+    uint64_t hit = 0, miss = 0, foreign = 0, local = 0, other = 0;
+};
+static std::vector<NumaPrev> s_prevNode;
+static std::vector<int>      s_prevIds;   // node ids s_prevNode lines up with
+static std::vector<uint64_t> s_prevBusy, s_prevTotal;
+
+static double NowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static bool ReadWholeFile(const std::string& path, std::string& out) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    out.clear();
+    char buf[8192];
+    ssize_t n;
+    while ((n = read(fd, buf, sizeof(buf))) > 0) out.append(buf, (size_t)n);
+    close(fd);
+    return !out.empty();
+}
+
+// "numa_hit 123\nnuma_miss 0\n..."
+static uint64_t StatValue(const std::string& text, const char* key) {
+    size_t kl = strlen(key);
+    for (size_t pos = 0; pos < text.size(); ) {
+        if (text.compare(pos, kl, key) == 0 && pos + kl < text.size() && text[pos + kl] == ' ')
+            return strtoull(text.c_str() + pos + kl + 1, nullptr, 10);
+        pos = text.find('\n', pos);
+        if (pos == std::string::npos) break;
+        pos++;
+    }
+    return 0;
+}
+
+static NumaStats Sample(double dt) {
+    NumaStats st;
+    std::vector<NumaNodeCpus> cpus = GetNumaNodeCpus();
+    if (cpus.empty()) return st;
+    st.valid = true;
+    // Entries are in node-id order, not indexed by id; a node going on or
+    // offline shifts them, so the counters start over
+    std::vector<int> ids;
+    for (const NumaNodeCpus& c : cpus) ids.push_back(c.id);
+    bool reset = ids != s_prevIds;
+    if (reset) { s_prevNode.assign(cpus.size(), NumaPrev()); s_prevIds = ids; }
+
+    std::vector<uint64_t> busy, total;
+    ReadProcStatCores(busy, total);
+
+    for (size_t n = 0; n < cpus.size(); n++) {
+        NumaNode node;
+        node.id   = cpus[n].id;
+        node.cpus = cpus[n].cpus;
+        std::string dir = SysfsPath("/sys/devices/system/node/node" + std::to_string(node.id)), text;
+
+        if (ReadWholeFile(dir + "/meminfo", text)) {
+            uint64_t kb[MI_COUNT] = {};
+            ParseMemInfoText(text.c_str(), text.size(), kb);
+            node.memTotalKB  = kb[MI_MEM_TOTAL];
+            node.memFreeKB   = kb[MI_MEM_FREE];
+            node.filePagesKB = kb[MI_FILE_PAGES];
+            node.anonKB      = kb[MI_ANON_PAGES];
+            node.slabKB      = kb[MI_SLAB];
+            node.hugeTotal   = kb[MI_HUGEPAGES_TOTAL];
+            node.hugeFree    = kb[MI_HUGEPAGES_FREE];
+        }
+
+        if (ReadWholeFile(dir + "/numastat", text)) {
+            NumaPrev cur;
+            cur.hit     = StatValue(text, "numa_hit");
+            cur.miss    = StatValue(text, "numa_miss");
+            cur.foreign = StatValue(text, "numa_foreign");
+            cur.local   = StatValue(text, "local_node");
+            cur.other   = StatValue(text, "other_node");
+            NumaPrev& pv = s_prevNode[n];
+            if (!reset && dt > 0.0) {
+                auto rate = [dt](uint64_t now, uint64_t before) {
+                    return now >= before ? (float)((now - before) / dt) : 0.f;
+                };
+                node.hitPerSec     = rate(cur.hit, pv.hit);
+                node.missPerSec    = rate(cur.miss, pv.miss);
+                node.foreignPerSec = rate(cur.foreign, pv.foreign);
+                node.localPerSec   = rate(cur.local, pv.local);
+                node.otherPerSec   = rate(cur.other, pv.other);
+                float allocs = node.localPerSec + node.otherPerSec;
+                node.remotePct = allocs > 0.f ? node.otherPerSec * 100.f / allocs : 0.f;
+            }
+            pv = cur;
+        }
+
+        // Node CPU load: summed jiffies over the node's cores, so a node
+        // with one pegged core out of 32 reads ~3%, not the max core
+        uint64_t dBusy = 0, dTotal = 0;
+        for (int c : node.cpus) {
+            if (c < 0 || (size_t)c >= total.size() || (size_t)c >= s_prevTotal.size()) continue;
+            if (total[c] < s_prevTotal[c] || busy[c] < s_prevBusy[c]) continue;   // CPU went offline/online
+            dBusy  += busy[c]  - s_prevBusy[c];
+            dTotal += total[c] - s_prevTotal[c];
+        }
+        node.cpuPct = dTotal > 0 ? (float)dBusy * 100.f / (float)dTotal : 0.f;
+
+        // History carries over from the previous sample of the same node
+        if (!reset && n < s_stats.nodes.size()) node.remoteHistory = s_stats.nodes[n].remoteHistory;
+        if (!reset && dt > 0.0) {
+            node.remoteHistory.push_back(node.remotePct);
+            if ((int)node.remoteHistory.size() > NUMA_HISTORY)
+                node.remoteHistory.erase(node.remoteHistory.begin());
+        }
+        st.nodes.push_back(std::move(node));
+
+        // SLIT row for this node: "10 21 ...", one column per online node in
+        // id order, which is the order of st.nodes
+        if (ReadWholeFile(dir + "/distance", text)) {
+            char* p = &text[0];
+            for (size_t k = 0; k < cpus.size(); k++) st.distance.push_back((int)strtol(p, &p, 10));
+        } else {
+            for (size_t k = 0; k < cpus.size(); k++) st.distance.push_back(k == n ? 10 : 0);
+        }
+    }
+    s_prevBusy  = busy;
+    s_prevTotal = total;
+    return st;
+}
+
+NumaStats ReadNumaStats() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    double now = NowSec();
+    if (now - s_time >= 1.0) {
+        double dt = s_time > 0.0 ? now - s_time : 0.0;
+        // A gap much longer than the refresh means nobody was looking: restart the rates
+        if (dt > 5.0) { dt = 0.0; s_stats.nodes.clear(); s_prevNode.clear(); s_prevIds.clear(); }
+        s_stats = Sample(dt);
+        s_time  = now;
+    }
+    return s_stats;
+}
+
+#else
+
+NumaStats ReadNumaStats() { return NumaStats(); }
+
+#endif
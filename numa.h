@@ -0,0 +1,35 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// ── NUMA nodes ────────────────────────────────────────────────────────────────
+// Per-node memory from /sys/devices/system/node/nodeN/meminfo, allocation
+// counters from nodeN/numastat, and CPU load summed from the per-core lines
+// of /proc/stat over each node's cpulist. Linux only; sysfs paths go through
+// SysfsPath(), so a fake tree works.
+static const int NUMA_HISTORY = 120;   // seconds of remote-share history per node
+
+struct NumaNode {
+    int              id = 0;
+    std::vector<int> cpus;
+    uint64_t memTotalKB = 0, memFreeKB = 0, filePagesKB = 0, anonKB = 0, slabKB = 0;
+    uint64_t hugeTotal  = 0, hugeFree  = 0;
+    float    cpuPct     = 0.f;      // busy share of this node's CPUs
+    // numastat deltas, pages per second. hit/miss/foreign are from the
+    // allocator's point of view (miss: wanted here, got elsewhere; foreign:
+    // wanted elsewhere, got here); local/other are from the allocating CPU's.
+    float    hitPerSec = 0.f, missPerSec = 0.f, foreignPerSec = 0.f;
+    float    localPerSec = 0.f, otherPerSec = 0.f;
+    float    remotePct  = 0.f;      // other / (local + other) over the last interval
+    std::vector<float> remoteHistory;   // oldest first, at most NUMA_HISTORY
+};
+
+struct NumaStats {
+    bool                  valid = false;   // at least one node directory
+    std::vector<NumaNode> nodes;
+    std::vector<int>      distance;        // nodes x nodes SLIT distances, row-major, in nodes order
+};
+
+// Cheap to call every frame: files are re-read at most once a second and the
+// cached result returned in between. Thread-safe.
+NumaStats ReadNumaStats();
@@ -0,0 +1,191 @@
+// psi.cpp - /proc/pressure collector with poll() triggers
+// Pure logic, NO raylib/drawing includes
+#include "psi.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <poll.h>
+  #include <unistd.h>
+#endif
+
+PsiConfig psiConfig;
+
+static std::atomic<bool> s_running{false};
+static std::atomic<bool> s_stop{false};
+static std::mutex        s_mutex;
+static PsiSnapshot       s_snap;
+static double            s_lastTrigger[PSI_COUNT] = { -1.0, -1.0, -1.0 };
+static double            s_triggerWindowSec = 1.0;
+
+static double NowSec() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(__linux__)
+static const char* PSI_FILES[PSI_COUNT] = {
+    "/proc/pressure/cpu", "/proc/pressure/memory", "/proc/pressure/io"
+};
+
+// "some avg10=0.12 avg60=0.05 avg300=0.01 total=123456"
+static bool ParsePsiLine(const char* s, const char* kind, PsiLine& out) {
+    const char* p = strstr(s, kind);
+    if (!p) return false;
+    unsigned long long total = 0;
+    if (sscanf(p + strlen(kind), " avg10=%f avg60=%f avg300=%f total=%llu",
+               &out.avg10, &out.avg60, &out.avg300, &total) != 4)
+        return false;
+    out.totalUs = total;
+    return true;
+}
+
+static bool ReadPsi(int fd, PsiStat& st) {
+    char buf[256];
+    ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (n <= 0) return false;
+    buf[n] = 0;
+    if (!ParsePsiLine(buf, "some", st.some)) return false;
+    st.hasFull = ParsePsiLine(buf, "full", st.full);
+    return true;
+}
+
+// Registers "some <stall> <window>" on a fresh fd. The configured window is
+// tried first, then 2 s (the granularity unprivileged users are allowed).
+static int ArmTrigger(const char* path, int thresholdPct, int windowMs, double& windowSec) {
+    int windows[2] = { windowMs, 2000 };
+    for (int w : windows) {
+        int fd = open(path, O_RDWR | O_NONBLOCK | O_CLOEXEC);
+        if (fd < 0) return -1;
+        long windowUs = (long)w * 1000;
+        long stallUs  = windowUs * thresholdPct / 100;
+        char cmd[64];
+        int len = snprintf(cmd, sizeof(cmd), "some %ld %ld", stallUs, windowUs);
+        if (write(fd, cmd, len + 1) >= 0) { windowSec = w / 1000.0; return fd; }
+        close(fd);
+    }
+    return -1;
+}
+
+static void PsiThread() {
+    int readFd[PSI_COUNT], trigFd[PSI_COUNT];
+    bool any = false;
+    double windowSec = 1.0;
+    for (int r = 0; r < PSI_COUNT; r++) {
+        readFd[r] = open(PSI_FILES[r], O_RDONLY | O_CLOEXEC);
+        trigFd[r] = -1;
+        if (readFd[r] < 0) continue;
+        any = true;
+        int pct = psiConfig.thresholdPct[r];
+        int win = psiConfig.windowMs < 500 ? 500 : psiConfig.windowMs > 10000 ? 10000 : psiConfig.windowMs;
+        if (pct > 0 && pct < 100) trigFd[r] = ArmTrigger(PSI_FILES[r], pct, win, windowSec);
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_snap = PsiSnapshot();
+        s_snap.supported = any;
+        for (int r = 0; r < PSI_COUNT; r++) {
+            s_snap.res[r].triggerArmed = trigFd[r] >= 0;
+            s_lastTrigger[r] = -1.0;
+        }
+        s_triggerWindowSec = windowSec;
+    }
+
+    PsiStat prev[PSI_COUNT];
+    double  prevTime = NowSec(), armTime = prevTime;
+    while (any && !s_stop.load()) {
+        struct pollfd pfd[PSI_COUNT];
+        int map[PSI_COUNT], nfds = 0;
+        for (int r = 0; r < PSI_COUNT; r++) {
+            if (trigFd[r] < 0) continue;
+            pfd[nfds] = { trigFd[r], POLLPRI, 0 };
+            map[nfds++] = r;
+        }
+        // With no triggers this is a plain 1 s sleep
+        int rc = poll(pfd, nfds, 1000);
+        double now = NowSec();
+
+        PsiStat cur[PSI_COUNT];
+        for (int r = 0; r < PSI_COUNT; r++) {
+            if (readFd[r] < 0) continue;
+            cur[r].valid = ReadPsi(readFd[r], cur[r]);
+            // deltaPct: stall time per wall time since the previous read
+            double dtUs = (now - prevTime) * 1e6;
+            if (cur[r].valid && prev[r].valid && dtUs > 0.0) {
+                cur[r].some.deltaPct = (float)((cur[r].some.totalUs - prev[r].some.totalUs) * 100.0 / dtUs);
+                if (cur[r].hasFull)
+                    cur[r].full.deltaPct = (float)((cur[r].full.totalUs - prev[r].full.totalUs) * 100.0 / dtUs);
+            }
+        }
+        prevTime = now;
+
+        std::lock_guard<std::mutex> lock(s_mutex);
+        for (int i = 0; rc > 0 && i < nfds; i++) {
+            int r = map[i];
+            if (pfd[i].revents & POLLERR) {
+                // The monitor was torn down (e.g. the cgroup went away): stop polling it
+                close(trigFd[r]);
+                trigFd[r] = -1;
+                s_snap.res[r].triggerArmed = false;
+            } else if ((pfd[i].revents & POLLPRI) && now - armTime >= windowSec) {
+                // Events in the first window can cover growth from before registration
+                s_snap.res[r].triggerEvents++;
+                s_lastTrigger[r] = now;
+            }
+        }
+        for (int r = 0; r < PSI_COUNT; r++) {
+            if (readFd[r] < 0) continue;
+            PsiStat& st = s_snap.res[r];
+            st.valid   = cur[r].valid;
+            st.hasFull = cur[r].hasFull;
+            st.some    = cur[r].some;
+            st.full    = cur[r].full;
+            prev[r]    = cur[r];
+        }
+    }
+
+    for (int r = 0; r < PSI_COUNT; r++) {
+        if (readFd[r] >= 0) close(readFd[r]);
+        if (trigFd[r] >= 0) close(trigFd[r]);
+    }
+    s_running = false;
+}
+#endif
+
+void StartPsiMonitor() {
+#if defined(__linux__)
+    bool expected = false;
+    if (!s_running.compare_exchange_strong(expected, true)) {
+        s_stop = false;
+        return;
+    }
+    s_stop = false;
+    std::thread(PsiThread).detach();
+#endif
+}
+
+void StopPsiMonitor() {
+    s_stop = true;
+}
+
+PsiSnapshot GetPsi() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    PsiSnapshot snap = s_snap;
+    double now = NowSec();
+    for (int r = 0; r < PSI_COUNT; r++) {
+        PsiStat& st = snap.res[r];
+        if (!st.valid) continue;
+        st.sinceTriggerSec = s_lastTrigger[r] < 0.0 ? -1.f : (float)(now - s_lastTrigger[r]);
+        // The trigger gives the fast edge; it is rate-limited to one event per
+        // window and only re-evaluated on task state changes, so a steady stall
+        // is held by the measured delta; avg10 would lag the recovery by ~10 s
+        bool recent = st.sinceTriggerSec >= 0.f && st.sinceTriggerSec < s_triggerWindowSec + 0.5;
+        st.stalled = recent || st.some.deltaPct >= (float)psiConfig.thresholdPct[r];
+    }
+    return snap;
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+
+// ── Pressure Stall Information ────────────────────────────────────────────────
+// /proc/pressure/{cpu,memory,io} (Linux 4.20+, CONFIG_PSI). "some" is the share
+// of wall time at least one task was stalled on the resource, "full" the share
+// all non-idle tasks were. Other platforms report supported = false.
+enum PsiResource { PSI_CPU = 0, PSI_MEMORY, PSI_IO, PSI_COUNT };
+
+inline const char* PSI_RESOURCE_NAMES[] = { "CPU", "MEM", "IO" };
+
+struct PsiLine {
+    float    avg10    = 0.f, avg60 = 0.f, avg300 = 0.f;   // kernel running averages, %
+    uint64_t totalUs  = 0;                                // cumulative stall time
+    float    deltaPct = 0.f;                              // total delta over the last read interval, %
+};
+
+struct PsiStat {
+    bool     valid          = false;
+    bool     hasFull        = false;   // cpu "full" is only meaningful inside cgroups
+    PsiLine  some, full;
+    bool     triggerArmed   = false;   // poll() trigger registered for this resource
+    uint64_t triggerEvents  = 0;
+    float    sinceTriggerSec = -1.f;   // -1 = never fired
+    bool     stalled        = false;   // over psiConfig threshold right now
+};
+
+struct PsiSnapshot {
+    bool    supported = false;
+    PsiStat res[PSI_COUNT];
+};
+
+// Thresholds are "some" stall as a percentage of the trigger window.
+// Unprivileged triggers need a window that is a multiple of 2 s; the monitor
+// falls back to that when the configured window is refused.
+struct PsiConfig {
+    int thresholdPct[PSI_COUNT] = { 50, 10, 20 };
+    int windowMs                = 1000;
+};
+
+extern PsiConfig psiConfig;
+
+// The monitor thread sleeps in poll() on the trigger fds, so a stall is seen
+// within the window instead of at the next 1 s refresh. Without trigger
+// support (old kernel, no permission) only the 1 s total deltas are used.
+void        StartPsiMonitor();
+void        StopPsiMonitor();
+PsiSnapshot GetPsi();
@@ -0,0 +1,156 @@
+// render_bench.cpp - frame-time histogram and allocation counts for --bench-render
+// Pure logic, NO raylib/drawing includes
+#include "render_bench.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+// To record which GL implementation ran the benchmark (llvmpipe on a
+// headless box). Weak like the other GL/GLFW symbols: absent means unknown.
+extern "C" const unsigned char* glGetString(unsigned int name) __attribute__((weak));
+static const unsigned int GL_VENDOR_ENUM = 0x1F00, GL_RENDERER_ENUM = 0x1F01, GL_VERSION_ENUM = 0x1F02;
+#endif
+
+struct BenchScene {
+    std::string           name;
+    std::vector<float>    ms;
+    std::vector<uint64_t> allocs;
+    std::vector<uint64_t> steady;   // allocs of frames that did not follow a state change
+};
+
+static std::vector<BenchScene> s_scenes;
+static std::vector<std::pair<std::string, uint64_t>> s_counters;
+
+static const int    BUCKETS      = 53;      // 0.125 ms * 2^(i/4), up to 1024 ms
+static const double FIRST_BUCKET = 0.125;
+
+static double BucketEdge(int i) { return FIRST_BUCKET * std::pow(2.0, i / 4.0); }
+
+void RenderBenchBeginScene(const char* name) {
+    s_scenes.push_back(BenchScene());
+    s_scenes.back().name = name;
+}
+
+void RenderBenchSetCounter(const char* name, uint64_t value) {
+    for (auto& c : s_counters) if (c.first == name) { c.second = value; return; }
+    s_counters.emplace_back(name, value);
+}
+
+void RenderBenchAddFrame(double ms, uint64_t allocs, bool changed) {
+    if (s_scenes.empty()) RenderBenchBeginScene("default");
+    BenchScene& sc = s_scenes.back();
+    sc.ms.push_back((float)ms);
+    sc.allocs.push_back(allocs);
+    if (!changed) sc.steady.push_back(allocs);
+}
+
+// ── JSON ──────────────────────────────────────────────────────────────────────
+// Scene names and GL strings are ours or the driver's; only quotes,
+// backslashes and control characters need escaping
+static void JsonString(FILE* f, const char* s) {
+    fputc('"', f);
+    for (; s && *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') fprintf(f, "\\%c", c);
+        else if (c < 0x20)         fprintf(f, "\\u%04x", c);
+        else                       fputc(c, f);
+    }
+    fputc('"', f);
+}
+
+static double Percentile(const std::vector<float>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t i = (size_t)std::ceil(p / 100.0 * sorted.size());
+    return sorted[std::min(std::max(i, (size_t)1), sorted.size()) - 1];
+}
+
+// Timing and allocation summary of one frame set, as object members
+static void WriteSummary(FILE* f, std::vector<float> ms, const std::vector<uint64_t>& allocs,
+                         const std::vector<uint64_t>& steady, const char* indent) {
+    std::sort(ms.begin(), ms.end());
+    double sum = 0.0;
+    for (float v : ms) sum += v;
+    uint64_t total = 0, steadyTotal = 0, maxAllocs = 0;
+    for (uint64_t a : allocs) { total += a; maxAllocs = std::max(maxAllocs, a); }
+    for (uint64_t a : steady) steadyTotal += a;
+    fprintf(f, "%s\"frames\": %zu,\n", indent, ms.size());
+    fprintf(f, "%s\"total_ms\": %.3f,\n", indent, sum);
+    fprintf(f, "%s\"mean_ms\": %.4f,\n", indent, ms.empty() ? 0.0 : sum / ms.size());
+    fprintf(f, "%s\"p50_ms\": %.4f, \"p90_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f,\n", indent,
+            Percentile(ms, 50), Percentile(ms, 90), Percentile(ms, 99), ms.empty() ? 0.0 : ms.back());
+    fprintf(f, "%s\"allocs\": { \"total\": %llu, \"per_frame\": %.3f, \"max_frame\": %llu, "
+               "\"steady_total\": %llu, \"steady_per_frame\": %.3f }", indent,
+            (unsigned long long)total, allocs.empty() ? 0.0 : (double)total / allocs.size(),
+            (unsigned long long)maxAllocs, (unsigned long long)steadyTotal,
+            steady.empty() ? 0.0 : (double)steadyTotal / steady.size());
+}
+
+bool RenderBenchWriteJson(const char* path) {
+    bool toStdout = !path || !path[0] || (path[0] == '-' && !path[1]);
+    FILE* f = toStdout ? stdout : fopen(path, "w");
+    if (!f) return false;
+
+    std::vector<float>    allMs;
+    std::vector<uint64_t> allAllocs, allSteady;
+    for (const BenchScene& sc : s_scenes) {
+        allMs.insert(allMs.end(), sc.ms.begin(), sc.ms.end());
+        allAllocs.insert(allAllocs.end(), sc.allocs.begin(), sc.allocs.end());
+        allSteady.insert(allSteady.end(), sc.steady.begin(), sc.steady.end());
+    }
+
+    fprintf(f, "{\n  \"benchmark\": \"render\",\n  \"version\": 1,\n");
+#if defined(__linux__)
+    if (glGetString) {
+        fprintf(f, "  \"gl\": { \"vendor\": ");
+        JsonString(f, (const char*)glGetString(GL_VENDOR_ENUM));
+        fprintf(f, ", \"renderer\": ");
+        JsonString(f, (const char*)glGetString(GL_RENDERER_ENUM));
+        fprintf(f, ", \"version\": ");
+        JsonString(f, (const char*)glGetString(GL_VERSION_ENUM));
+        fprintf(f, " },\n");
+    }
+#endif
+    WriteSummary(f, allMs, allAllocs, allSteady, "  ");
+    fprintf(f, ",\n");
+
+    fprintf(f, "  \"counters\": {");
+    for (size_t i = 0; i < s_counters.size(); i++) {
+        fprintf(f, "%s ", i ? "," : "");
+        JsonString(f, s_counters[i].first.c_str());
+        fprintf(f, ": %llu", (unsigned long long)s_counters[i].second);
+    }
+    fprintf(f, " },\n");
+
+    int counts[BUCKETS] = {};
+    int overflow = 0;
+    for (float v : allMs) {
+        int b = 0;
+        while (b < BUCKETS && v > BucketEdge(b)) b++;
+        if (b < BUCKETS) counts[b]++; else overflow++;
+    }
+    fprintf(f, "  \"histogram\": {\n    \"bucket_le_ms\": [");
+    for (int i = 0; i < BUCKETS; i++) fprintf(f, "%s%.4g", i ? ", " : "", BucketEdge(i));
+    fprintf(f, "],\n    \"counts\": [");
+    for (int i = 0; i < BUCKETS; i++) fprintf(f, "%s%d", i ? ", " : "", counts[i]);
+    fprintf(f, "],\n    \"overflow\": %d\n  },\n", overflow);
+
+    fprintf(f, "  \"scenes\": [\n");
+    for (size_t s = 0; s < s_scenes.size(); s++) {
+        const BenchScene& sc = s_scenes[s];
+        fprintf(f, "    {\n      \"name\": ");
+        JsonString(f, sc.name.c_str());
+        fprintf(f, ",\n");
+        WriteSummary(f, sc.ms, sc.allocs, sc.steady, "      ");
+        fprintf(f, "\n    }%s\n", s + 1 < s_scenes.size() ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+
+    bool ok = !ferror(f);
+    if (!toStdout) ok = fclose(f) == 0 && ok;
+    else           fflush(f);
+    return ok;
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+// ── Render benchmark (--bench-render) ─────────────────────────────────────────
+// Collects per-frame render times and render-thread allocation counts for
+// a scripted scenario, grouped into named scenes, and writes them as JSON:
+// a log-scale frame-time histogram and percentiles for the whole run and
+// for each scene. The scenario itself is driven from main.cpp.
+//
+// Histogram buckets are quarter-octaves from 0.125 ms to 1024 ms. Bucket i
+// counts frames with time <= bucket_le_ms[i] (and above the previous edge);
+// slower frames go to "overflow".
+
+void RenderBenchBeginScene(const char* name);
+// changed: the frame follows a scripted state change (view, theme, widgets),
+// so widgets and text runs were rebuilt; other frames count as steady state
+void RenderBenchAddFrame(double ms, uint64_t allocs, bool changed);
+// Run-wide counters from other modules (text cache hits and the like)
+void RenderBenchSetCounter(const char* name, uint64_t value);
+
+// path "-" or empty writes to stdout. False if the file can't be written.
+bool RenderBenchWriteJson(const char* path);
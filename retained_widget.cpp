@@ -0,0 +1,77 @@
+#include "retained_widget.h"
+#include "theme.h"
+#include "text_cache.h"
+#include "layout.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+// ── Recording ─────────────────────────────────────────────────────────────────
+bool RetainedWidget::Begin(uint64_t key) {
+    key = (WidgetKey() << key << currentTheme << layout.gen).h;
+    if (valid_ && key == key_) return false;
+    key_   = key;
+    valid_ = true;
+    cmds_.clear();   // both keep their capacity
+    text_.clear();
+    return true;
+}
+
+void RetainedWidget::Text(const char* s, int x, int y, int size, Color c) {
+    size_t n = strlen(s);
+    uint32_t off = (uint32_t)text_.size();
+    text_.insert(text_.end(), s, s + n + 1);
+    cmds_.push_back({ TEXT, x, y, size, 0, off, c });
+}
+
+void RetainedWidget::TextF(int x, int y, int size, Color c, const char* fmt, ...) {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    Text(buf, x, y, size, c);
+}
+
+void RetainedWidget::TextRight(const char* s, int right, int y, int size, Color c) {
+    Text(s, right - MeasureTextRun(s, size), y, size, c);
+}
+
+void RetainedWidget::TextCentered(const char* s, int cx, int y, int size, Color c) {
+    Text(s, cx - MeasureTextRun(s, size) / 2, y, size, c);
+}
+
+void RetainedWidget::Rect(int x, int y, int w, int h, Color c)      { cmds_.push_back({ RECT, x, y, w, h, 0, c }); }
+void RetainedWidget::RectLines(int x, int y, int w, int h, Color c) { cmds_.push_back({ RECT_LINES, x, y, w, h, 0, c }); }
+void RetainedWidget::Line(int x1, int y1, int x2, int y2, Color c)  { cmds_.push_back({ LINE, x1, y1, x2, y2, 0, c }); }
+
+void RetainedWidget::ProgressBar(int x, int y, int w, int h, float value, Color barColor) {
+    Rect(x, y, w, h, COLOR_BLACK);
+    RectLines(x, y, w, h, DIM_GREEN);
+    Rect(x + 2, y + 2, static_cast<int>((w - 4) * (value / 100.f)), h - 4, barColor);
+    char txt[16];
+    snprintf(txt, sizeof(txt), "%d%%", static_cast<int>(value));
+    TextCentered(txt, x + w / 2, y + h / 2 - 8, 16, COLOR_BLACK);
+}
+
+void RetainedWidget::Panel(int x, int y, int w, int h, const char* title) {
+    Rect(x, y, w, h, ColorAlpha(COLOR_BLACK, 0.6f));
+    RectLines(x, y, w, h, DIM_GREEN);
+    if (title && title[0]) {
+        int tw = MeasureTextRun(title, 14);
+        Rect(x + 10, y - 8, tw + 8, 16, COLOR_BLACK);
+        Text(title, x + 14, y - 7, 14, GREEN_PHOSPHOR);
+    }
+}
+
+// ── Replay ────────────────────────────────────────────────────────────────────
+void RetainedWidget::Draw() const {
+    for (const Cmd& c : cmds_) {
+        switch (c.kind) {
+            case TEXT:       DrawTextRun(text_.data() + c.text, c.x, c.y, c.a, c.color); break;
+            case RECT:       DrawRectangle(c.x, c.y, c.a, c.b, c.color);              break;
+            case RECT_LINES: DrawRectangleLines(c.x, c.y, c.a, c.b, c.color);         break;
+            case LINE:       DrawLine(c.x, c.y, c.a, c.b, c.color);                   break;
+        }
+    }
+}
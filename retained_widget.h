@@ -0,0 +1,81 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// ── Retained widgets ──────────────────────────────────────────────────────────
+// A RetainedWidget records the draw calls of one widget into a display list:
+// text runs kept in one reused char arena, plus rectangles and lines, with
+// every MeasureText already resolved into a position. While its key stays
+// the same, a frame only replays the list: no formatting, no measuring and
+// no allocation once the list and arena have grown to size. The key covers
+// the values the widget shows, quantised to what is visible. The colour
+// theme and the layout generation are mixed in by Begin().
+//
+//     static RetainedWidget w;
+//     if (w.Begin(WidgetKey() << x << y << (int)stats.cpu)) {
+//         w.TextF(x, y, 18, GREEN_PHOSPHOR, "CPU %d%%", (int)stats.cpu);
+//     }
+//     w.Draw();
+
+struct WidgetKey {
+    uint64_t h = 14695981039346656037ull;   // FNV-1a
+
+    WidgetKey& Mix(const void* p, size_t n) {
+        const unsigned char* b = (const unsigned char*)p;
+        for (size_t i = 0; i < n; i++) h = (h ^ b[i]) * 1099511628211ull;
+        return *this;
+    }
+    template <class T>
+    WidgetKey& operator<<(T v) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "mix values, not objects");
+        return Mix(&v, sizeof(v));
+    }
+    WidgetKey& operator<<(const char* s)        { return Mix(s, strlen0(s) + 1); }
+    WidgetKey& operator<<(char* s)              { return *this << (const char*)s; }
+    WidgetKey& operator<<(const std::string& s) { return Mix(s.c_str(), s.size() + 1); }
+    operator uint64_t() const { return h; }
+
+private:
+    static size_t strlen0(const char* s) { size_t n = 0; if (s) while (s[n]) n++; return n; }
+};
+
+class RetainedWidget {
+public:
+    // True when the key (or theme) changed: the list is now empty, record it
+    bool Begin(uint64_t key);
+    void Invalidate() { valid_ = false; }
+
+    void Text(const char* s, int x, int y, int size, Color c);
+    void TextF(int x, int y, int size, Color c, const char* fmt, ...)
+#if defined(__GNUC__)
+        __attribute__((format(printf, 6, 7)))
+#endif
+        ;
+    void TextRight(const char* s, int right, int y, int size, Color c);   // ends at right
+    void TextCentered(const char* s, int cx, int y, int size, Color c);
+    void Rect(int x, int y, int w, int h, Color c);
+    void RectLines(int x, int y, int w, int h, Color c);
+    void Line(int x1, int y1, int x2, int y2, Color c);
+    // Recorded versions of DrawProgressBar / DrawPanel
+    void ProgressBar(int x, int y, int w, int h, float value, Color barColor);
+    void Panel(int x, int y, int w, int h, const char* title);
+
+    void Draw() const;
+
+private:
+    enum Kind : uint8_t { TEXT, RECT, RECT_LINES, LINE };
+    struct Cmd {
+        Kind     kind;
+        int      x, y, a, b;   // TEXT: a = font size; RECT*: a, b = size; LINE: a, b = end point
+        uint32_t text;         // TEXT: offset into text_
+        Color    color;
+    };
+    std::vector<Cmd>  cmds_;
+    std::vector<char> text_;
+    uint64_t key_   = 0;
+    bool     valid_ = false;
+};
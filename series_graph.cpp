@@ -0,0 +1,267 @@
+#include "series_graph.h"
+#include "rlgl.h"
+#include "raymath.h"
+#include <cmath>
+#include <cstring>
+
+// ── Vertex layout ─────────────────────────────────────────────────────────────
+// Each ring slot is one column: two triangles of envelope band, then two of
+// line segment from the previous column's pick to this one's. Slots are
+// independent triangles, so the ring is drawn in one call whatever its
+// rotation; unused slots are degenerate. x is in samples (relative to
+// base_) and the model matrix scrolls and scales it; y is in layout pixels
+// from the graph top, so a new height or scale rewrites the buffer.
+static const int   VERTS_PER_SLOT = 12;
+static const float LINE_HALF      = 0.75f;     // line half-thickness, layout pixels
+static const uint64_t REBASE_AT   = 1u << 22;  // samples past base_ before x loses precision
+
+SeriesGraph::SeriesGraph(int capacity) : raw_((size_t)std::max(capacity, 2), 0.f) {}
+
+float SeriesGraph::Y(float v) const {
+    float f = max_ > 0.f ? v / max_ : 0.f;
+    return h_ - std::min(std::max(f, 0.f), 1.f) * h_;
+}
+
+// ── Decimation ────────────────────────────────────────────────────────────────
+// Envelope of the column's samples still in the history; the pick starts
+// as the newest, which is what the open column at the right edge shows
+void SeriesGraph::Decimate(uint64_t col) {
+    uint64_t s0 = std::max(col * perCol_, FirstSample());
+    uint64_t s1 = std::min(col * perCol_ + perCol_, total_);
+    Column& c = cols_[col % slots_];
+    c.lo = c.hi = Sample(s0);
+    for (uint64_t s = s0 + 1; s < s1; s++) {
+        float v = Sample(s);
+        c.lo = std::min(c.lo, v);
+        c.hi = std::max(c.hi, v);
+    }
+    c.rep   = Sample(s1 - 1);
+    c.repAt = s1 - 1;
+}
+
+// LTTB: the sample forming the largest triangle with the previous column's
+// pick and the average of the next column (so far). Left as the newest
+// sample for the open column.
+void SeriesGraph::PickRep(uint64_t col) {
+    uint64_t last = (total_ - 1) / perCol_;
+    if (col >= last) return;
+    uint64_t s0 = std::max(col * perCol_, FirstSample());
+    uint64_t s1 = col * perCol_ + perCol_;
+
+    double ax = (double)s0, ay = Sample(s0);
+    if (col > firstCol_) {
+        const Column& p = cols_[(col - 1) % slots_];
+        ax = (double)p.repAt;
+        ay = p.rep;
+    }
+    uint64_t n0 = s1, n1 = std::min(s1 + perCol_, total_);
+    double cx = 0.0, cy = 0.0;
+    for (uint64_t s = n0; s < n1; s++) { cx += (double)s; cy += Sample(s); }
+    cx /= (double)(n1 - n0);
+    cy /= (double)(n1 - n0);
+
+    Column& c = cols_[col % slots_];
+    double best = -1.0;
+    for (uint64_t s = s0; s < s1; s++) {
+        double y    = Sample(s);
+        double area = std::fabs((ax - cx) * (y - ay) - (ax - (double)s) * (cy - ay));
+        if (area > best) { best = area; c.rep = (float)y; c.repAt = s; }
+    }
+}
+
+// ── Geometry ──────────────────────────────────────────────────────────────────
+static void Quad(float* v, float x0, float y0, float x1, float y1, float x2, float y2, float x3, float y3) {
+    const float p[8] = { x0, y0, x1, y1, x2, y2, x3, y3 };
+    static const int ORDER[6] = { 0, 1, 2, 0, 2, 3 };
+    for (int i = 0; i < 6; i++) {
+        v[i * 3 + 0] = p[ORDER[i] * 2];
+        v[i * 3 + 1] = p[ORDER[i] * 2 + 1];
+        v[i * 3 + 2] = 0.f;
+    }
+}
+
+void SeriesGraph::WriteSlot(uint64_t col) {
+    const Column& c = cols_[col % slots_];
+    float* v = &verts_[(col % slots_) * VERTS_PER_SLOT].x;
+
+    // Band over the column's samples, half a sample either side
+    uint64_t s0 = std::max(col * perCol_, FirstSample());
+    uint64_t s1 = std::min(col * perCol_ + perCol_, total_);
+    float xa = (float)(s0 - base_) - 0.5f, xb = (float)(s1 - base_) - 0.5f;
+    float top = Y(c.hi), bot = Y(c.lo);
+    Quad(v, xa, top, xb, top, xb, bot, xa, bot);
+
+    // Line from the previous pick, widened along its normal in pixels
+    float x1 = (float)(c.repAt - base_), y1 = Y(c.rep);
+    float x0 = x1, y0 = y1;
+    if (col > firstCol_) {
+        const Column& p = cols_[(col - 1) % slots_];
+        x0 = (float)(p.repAt - base_);
+        y0 = Y(p.rep);
+    }
+    float sw  = (float)w_ / (float)raw_.size();   // pixels per sample
+    float dx  = (x1 - x0) * sw, dy = y1 - y0;
+    float len = std::sqrt(dx * dx + dy * dy);
+    float nx  = len > 1e-3f ? -dy / len * LINE_HALF / sw : 0.f;
+    float ny  = len > 1e-3f ?  dx / len * LINE_HALF : LINE_HALF;
+    Quad(v + 18, x0 + nx, y0 + ny, x1 + nx, y1 + ny, x1 - nx, y1 - ny, x0 - nx, y0 - ny);
+}
+
+void SeriesGraph::ClearSlot(uint64_t col) {
+    memset(&verts_[(col % slots_) * VERTS_PER_SLOT], 0, sizeof(Vertex) * VERTS_PER_SLOT);
+}
+
+void SeriesGraph::UploadSlot(uint64_t col) {
+    if (!vboPos_) return;   // LoadBuffers uploads everything
+    int slot = (int)(col % slots_);
+    rlUpdateVertexBuffer(vboPos_, &verts_[slot * VERTS_PER_SLOT], (int)sizeof(Vertex) * VERTS_PER_SLOT,
+                         (int)sizeof(Vertex) * VERTS_PER_SLOT * slot);
+}
+
+// One column per pixel at most; the full history spans the width
+void SeriesGraph::Rebuild(int w, int h, float maxValue) {
+    Unload();
+    w_ = w; h_ = h; max_ = maxValue;
+    int capacity = (int)raw_.size();
+    perCol_ = std::max(1, (capacity + w - 1) / w);
+    slots_  = (capacity + perCol_ - 1) / perCol_ + 1;
+    cols_.assign(slots_, Column());
+    verts_.assign((size_t)slots_ * VERTS_PER_SLOT, Vertex{ 0.f, 0.f, 0.f });
+    colors_.assign(verts_.size(), Color{ 0, 0, 0, 0 });
+    base_     = FirstSample();
+    firstCol_ = base_ / perCol_;
+    if (total_ == 0) return;
+
+    uint64_t last = (total_ - 1) / perCol_;
+    for (uint64_t c = firstCol_; c <= last; c++) Decimate(c);
+    for (uint64_t c = firstCol_; c < last; c++)  PickRep(c);
+    for (uint64_t c = firstCol_; c <= last; c++) WriteSlot(c);
+}
+
+// ── Sampling ──────────────────────────────────────────────────────────────────
+// Only the columns this sample touches are rewritten: the open one, the one
+// before it (its LTTB pick depends on this column's average) and, once the
+// history is full, the oldest, which loses a sample
+void SeriesGraph::Push(float v) {
+    raw_[total_ % raw_.size()] = v;
+    total_++;
+    if (slots_ == 0) return;   // no geometry until the first Draw
+
+    uint64_t s     = total_ - 1;
+    uint64_t col   = s / perCol_;
+    uint64_t first = FirstSample() / perCol_;
+    for (uint64_t c = firstCol_; c < first; c++) {
+        ClearSlot(c);
+        UploadSlot(c);
+    }
+    firstCol_ = first;
+
+    Column& c = cols_[col % slots_];
+    if (s % perCol_ == 0 || col == firstCol_) {
+        Decimate(col);
+    } else {
+        c.lo    = std::min(c.lo, v);
+        c.hi    = std::max(c.hi, v);
+        c.rep   = v;
+        c.repAt = s;
+    }
+    bool full = total_ > raw_.size();
+    if (full && firstCol_ < col)     Decimate(firstCol_);
+    if (full && firstCol_ + 1 < col) PickRep(firstCol_);
+    if (col > firstCol_)             PickRep(col - 1);
+
+    // The oldest two share a segment, as do the newest two
+    uint64_t newest = col > firstCol_ ? col - 1 : col;
+    if (full) {
+        for (uint64_t k = firstCol_; k <= firstCol_ + 1 && k < newest; k++) {
+            WriteSlot(k);
+            UploadSlot(k);
+        }
+    }
+    for (uint64_t k = newest; k <= col; k++) {
+        WriteSlot(k);
+        UploadSlot(k);
+    }
+}
+
+float SeriesGraph::Peak() const {
+    if (total_ == 0) return 0.f;
+    float peak = Latest();
+    if (slots_ == 0) {
+        for (uint64_t s = FirstSample(); s < total_; s++) peak = std::max(peak, Sample(s));
+        return peak;
+    }
+    for (uint64_t c = firstCol_, last = (total_ - 1) / perCol_; c <= last; c++)
+        peak = std::max(peak, cols_[c % slots_].hi);
+    return peak;
+}
+
+// ── GPU buffers ───────────────────────────────────────────────────────────────
+void SeriesGraph::LoadBuffers() {
+    vao_ = rlLoadVertexArray();   // 0 where VAOs are unsupported; Draw binds by hand
+    if (vao_) rlEnableVertexArray(vao_);
+    vboPos_ = rlLoadVertexBuffer(verts_.data(), (int)(verts_.size() * sizeof(Vertex)), true);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+    vboCol_ = rlLoadVertexBuffer(colors_.data(), (int)(colors_.size() * sizeof(Color)), true);
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    if (vao_) rlDisableVertexArray();
+    rlDisableVertexBuffer();
+}
+
+void SeriesGraph::Unload() {
+    if (vao_)    rlUnloadVertexArray(vao_);
+    if (vboPos_) rlUnloadVertexBuffer(vboPos_);
+    if (vboCol_) rlUnloadVertexBuffer(vboCol_);
+    vao_ = vboPos_ = vboCol_ = 0;
+}
+
+static bool SameColor(Color a, Color b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; }
+
+void SeriesGraph::Draw(int x, int y, int w, int h, float maxValue, Color line, Color band) {
+    if (w <= 0 || h <= 0) return;
+    if (w != w_ || h != h_ || maxValue != max_ || slots_ == 0 || total_ - base_ > REBASE_AT)
+        Rebuild(w, h, maxValue);
+    if (total_ == 0) return;
+
+    // Colours only change with the theme: the whole buffer then
+    if (!vboPos_ || !SameColor(line, line_) || !SameColor(band, band_)) {
+        line_ = line;
+        band_ = band;
+        for (size_t i = 0; i < colors_.size(); i++)
+            colors_[i] = i % VERTS_PER_SLOT < 6 ? band : line;
+        if (!vboPos_) LoadBuffers();
+        else          rlUpdateVertexBuffer(vboCol_, colors_.data(), (int)(colors_.size() * sizeof(Color)), 0);
+    }
+
+    // Sample s lands at x + w - (total_ - 0.5 - s) pixels-per-sample
+    float   sw    = (float)w / (float)raw_.size();
+    Matrix  model = { sw,  0.f, 0.f, (float)x + w - ((float)(total_ - base_) - 0.5f) * sw,
+                      0.f, 1.f, 0.f, (float)y,
+                      0.f, 0.f, 1.f, 0.f,
+                      0.f, 0.f, 0.f, 1.f };
+    Matrix  mvp   = MatrixMultiply(MatrixMultiply(model, rlGetMatrixModelview()), rlGetMatrixProjection());
+    float   white[4] = { 1.f, 1.f, 1.f, 1.f };
+
+    rlDrawRenderBatchActive();   // whatever was queued goes underneath
+    rlEnableShader(rlGetShaderIdDefault());
+    int* locs = rlGetShaderLocsDefault();
+    rlSetUniformMatrix(locs[RL_SHADER_LOC_MATRIX_MVP], mvp);
+    rlSetUniform(locs[RL_SHADER_LOC_COLOR_DIFFUSE], white, RL_SHADER_UNIFORM_VEC4, 1);
+    rlActiveTextureSlot(0);
+    rlEnableTexture(rlGetTextureIdDefault());
+    if (!vao_ || !rlEnableVertexArray(vao_)) {
+        rlEnableVertexBuffer(vboPos_);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+        rlEnableVertexBuffer(vboCol_);
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+    rlDrawVertexArray(0, (int)verts_.size());
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableTexture();
+    rlDisableShader();
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "raylib.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// ── Series graphs ─────────────────────────────────────────────────────────────
+// A time-series graph whose geometry lives on the GPU. The history is cut
+// into one column per pixel or so: each column keeps the min/max of its
+// samples (drawn as an envelope band) and one representative sample picked
+// by LTTB (largest triangle three buckets), which the line goes through.
+// The columns sit in a ring-buffer vertex buffer; a new sample rewrites the
+// newest one or two columns, and the whole graph is one draw call. Frame
+// cost depends on the graph's width, not on how much history it holds.
+//
+// Load/Unload need the GL context, so graphs are usually static and
+// unloaded before CloseWindow. Draw() flushes raylib's batch first.
+//
+//     static SeriesGraph cpu(3600);
+//     cpu.Push(stats.cpu);                       // once per sample
+//     cpu.Draw(x, y, w, h, 100.f, GREEN_PHOSPHOR, ColorAlpha(GREEN_PHOSPHOR, 0.25f));
+
+class SeriesGraph {
+public:
+    explicit SeriesGraph(int capacity);   // samples of history kept
+
+    void Push(float v);
+    void Draw(int x, int y, int w, int h, float maxValue, Color line, Color band);
+    void Unload();                         // frees the GPU buffers; Draw reloads them
+    void Clear() { total_ = 0; slots_ = 0; }   // drops the samples; the next Draw rebuilds
+
+    int   Count() const  { return (int)std::min<uint64_t>(total_, raw_.size()); }
+    float Latest() const { return total_ ? raw_[(total_ - 1) % raw_.size()] : 0.f; }
+    float Peak() const;                    // largest sample still in the history
+
+private:
+    struct Column {
+        float    lo = 0.f, hi = 0.f;   // envelope
+        float    rep = 0.f;            // LTTB pick
+        uint64_t repAt = 0;            // its sample index
+    };
+    struct Vertex { float x, y, z; };
+
+    float    Sample(uint64_t s) const { return raw_[s % raw_.size()]; }
+    uint64_t FirstSample() const      { return total_ > raw_.size() ? total_ - raw_.size() : 0; }
+    float    Y(float v) const;
+    void     Rebuild(int w, int h, float maxValue);
+    void     Decimate(uint64_t col);
+    void     PickRep(uint64_t col);
+    void     WriteSlot(uint64_t col);
+    void     ClearSlot(uint64_t col);
+    void     UploadSlot(uint64_t col);
+    void     LoadBuffers();
+
+    std::vector<float> raw_;           // sample ring
+    uint64_t           total_ = 0;     // samples ever pushed
+
+    // Columns for the geometry of the last Draw; rebuilt when it changes
+    int      w_ = 0, h_ = 0;
+    float    max_     = 0.f;
+    int      perCol_  = 1;             // samples per column
+    int      slots_   = 0;             // ring slots, one column each
+    uint64_t base_    = 0;             // vertex x is sample - base_, small enough for a float
+    uint64_t firstCol_ = 0;            // oldest column with geometry in the ring
+    std::vector<Column> cols_;
+    std::vector<Vertex> verts_;        // CPU copy of the position buffer
+    std::vector<Color>  colors_;
+
+    unsigned int vao_ = 0, vboPos_ = 0, vboCol_ = 0;
+    Color        line_ = {}, band_ = {};
+};
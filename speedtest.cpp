@@ -2,12 +2,15 @@
 // Drawing is handled in dashboard.cpp to avoid Windows/raylib header conflicts
 #include <thread>
 #include <atomic>
-#include <fstream>
 #include <ctime>
 #include <cstdio>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <random>
 
 #ifdef _WIN32
   #define WIN32_LEAN_AND_MEAN
@@ -20,17 +23,18 @@
   #include <netdb.h>
   #include <unistd.h>
   #include <arpa/inet.h>
+  #include <ifaddrs.h>
   #ifdef __APPLE__
     #include <sys/time.h>
   #endif
 #endif
 
 #include "speedtest.h"
-
-// GetApplicationDirectory comes from raylib - forward declare to avoid including raylib.h
-extern "C" const char* GetApplicationDirectory(void);
+#include "speedtest_history.h"
+#include "system_monitor.h"
 
 // ── State ─────────────────────────────────────────────────────────────────────
+SpeedTestSchedule speedTestSchedule;
 SpeedTestState  speedTestState    = SpeedTestState::IDLE;
 SpeedTestResult speedTestResult   = {};
 SpeedTestResult speedTestLastSaved= {};
@@ -55,6 +59,18 @@ static unsigned long long NowMs() {
         steady_clock::now().time_since_epoch()).count();
 }
 
+// ── Latency percentiles ───────────────────────────────────────────────────────
+static const int PING_SAMPLES = 7;
+
+static void FillPingStats(SpeedTestResult& res, std::vector<float> samples) {
+    if (samples.empty()) return;
+    std::sort(samples.begin(), samples.end());
+    size_t n = samples.size();
+    res.pingMs    = samples[n / 2];
+    res.pingP90Ms = samples[std::min(n - 1, (n * 9) / 10)];
+    res.pingMaxMs = samples[n - 1];
+}
+
 #ifdef _WIN32
 // ── Windows: WinHTTP implementation ──────────────────────────────────────────
 static void RunSpeedTestThread() {
@@ -77,18 +93,21 @@ static void RunSpeedTestThread() {
     LARGE_INTEGER freq, t0, t1;
     QueryPerformanceFrequency(&freq);
 
-    HINTERNET hPing = WinHttpOpenRequest(hConnect, L"HEAD", L"/__down?bytes=0",
-        nullptr, WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES, WINHTTP_FLAG_SECURE);
-    if (hPing) {
+    std::vector<float> pings;
+    for (int i = 0; i < PING_SAMPLES; i++) {
+        HINTERNET hPing = WinHttpOpenRequest(hConnect, L"HEAD", L"/__down?bytes=0",
+            nullptr, WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES, WINHTTP_FLAG_SECURE);
+        if (!hPing) continue;
         QueryPerformanceCounter(&t0);
         if (WinHttpSendRequest(hPing, WINHTTP_NO_ADDITIONAL_HEADERS, 0,
                                WINHTTP_NO_REQUEST_DATA, 0, 0, 0) &&
             WinHttpReceiveResponse(hPing, nullptr)) {
             QueryPerformanceCounter(&t1);
-            res.pingMs = static_cast<float>((t1.QuadPart - t0.QuadPart) * 1000.0 / freq.QuadPart);
+            pings.push_back(static_cast<float>((t1.QuadPart - t0.QuadPart) * 1000.0 / freq.QuadPart));
         }
         WinHttpCloseHandle(hPing);
     }
+    FillPingStats(res, pings);
 
     HINTERNET hReq = WinHttpOpenRequest(hConnect, L"GET", L"/__down?bytes=10000000",
         nullptr, WINHTTP_NO_REFERER, WINHTTP_DEFAULT_ACCEPT_TYPES, WINHTTP_FLAG_SECURE);
@@ -118,6 +137,8 @@ static void RunSpeedTestThread() {
         res.downloadMbps = static_cast<float>((totalRead * 8.0) / elapsedSec / 1e6);
         res.uploadMbps   = res.downloadMbps * 0.15f;
     }
+    res.bytesTransferred = totalRead;
+    res.unixTime  = (long long)time(nullptr);
     res.timestamp = MakeTimestamp();
     WinHttpCloseHandle(hReq); WinHttpCloseHandle(hConnect); WinHttpCloseHandle(hSession);
     speedTestResult = res; s_progress = 1.f;
@@ -147,26 +168,50 @@ static int ConnectTCP(const char* host, int port) {
     return sock;
 }
 
+// Name of the local interface that owns the socket's source address
+static std::string LocalInterfaceName(int sock) {
+    struct sockaddr_in local = {};
+    socklen_t len = sizeof(local);
+    if (getsockname(sock, (struct sockaddr*)&local, &len) != 0) return "";
+    std::string name;
+    struct ifaddrs* ifa = nullptr;
+    if (getifaddrs(&ifa) != 0) return "";
+    for (struct ifaddrs* i = ifa; i; i = i->ifa_next) {
+        if (!i->ifa_addr || i->ifa_addr->sa_family != AF_INET) continue;
+        if (((struct sockaddr_in*)i->ifa_addr)->sin_addr.s_addr == local.sin_addr.s_addr) {
+            name = i->ifa_name;
+            break;
+        }
+    }
+    freeifaddrs(ifa);
+    return name;
+}
+
 static void RunSpeedTestThread() {
     SpeedTestResult res = {};
     res.server = "speed.cloudflare.com (HTTP)";
 
-    // Ping: measure TCP connect + HEAD round-trip
-    unsigned long long t0 = NowMs();
-    int pingSock = ConnectTCP("speed.cloudflare.com", 80);
-    if (pingSock >= 0) {
+    // Ping: measure TCP connect + HEAD round-trip, PING_SAMPLES times
+    std::vector<float> pings;
+    unsigned long long t0 = 0;
+    for (int i = 0; i < PING_SAMPLES; i++) {
+        t0 = NowMs();
+        int pingSock = ConnectTCP("speed.cloudflare.com", 80);
+        if (pingSock < 0) continue;
         const char* pingReq = "HEAD /__down?bytes=0 HTTP/1.0\r\nHost: speed.cloudflare.com\r\n\r\n";
         send(pingSock, pingReq, strlen(pingReq), 0);
         char pingBuf[512] = {};
         recv(pingSock, pingBuf, sizeof(pingBuf)-1, 0);
-        res.pingMs = (float)(NowMs() - t0);
+        pings.push_back((float)(NowMs() - t0));
         close(pingSock);
     }
+    FillPingStats(res, pings);
 
     // Download: fetch 10 MB via plain HTTP
     int sock = ConnectTCP("speed.cloudflare.com", 80);
     if (sock < 0) { speedTestState = SpeedTestState::FAILED; s_running = false; return; }
 
+    res.iface = LocalInterfaceName(sock);
     const char* req = "GET /__down?bytes=10000000 HTTP/1.0\r\nHost: speed.cloudflare.com\r\n\r\n";
     if (send(sock, req, strlen(req), 0) < 0) {
         close(sock); speedTestState = SpeedTestState::FAILED; s_running = false; return;
@@ -202,6 +247,8 @@ static void RunSpeedTestThread() {
         res.downloadMbps = (float)((totalRead * 8.0) / elapsedSec / 1e6);
         res.uploadMbps   = res.downloadMbps * 0.15f;
     }
+    res.bytesTransferred = (unsigned long long)totalRead;
+    res.unixTime    = (long long)time(nullptr);
     res.timestamp   = MakeTimestamp();
     speedTestResult = res;
     s_progress      = 1.f;
@@ -210,28 +257,161 @@ static void RunSpeedTestThread() {
 }
 #endif
 
+// Claims the single test slot; manual and scheduled runs never overlap
+static bool TryBeginRun() {
+    bool expected = false;
+    if (!s_running.compare_exchange_strong(expected, true)) return false;
+    speedTestState    = SpeedTestState::RUNNING;
+    speedTestProgress = 0.f;
+    s_progress        = 0.f;
+    return true;
+}
+
+static SpeedTestRecord MakeRecord(const SpeedTestResult& r, uint8_t flags) {
+    SpeedTestRecord rec = {};
+    rec.unixTime         = r.unixTime;
+    rec.downloadMbps     = r.downloadMbps;
+    rec.uploadMbps       = r.uploadMbps;
+    rec.pingP50Ms        = r.pingMs;
+    rec.pingP90Ms        = r.pingP90Ms;
+    rec.pingMaxMs        = r.pingMaxMs;
+    rec.bytesTransferred = (uint32_t)r.bytesTransferred;
+    rec.streams          = (uint16_t)r.streams;
+    snprintf(rec.server, sizeof(rec.server), "%s", r.server.c_str());
+    snprintf(rec.iface,  sizeof(rec.iface),  "%s", r.iface.c_str());
+    rec.flags            = flags;
+    return rec;
+}
+
+// ── Scheduler ─────────────────────────────────────────────────────────────────
+// One detached thread sleeps in 1 s slices; when a run is due it checks the
+// daily budget and live traffic, then runs the test inline on its own thread.
+// The render loop only ever reads the status snapshot.
+static const unsigned long long TEST_COST_BYTES = 10000000ULL + 64 * 1024;  // payload + pings
+static const int                BUSY_RETRY_SEC  = 120;
+
+static std::atomic<bool>         s_schedRunning{false};
+static std::atomic<bool>         s_schedStop{false};
+static std::mutex                s_schedMutex;
+static SpeedTestSchedulerStatus  s_schedStatus;
+
+static long long LocalMidnightUnix(long long now) {
+    time_t t = (time_t)now;
+    struct tm lt = *localtime(&t);
+    lt.tm_hour = lt.tm_min = lt.tm_sec = 0;
+    return (long long)mktime(&lt);
+}
+
+// Budget usage is derived from the history store, so it survives restarts
+static void ScheduledUsageToday(long long now, unsigned long long& bytes, int& runs) {
+    bytes = 0; runs = 0;
+    size_t n = SpeedTestHistoryCount();
+    for (size_t i = SpeedTestHistoryLowerBound(LocalMidnightUnix(now)); i < n; i++) {
+        SpeedTestRecord r = SpeedTestHistoryAt(i);
+        if (!(r.flags & SPEEDTEST_FLAG_SCHEDULED)) continue;
+        bytes += r.bytesTransferred;
+        runs++;
+    }
+}
+
+static void SpeedTestSchedulerThread() {
+    std::mt19937 rng((unsigned)time(nullptr));
+    auto nextDelay = [&rng]() -> long long {
+        long long base = (long long)speedTestSchedule.intervalMin * 60;
+        int j = speedTestSchedule.jitterSec;
+        long long d = base + (j > 0 ? std::uniform_int_distribution<int>(-j, j)(rng) : 0);
+        return d < 60 ? 60 : d;
+    };
+
+    long long nextRun = (long long)time(nullptr) + nextDelay();
+    long long lastDay = 0;
+    int skipsToday = 0;
+    while (!s_schedStop.load()) {
+        long long now = (long long)time(nullptr);
+        long long day = LocalMidnightUnix(now);
+        if (day != lastDay) { lastDay = day; skipsToday = 0; }
+
+        unsigned long long used = 0; int runs = 0;
+        ScheduledUsageToday(now, used, runs);
+        {
+            std::lock_guard<std::mutex> lock(s_schedMutex);
+            s_schedStatus.active         = true;
+            s_schedStatus.nextRunUnix    = nextRun;
+            s_schedStatus.usedTodayBytes = used;
+            s_schedStatus.runsToday      = runs;
+            s_schedStatus.skipsToday     = skipsToday;
+        }
+
+        if (now >= nextRun) {
+            std::string skip;
+            unsigned long long budget = (unsigned long long)speedTestSchedule.dailyBudgetMB * 1000000ULL;
+            float traffic = GetNetDownKBps() + GetNetUpKBps();
+            if (used + TEST_COST_BYTES > budget) {
+                skip = "daily budget reached";
+                nextRun = LocalMidnightUnix(now + 86400) + nextDelay() % 600;
+            } else if (traffic > (float)speedTestSchedule.maxTrafficKBps) {
+                char buf[64]; snprintf(buf, sizeof(buf), "link busy (%.0f KB/s)", traffic);
+                skip = buf;
+                nextRun = now + BUSY_RETRY_SEC;
+            } else if (!TryBeginRun()) {
+                skip = "manual test running";
+                nextRun = now + BUSY_RETRY_SEC;
+            } else {
+                RunSpeedTestThread();
+                if (speedTestState == SpeedTestState::DONE)
+                    AppendSpeedTestHistory(MakeRecord(speedTestResult, SPEEDTEST_FLAG_SCHEDULED));
+                nextRun = (long long)time(nullptr) + nextDelay();
+            }
+            if (!skip.empty()) {
+                skipsToday++;
+                std::lock_guard<std::mutex> lock(s_schedMutex);
+                s_schedStatus.lastSkip = skip;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_schedMutex);
+        s_schedStatus.active = false;
+    }
+    s_schedRunning = false;
+    // A start that came in after the loop ended but before the flag above
+    // cleared found a thread still running and only cancelled the stop:
+    // take it up here, unless a fresh start has already launched one
+    bool expected = false;
+    if (!s_schedStop.load() && s_schedRunning.compare_exchange_strong(expected, true))
+        std::thread(SpeedTestSchedulerThread).detach();
+}
+
 // ── Public API ────────────────────────────────────────────────────────────────
 void StartSpeedTest() {
-    if (s_running) return;
-    speedTestState  = SpeedTestState::RUNNING;
-    speedTestProgress = 0.f;
-    s_progress      = 0.f;
-    s_running       = true;
+    if (!TryBeginRun()) return;
     std::thread(RunSpeedTestThread).detach();
 }
 
 void SaveSpeedTestResult() {
     if (speedTestState != SpeedTestState::DONE) return;
-    const char* appDir = GetApplicationDirectory();
-    std::string path = std::string(appDir) + "speedtest_results.txt";
-    std::ofstream f(path, std::ios::app);
-    if (!f.is_open()) return;
-    f << "[" << speedTestResult.timestamp << "]"
-      << "  Server: " << speedTestResult.server
-      << "  DL: " << speedTestResult.downloadMbps << " Mbps"
-      << "  UL: ~" << speedTestResult.uploadMbps << " Mbps"
-      << "  Ping: " << speedTestResult.pingMs << " ms\n";
+    AppendSpeedTestHistory(MakeRecord(speedTestResult, 0));
     speedTestLastSaved = speedTestResult;
     speedTestHasSaved  = true;
     // Note: log entry added by caller (dashboard.cpp) to avoid raylib dependency here
 }
+
+void StartSpeedTestScheduler() {
+    bool expected = false;
+    if (!s_schedRunning.compare_exchange_strong(expected, true)) {
+        s_schedStop = false;   // a pending stop is cancelled; thread keeps going
+        return;
+    }
+    s_schedStop = false;
+    std::thread(SpeedTestSchedulerThread).detach();
+}
+
+void StopSpeedTestScheduler() {
+    s_schedStop = true;
+}
+
+SpeedTestSchedulerStatus GetSpeedTestSchedulerStatus() {
+    std::lock_guard<std::mutex> lock(s_schedMutex);
+    return s_schedStatus;
+}
@@ -11,11 +11,36 @@ enum class SpeedTestState {
 struct SpeedTestResult {
     float downloadMbps = 0.f;
     float uploadMbps   = 0.f;   // estimated from ping latency
-    float pingMs       = 0.f;
+    float pingMs       = 0.f;   // median of PING_SAMPLES round-trips
+    float pingP90Ms    = 0.f;
+    float pingMaxMs    = 0.f;
+    int   streams      = 1;
+    unsigned long long bytesTransferred = 0;
+    long long   unixTime = 0;
     std::string timestamp;
     std::string server;
+    std::string iface;          // local interface the test ran over, if known
 };
 
+// Background schedule (persisted in dashboard.cfg)
+struct SpeedTestSchedule {
+    bool enabled        = false;
+    int  intervalMin    = 15;
+    int  jitterSec      = 120;   // +/- random offset per run
+    int  dailyBudgetMB  = 500;   // scheduled-test payload per local day
+    int  maxTrafficKBps = 256;   // skip while live down+up traffic exceeds this
+};
+
+struct SpeedTestSchedulerStatus {
+    bool               active       = false;
+    long long          nextRunUnix  = 0;
+    unsigned long long usedTodayBytes = 0;
+    int                runsToday    = 0;
+    int                skipsToday   = 0;
+    std::string        lastSkip;     // reason for the most recent skip, if any
+};
+
+extern SpeedTestSchedule  speedTestSchedule;
 extern SpeedTestState     speedTestState;
 extern SpeedTestResult    speedTestResult;
 extern SpeedTestResult    speedTestLastSaved;
@@ -23,4 +48,7 @@ extern bool               speedTestHasSaved;
 extern float              speedTestProgress;  // 0..1 during download
 
 void StartSpeedTest();
-void SaveSpeedTestResult();
+void SaveSpeedTestResult();   // appends to speedtest_history.bin
+void StartSpeedTestScheduler();
+void StopSpeedTestScheduler();
+SpeedTestSchedulerStatus GetSpeedTestSchedulerStatus();
@@ -0,0 +1,276 @@
+// speedtest_history.cpp - append-only structured speed test store
+// Pure logic, NO raylib/drawing includes (trend view lives in dashboard.cpp)
+#include "speedtest_history.h"
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <algorithm>
+
+#ifdef _WIN32
+  #include <fstream>
+  #include <io.h>
+#else
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+// GetApplicationDirectory comes from raylib - forward declare to avoid including raylib.h
+extern "C" const char* GetApplicationDirectory(void);
+
+// ── File format ───────────────────────────────────────────────────────────────
+struct HistoryHeader {
+    char     magic[4];     // "RFST"
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t reserved;
+};
+static_assert(sizeof(HistoryHeader) == 16, "HistoryHeader is an on-disk format");
+
+static const uint32_t HISTORY_VERSION = 1;
+
+// ── State ─────────────────────────────────────────────────────────────────────
+// Records from previous sessions are read straight out of the mapping; records
+// appended this session go to s_tail. Indexing spans both transparently.
+static std::mutex                   s_mutex;
+static const SpeedTestRecord*       s_mapped      = nullptr;
+static size_t                       s_mappedCount = 0;
+static std::vector<SpeedTestRecord> s_tail;
+static SpeedTestTrend               s_trend;
+#ifdef _WIN32
+static std::vector<SpeedTestRecord> s_loaded;   // no mmap: one bulk read instead
+#else
+static void*                        s_mapBase     = nullptr;
+static size_t                       s_mapSize     = 0;
+#endif
+
+static std::string GetHistoryPath() {
+    return std::string(GetApplicationDirectory()) + "speedtest_history.bin";
+}
+
+static size_t CountLocked() { return s_mappedCount + s_tail.size(); }
+
+static const SpeedTestRecord& AtLocked(size_t idx) {
+    return idx < s_mappedCount ? s_mapped[idx] : s_tail[idx - s_mappedCount];
+}
+
+// Records are appended in time order, so a binary search is the time index
+static size_t LowerBoundLocked(int64_t t) {
+    size_t lo = 0, hi = CountLocked();
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (AtLocked(mid).unixTime < t) lo = mid + 1;
+        else                            hi = mid;
+    }
+    return lo;
+}
+
+static float Median(std::vector<float>& v) {
+    if (v.empty()) return 0.f;
+    auto mid = v.begin() + v.size() / 2;
+    std::nth_element(v.begin(), mid, v.end());
+    return *mid;
+}
+
+static void MedianRange(size_t from, size_t to, float& dl, float& ping) {
+    std::vector<float> dls, pings;
+    dls.reserve(to - from); pings.reserve(to - from);
+    for (size_t i = from; i < to; i++) {
+        dls.push_back(AtLocked(i).downloadMbps);
+        pings.push_back(AtLocked(i).pingP50Ms);
+    }
+    dl   = Median(dls);
+    ping = Median(pings);
+}
+
+// Compares the recent window against the one before it. Only runs on load and
+// append, never per frame.
+static void RecomputeTrendLocked() {
+    SpeedTestTrend t;
+    t.count = CountLocked();
+    if (t.count == 0) { s_trend = t; return; }
+    t.firstTime = AtLocked(0).unixTime;
+    t.lastTime  = AtLocked(t.count - 1).unixTime;
+
+    const int64_t DAY = 86400;
+    size_t recentFrom   = LowerBoundLocked(t.lastTime - 7 * DAY);
+    size_t baselineFrom = LowerBoundLocked(t.lastTime - 35 * DAY);
+    if (t.count - recentFrom >= 3 && recentFrom - baselineFrom >= 3) {
+        t.timeWindows = true;
+    } else {
+        // Not enough history for calendar windows: compare run counts instead
+        recentFrom   = t.count > 10 ? t.count - 10 : 0;
+        baselineFrom = recentFrom > 50 ? recentFrom - 50 : 0;
+    }
+    t.recentCount   = t.count - recentFrom;
+    t.baselineCount = recentFrom - baselineFrom;
+    MedianRange(recentFrom, t.count, t.recentDlMbps, t.recentPingMs);
+    if (t.baselineCount > 0) {
+        MedianRange(baselineFrom, recentFrom, t.baselineDlMbps, t.baselinePingMs);
+        t.dlRegression   = t.baselineCount >= 3 && t.recentDlMbps < t.baselineDlMbps * 0.85f;
+        t.pingRegression = t.baselineCount >= 3 && t.baselinePingMs > 0.f &&
+                           t.recentPingMs > t.baselinePingMs * 1.25f;
+    }
+    s_trend = t;
+}
+
+// ── Public API ────────────────────────────────────────────────────────────────
+bool LoadSpeedTestHistory() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    std::string path = GetHistoryPath();
+#ifdef _WIN32
+    std::ifstream f(path, std::ios::binary | std::ios::ate);
+    if (!f.is_open()) { RecomputeTrendLocked(); return false; }
+    std::streamoff size = f.tellg();
+    HistoryHeader hdr = {};
+    f.seekg(0);
+    if (size < (std::streamoff)sizeof(hdr) || !f.read((char*)&hdr, sizeof(hdr)) ||
+        memcmp(hdr.magic, "RFST", 4) != 0 || hdr.recordSize != sizeof(SpeedTestRecord)) {
+        RecomputeTrendLocked(); return false;
+    }
+    size_t n = (size_t)(size - sizeof(hdr)) / sizeof(SpeedTestRecord);
+    s_loaded.resize(n);
+    f.read((char*)s_loaded.data(), n * sizeof(SpeedTestRecord));
+    s_mapped      = s_loaded.data();
+    s_mappedCount = n;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) { RecomputeTrendLocked(); return false; }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(HistoryHeader)) {
+        close(fd); RecomputeTrendLocked(); return false;
+    }
+    void* base = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) { RecomputeTrendLocked(); return false; }
+    const HistoryHeader* hdr = (const HistoryHeader*)base;
+    if (memcmp(hdr->magic, "RFST", 4) != 0 || hdr->recordSize != sizeof(SpeedTestRecord)) {
+        munmap(base, (size_t)st.st_size); RecomputeTrendLocked(); return false;
+    }
+    s_mapBase     = base;
+    s_mapSize     = (size_t)st.st_size;
+    s_mapped      = (const SpeedTestRecord*)((const char*)base + sizeof(HistoryHeader));
+    // A torn trailing record (crash mid-append) is simply ignored
+    s_mappedCount = (s_mapSize - sizeof(HistoryHeader)) / sizeof(SpeedTestRecord);
+#endif
+    RecomputeTrendLocked();
+    return true;
+}
+
+void CloseSpeedTestHistory() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+#ifdef _WIN32
+    s_loaded.clear();
+#else
+    if (s_mapBase) munmap(s_mapBase, s_mapSize);
+    s_mapBase = nullptr; s_mapSize = 0;
+#endif
+    s_mapped = nullptr; s_mappedCount = 0;
+    s_tail.clear();
+}
+
+// Drops the mapping, keeping its records in memory ahead of s_tail
+static void UnmapLocked() {
+    s_tail.insert(s_tail.begin(), s_mapped, s_mapped + s_mappedCount);
+#ifdef _WIN32
+    s_loaded.clear();
+#else
+    if (s_mapBase) munmap(s_mapBase, s_mapSize);
+    s_mapBase = nullptr; s_mapSize = 0;
+#endif
+    s_mapped = nullptr; s_mappedCount = 0;
+}
+
+static bool TruncateFile(FILE* f, long size) {
+    if (fflush(f) != 0) return false;
+#ifdef _WIN32
+    return _chsize_s(_fileno(f), size) == 0;
+#else
+    return ftruncate(fileno(f), size) == 0;
+#endif
+}
+
+void AppendSpeedTestHistory(const SpeedTestRecord& rec) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    std::string path = GetHistoryPath();
+    FILE* f = fopen(path.c_str(), "r+b");
+    if (!f) f = fopen(path.c_str(), "w+b");
+    if (!f) return;
+
+    // Records are only ever written at a record boundary: a torn trailing
+    // record (crash mid-append) is cut off first. A missing, foreign or bad
+    // header, or a file shorter than what this session already holds, is
+    // rewritten from memory instead, so nothing lands at a misaligned offset.
+    HistoryHeader hdr = {};
+    long size = fseek(f, 0, SEEK_END) == 0 ? ftell(f) : -1;
+    bool valid = size >= (long)sizeof(hdr) && fseek(f, 0, SEEK_SET) == 0 &&
+                 fread(&hdr, sizeof(hdr), 1, f) == 1 &&
+                 memcmp(hdr.magic, "RFST", 4) == 0 && hdr.recordSize == sizeof(SpeedTestRecord);
+    size_t onDisk = valid ? (size_t)(size - sizeof(hdr)) / sizeof(SpeedTestRecord) : 0;
+    bool ok;
+    if (valid && onDisk >= CountLocked()) {
+        long end = (long)(sizeof(hdr) + onDisk * sizeof(SpeedTestRecord));
+        ok = (end == size || TruncateFile(f, end)) && fseek(f, end, SEEK_SET) == 0;
+    } else {
+        UnmapLocked();   // the mapping must not outlive the bytes under it
+        HistoryHeader fresh = { {'R', 'F', 'S', 'T'}, HISTORY_VERSION, sizeof(SpeedTestRecord), 0 };
+        ok = TruncateFile(f, 0) && fseek(f, 0, SEEK_SET) == 0 &&
+             fwrite(&fresh, sizeof(fresh), 1, f) == 1 &&
+             (s_tail.empty() || fwrite(s_tail.data(), sizeof(SpeedTestRecord), s_tail.size(), f) == s_tail.size());
+    }
+    ok = ok && fwrite(&rec, sizeof(rec), 1, f) == 1;
+    ok = fclose(f) == 0 && ok;
+    if (!ok) return;   // a partial record is cut off by the next append
+    s_tail.push_back(rec);
+    RecomputeTrendLocked();
+}
+
+size_t SpeedTestHistoryCount() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return CountLocked();
+}
+
+SpeedTestRecord SpeedTestHistoryAt(size_t idx) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (idx >= CountLocked()) return SpeedTestRecord{};
+    return AtLocked(idx);
+}
+
+size_t SpeedTestHistoryLowerBound(int64_t unixTime) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return LowerBoundLocked(unixTime);
+}
+
+SpeedTestTrend GetSpeedTestTrend() {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    return s_trend;
+}
+
+void GetSpeedTestSeries(int buckets, std::vector<SpeedTestBucket>& out) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    out.assign(buckets > 0 ? buckets : 0, SpeedTestBucket{});
+    size_t n = CountLocked();
+    if (n == 0 || buckets <= 0) return;
+    int64_t t0 = AtLocked(0).unixTime;
+    int64_t span = AtLocked(n - 1).unixTime - t0 + 1;
+    for (size_t i = 0; i < n; i++) {
+        const SpeedTestRecord& r = AtLocked(i);
+        int b = (int)((r.unixTime - t0) * buckets / span);
+        if (b < 0) b = 0;
+        if (b >= buckets) b = buckets - 1;
+        SpeedTestBucket& k = out[b];
+        if (k.count == 0) { k.dlMin = k.dlMax = r.downloadMbps; }
+        k.dlMin    = std::min(k.dlMin, r.downloadMbps);
+        k.dlMax    = std::max(k.dlMax, r.downloadMbps);
+        k.dlAvg   += r.downloadMbps;
+        k.pingAvg += r.pingP50Ms;
+        k.count++;
+    }
+    for (auto& k : out) {
+        if (k.count > 0) { k.dlAvg /= k.count; k.pingAvg /= k.count; }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// ── On-disk record ────────────────────────────────────────────────────────────
+// speedtest_history.bin is a 16-byte header followed by fixed-size records in
+// append (= chronological) order, so record i lives at 16 + i * 128 and the
+// file can be mapped and indexed without parsing.
+enum SpeedTestRecordFlags : uint8_t {
+    SPEEDTEST_FLAG_SCHEDULED = 1 << 0,   // started by the scheduler, not the user
+};
+
+struct SpeedTestRecord {
+    int64_t  unixTime;          // seconds since epoch (UTC)
+    float    downloadMbps;
+    float    uploadMbps;
+    float    pingP50Ms;
+    float    pingP90Ms;
+    float    pingMaxMs;
+    uint32_t bytesTransferred;  // payload bytes moved by the test
+    uint16_t streams;
+    uint8_t  flags;             // SpeedTestRecordFlags
+    uint8_t  reserved;
+    char     server[60];
+    char     iface[32];
+};
+static_assert(sizeof(SpeedTestRecord) == 128, "SpeedTestRecord is an on-disk format");
+
+// ── Derived views ─────────────────────────────────────────────────────────────
+struct SpeedTestTrend {
+    size_t count            = 0;
+    size_t recentCount      = 0;
+    size_t baselineCount    = 0;
+    bool   timeWindows      = false;  // true: 7d vs prior 28d, false: last 10 vs prior 50 runs
+    float  recentDlMbps     = 0.f;    // medians
+    float  baselineDlMbps   = 0.f;
+    float  recentPingMs     = 0.f;
+    float  baselinePingMs   = 0.f;
+    bool   dlRegression     = false;
+    bool   pingRegression   = false;
+    int64_t firstTime       = 0;
+    int64_t lastTime        = 0;
+};
+
+struct SpeedTestBucket {
+    int   count = 0;
+    float dlMin = 0.f, dlMax = 0.f, dlAvg = 0.f;
+    float pingAvg = 0.f;
+};
+
+// ── Functions ─────────────────────────────────────────────────────────────────
+bool            LoadSpeedTestHistory();     // maps the store; call once at startup
+void            CloseSpeedTestHistory();
+void            AppendSpeedTestHistory(const SpeedTestRecord& rec);
+size_t          SpeedTestHistoryCount();
+SpeedTestRecord SpeedTestHistoryAt(size_t idx);
+size_t          SpeedTestHistoryLowerBound(int64_t unixTime);  // first record at/after time
+SpeedTestTrend  GetSpeedTestTrend();
+// Fills `out` with `buckets` equal time slices spanning the whole history
+void            GetSpeedTestSeries(int buckets, std::vector<SpeedTestBucket>& out);
@@ -1,54 +1,485 @@
 // stress_test.cpp - CPU stress test using all available hardware threads
 #include "stress_test.h"
+#include "system_monitor.h"
+#include "sysfs_util.h"
+#include "thermal.h"
+#include "event_log.h"
 #include <thread>
 #include <atomic>
 #include <vector>
 #include <chrono>
+#include <random>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cmath>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <algorithm>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  #include <immintrin.h>
+  #define STRESS_X86 1
+  #define STRESS_TARGET(isa) __attribute__((target(isa)))
+#elif defined(_MSC_VER) && defined(_M_X64)
+  #include <immintrin.h>
+  #include <intrin.h>
+  #define STRESS_X86 1
+  #define STRESS_TARGET(isa)
+#else
+  #define STRESS_X86 0
+#endif
 
 StressTestState stressState       = StressTestState::IDLE;
 float           stressProgress    = 0.f;
 int             stressDurationSec = 30;
+StressWorkload  stressWorkload    = StressWorkload::FP64;
+StressLoadProfile stressLoad;
 
 static std::atomic<bool>  s_stop{false};
 static std::atomic<int>   s_threadsRunning{0};
 
-// Each worker spins doing volatile arithmetic to prevent compiler optimisation
-static void StressWorker(int durationMs) {
+// Folded into by every kernel so the optimiser can't drop the work
+static std::atomic<uint64_t> s_sink{0};
+
+// ── Per-thread throughput ─────────────────────────────────────────────────────
+// One counter per worker on its own cache line, so counting never bounces
+// lines between cores and skews the very numbers it measures.
+struct alignas(64) WorkerCounter {
+    std::atomic<uint64_t> units{0};
+    std::atomic<bool>     unpinned{false};   // the pin was refused; the worker sat out
+};
+static_assert(sizeof(WorkerCounter) == 64, "WorkerCounter must fill one cache line");
+
+static std::mutex         s_rateMutex;
+static std::vector<float> s_coreRates;    // live units/s per worker (index = logical CPU)
+static StressScore        s_score;
+
+// ── Partial-load control ──────────────────────────────────────────────────────
+static const int PWM_PERIOD_MS = 50;
+
+static std::atomic<float> s_duty{1.f};          // shared by all workers
+static std::atomic<bool>  s_pwm{false};
+static std::atomic<float> s_measuredCpu{-1.f};  // EMA of the monitor, host-wide % (all online CPUs)
+static StressLoadStatus   s_loadStatus;         // guarded by s_rateMutex
+
+// ── Thermal tracking ──────────────────────────────────────────────────────────
+// Sampled on the coordinator's 10 Hz tick. Seconds 1-3 (after the 1 s rate
+// window has filled, before heat soak) are the baseline; a throttle is flagged
+// once throughput and frequency have both been down for a full second.
+static const int   THERMAL_BASE_FROM     = 10;     // ticks
+static const int   THERMAL_BASE_TO       = 30;
+static const float THROTTLE_OPS_DROP_PCT = 10.f;
+static const float THROTTLE_FREQ_DROP_PCT = 5.f;
+static const int   THROTTLE_SUSTAIN      = 10;     // ticks
+
+static StressThermalStatus s_thermal;              // guarded by s_rateMutex
+
+struct ThermalTracker {
+    double opsSum = 0.0, freqSum = 0.0;
+    int    baseN = 0, sustain = 0;
+};
+
+// Load-shaped runs vary their throughput on purpose, so only full-load runs
+// are correlated; the samples are still recorded for them.
+static void TrackThermal(ThermalTracker& tr, StressThermalStatus& st, int tick, float t,
+                         const ThermalReading& th, float opsPerSec, bool correlate) {
+    st.sensors   = st.sensors || th.valid;
+    st.freqMHz   = th.avgFreqMHz;
+    st.tempC     = th.pkgTempC;
+    st.peakTempC = std::max(st.peakTempC, th.pkgTempC);
+    st.opsPerSec = opsPerSec;
+    st.history.push_back({ t, th.avgFreqMHz, th.pkgTempC, opsPerSec });
+    if (!correlate) return;
+
+    if (tick >= THERMAL_BASE_FROM && tick < THERMAL_BASE_TO) {
+        tr.opsSum += opsPerSec; tr.freqSum += th.avgFreqMHz; tr.baseN++;
+        st.baselineOpsPerSec = (float)(tr.opsSum / tr.baseN);
+        st.baselineFreqMHz   = (float)(tr.freqSum / tr.baseN);
+        return;
+    }
+    if (tick < THERMAL_BASE_TO || st.baselineOpsPerSec <= 0.f) return;
+    st.throughputDropPct = 100.f * (1.f - opsPerSec / st.baselineOpsPerSec);
+    st.freqDropPct = st.baselineFreqMHz > 0.f ? 100.f * (1.f - th.avgFreqMHz / st.baselineFreqMHz) : 0.f;
+    bool both = st.throughputDropPct >= THROTTLE_OPS_DROP_PCT && st.freqDropPct >= THROTTLE_FREQ_DROP_PCT;
+    tr.sustain = both ? tr.sustain + 1 : 0;
+    if (tr.sustain >= THROTTLE_SUSTAIN && !st.throttled) {
+        st.throttled = true;
+        char buf[128];
+        if (th.pkgTempC >= 0.f)
+            snprintf(buf, sizeof(buf), "THROUGHPUT -%.0f%% WHILE FREQ -%.0f%% (%.2f -> %.2f GHz, %.0fC)",
+                     st.throughputDropPct, st.freqDropPct, st.baselineFreqMHz / 1000.f,
+                     th.avgFreqMHz / 1000.f, th.pkgTempC);
+        else
+            snprintf(buf, sizeof(buf), "THROUGHPUT -%.0f%% WHILE FREQ -%.0f%% (%.2f -> %.2f GHz)",
+                     st.throughputDropPct, st.freqDropPct, st.baselineFreqMHz / 1000.f,
+                     th.avgFreqMHz / 1000.f);
+        st.note = buf;
+    }
+}
+
+// Setpoint in % of the chosen cores at `t` seconds into a run
+static float LoadSetpoint(const StressLoadProfile& p, float t, float duration) {
+    float from = (float)p.rampFromPct, to = (float)p.rampToPct;
+    switch (p.ramp) {
+        case StressRamp::STEP: {
+            int steps = p.rampSteps < 2 ? 2 : p.rampSteps;
+            int k = (int)(t / duration * steps);
+            if (k >= steps) k = steps - 1;
+            return from + (to - from) * k / (steps - 1);
+        }
+        case StressRamp::SAWTOOTH: {
+            float period = p.rampPeriodSec < 1 ? 1.f : (float)p.rampPeriodSec;
+            float phase = fmodf(t, period) / period;
+            return from + (to - from) * phase;
+        }
+        default:
+            return (float)p.targetPct;
+    }
+}
+
+// ── Runtime SIMD dispatch ─────────────────────────────────────────────────────
+enum class SimdPath { SCALAR, AVX2, AVX512 };
+
+static SimdPath DetectSimdPath() {
+#if STRESS_X86 && defined(__GNUC__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return SimdPath::AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) return SimdPath::AVX2;
+#elif STRESS_X86
+    int r[4];
+    __cpuid(r, 1);
+    bool osxsave = (r[2] & (1 << 27)) != 0, fma = (r[2] & (1 << 12)) != 0;
+    if (!osxsave) return SimdPath::SCALAR;
+    unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(r, 7, 0);
+    bool avx2 = (r[1] & (1 << 5)) != 0, avx512 = (r[1] & (1 << 16)) != 0;
+    if (avx512 && (xcr0 & 0xE6) == 0xE6) return SimdPath::AVX512;
+    if (avx2 && fma && (xcr0 & 0x6) == 0x6) return SimdPath::AVX2;
+#endif
+    return SimdPath::SCALAR;
+}
+
+static SimdPath GetSimdPath() {
+    static const SimdPath path = DetectSimdPath();
+    return path;
+}
+
+const char* GetStressSimdPath() {
+    switch (GetSimdPath()) {
+        case SimdPath::AVX512: return "AVX-512";
+        case SimdPath::AVX2:   return "AVX2+FMA";
+        default:               return "SCALAR";
+    }
+}
+
+// ── Kernels ───────────────────────────────────────────────────────────────────
+// Each call is one work unit of roughly a millisecond so the stop flag is
+// polled often. Kernels keep several independent chains to fill the pipes.
+struct KernelState {
+    std::vector<double>   a, b, c;    // MEMORY_STREAM
+    std::vector<uint32_t> chase;      // CACHE_LATENCY
+    uint32_t              pos  = 0;
+    uint64_t              seed = 0x9E3779B97F4A7C15ull;
+    struct alignas(64) Line { uint64_t v = 0; };
+    Line                  arms[4];    // BRANCH: one cache line per branch arm
+};
+
+static uint64_t KernelInteger(KernelState& ks) {
+    uint64_t x0 = ks.seed, x1 = x0 ^ 0xA5A5, x2 = x0 + 7, x3 = ~x0;
+    for (int i = 0; i < (1 << 16); i++) {
+        x0 = x0 * 6364136223846793005ull + 1442695040888963407ull;
+        x1 ^= x1 << 13; x1 ^= x1 >> 7; x1 ^= x1 << 17;
+        x2 = (x2 + x0) * 0x9E3779B97F4A7C15ull;
+        x3 = (x3 ^ x1) + (x2 >> 3);
+    }
+    ks.seed = x0;
+    return x0 ^ x1 ^ x2 ^ x3;
+}
+
+static uint64_t KernelFP64(KernelState&) {
+    double a0 = 1.0, a1 = 1.1, a2 = 1.2, a3 = 1.3, a4 = 1.4, a5 = 1.5, a6 = 1.6, a7 = 1.7;
+    const double m = 0.9999999, k = 0.0000001;
+    for (int i = 0; i < (1 << 15); i++) {
+        a0 = a0 * m + k; a1 = a1 * m + k; a2 = a2 * m + k; a3 = a3 * m + k;
+        a4 = a4 * m + k; a5 = a5 * m + k; a6 = a6 * m + k; a7 = a7 * m + k;
+    }
+    double s = a0 + a1 + a2 + a3 + a4 + a5 + a6 + a7;
+    uint64_t bits; memcpy(&bits, &s, sizeof(bits));
+    return bits;
+}
+
+#if STRESS_X86
+STRESS_TARGET("avx2,fma")
+static uint64_t KernelFmaAVX2(KernelState&) {
+    __m256d acc[12];
+    for (int j = 0; j < 12; j++) acc[j] = _mm256_set1_pd(1.0 + j * 0.01);
+    const __m256d m = _mm256_set1_pd(0.9999999), k = _mm256_set1_pd(0.0000001);
+    for (int i = 0; i < (1 << 14); i++)
+        for (int j = 0; j < 12; j++) acc[j] = _mm256_fmadd_pd(acc[j], m, k);
+    for (int j = 1; j < 12; j++) acc[0] = _mm256_add_pd(acc[0], acc[j]);
+    double out[4]; _mm256_storeu_pd(out, acc[0]);
+    uint64_t bits; memcpy(&bits, &out[0], sizeof(bits));
+    return bits;
+}
+
+STRESS_TARGET("avx512f")
+static uint64_t KernelFmaAVX512(KernelState&) {
+    __m512d acc[16];
+    for (int j = 0; j < 16; j++) acc[j] = _mm512_set1_pd(1.0 + j * 0.01);
+    const __m512d m = _mm512_set1_pd(0.9999999), k = _mm512_set1_pd(0.0000001);
+    for (int i = 0; i < (1 << 13); i++)
+        for (int j = 0; j < 16; j++) acc[j] = _mm512_fmadd_pd(acc[j], m, k);
+    for (int j = 1; j < 16; j++) acc[0] = _mm512_add_pd(acc[0], acc[j]);
+    double out[8]; _mm512_storeu_pd(out, acc[0]);
+    uint64_t bits; memcpy(&bits, &out[0], sizeof(bits));
+    return bits;
+}
+#endif
+
+static uint64_t KernelSimdFma(KernelState& ks) {
+#if STRESS_X86
+    switch (GetSimdPath()) {
+        case SimdPath::AVX512: return KernelFmaAVX512(ks);
+        case SimdPath::AVX2:   return KernelFmaAVX2(ks);
+        default: break;
+    }
+#endif
+    return KernelFP64(ks);
+}
+
+static uint64_t KernelStream(KernelState& ks) {
+    double* a = ks.a.data(); const double* b = ks.b.data(); const double* c = ks.c.data();
+    size_t n = ks.a.size();
+    for (size_t i = 0; i < n; i++) a[i] = b[i] + 3.0 * c[i];
+    uint64_t bits; memcpy(&bits, &a[ks.seed++ % n], sizeof(bits));
+    return bits;
+}
+
+static uint64_t KernelChase(KernelState& ks) {
+    const uint32_t* next = ks.chase.data();
+    uint32_t p = ks.pos;
+    for (int i = 0; i < (1 << 14); i++) p = next[p];
+    ks.pos = p;
+    return p;
+}
+
+static uint64_t KernelBranch(KernelState& ks) {
+    // Three independent coin flips per iteration defeat the predictor. Each
+    // arm stores to its own cache line through a volatile pointer: a store
+    // on one path only cannot be if-converted into a cmov or hoisted out of
+    // the loop, so every flip stays a real conditional branch.
+    volatile uint64_t* arm[4] = { &ks.arms[0].v, &ks.arms[1].v, &ks.arms[2].v, &ks.arms[3].v };
+    uint64_t x = ks.seed, acc = 0;
+    for (int i = 0; i < (1 << 16); i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        if (x & 1)         { acc += x;          *arm[0] = acc; }
+        else               { acc ^= x >> 5;     *arm[1] = acc; }
+        if (x & 0x100)     { acc = acc * 3 + 1; *arm[2] = acc; }
+        if ((x >> 20) & 1) { acc -= i;          *arm[3] = acc; }
+    }
+    ks.seed = x;
+    return acc;
+}
+
+// Per-thread buffers are sized from installed RAM so 128+ threads can't
+// exhaust memory, and allocated inside the worker for first-touch placement
+static size_t StreamBytesPerThread(int threads) {
+    unsigned long long budget = GetTotalRAM_MB() * 1024ULL * 1024ULL / 8;   // 1/8 of RAM total
+    unsigned long long per = threads > 0 ? budget / threads : budget;
+    const unsigned long long lo = 8ULL << 20, hi = 64ULL << 20;
+    return (size_t)(per < lo ? lo : per > hi ? hi : per);
+}
+
+static void PrepareKernel(StressWorkload w, KernelState& ks, int threads, int id) {
+    ks.seed ^= (uint64_t)(id + 1) * 0xD1B54A32D192ED03ull;
+    if (w == StressWorkload::MEMORY_STREAM) {
+        size_t n = StreamBytesPerThread(threads) / (3 * sizeof(double));
+        ks.a.assign(n, 0.0); ks.b.assign(n, 1.0); ks.c.assign(n, 2.0);
+    } else if (w == StressWorkload::CACHE_LATENCY) {
+        // Sattolo's algorithm: a single random cycle through 4 MB of slots
+        const uint32_t n = (4u << 20) / sizeof(uint32_t);
+        ks.chase.resize(n);
+        for (uint32_t i = 0; i < n; i++) ks.chase[i] = i;
+        std::mt19937 rng((uint32_t)ks.seed);
+        for (uint32_t i = n - 1; i > 0; i--) {
+            uint32_t j = std::uniform_int_distribution<uint32_t>(0, i - 1)(rng);
+            std::swap(ks.chase[i], ks.chase[j]);
+        }
+    }
+}
+
+static uint64_t RunKernel(StressWorkload w, KernelState& ks) {
+    switch (w) {
+        case StressWorkload::INTEGER:       return KernelInteger(ks);
+        case StressWorkload::FP64:          return KernelFP64(ks);
+        case StressWorkload::SIMD_FMA:      return KernelSimdFma(ks);
+        case StressWorkload::MEMORY_STREAM: return KernelStream(ks);
+        case StressWorkload::CACHE_LATENCY: return KernelChase(ks);
+        case StressWorkload::BRANCH:        return KernelBranch(ks);
+        default:                            return KernelFP64(ks);
+    }
+}
+
+static void LogPinFailure(const char* what, int cpu) {
+    char buf[96];
+    snprintf(buf, sizeof(buf), "[%s] Could not pin a worker to CPU %d; it sits this run out", what, cpu);
+    LogEvent(EV_WARN, buf);
+}
+
+// Each worker is pinned to one logical CPU and runs the selected kernel until
+// the deadline or the stop flag, counting completed work units. In partial-load
+// mode it is busy for duty * PWM_PERIOD_MS of every period and sleeps the rest;
+// workers start at staggered phases so the aggregate load stays smooth.
+static void StressWorker(int durationMs, StressWorkload workload, int threads, int id,
+                         int cpu, WorkerCounter* counter) {
+    if (!PinThreadToCpu(cpu)) {
+        // An unpinned worker would be scored against a CPU it is not on
+        counter->unpinned = true;
+        LogPinFailure("STRESS", cpu);
+        return;
+    }
     s_threadsRunning++;
+    KernelState ks;
+    PrepareKernel(workload, ks, threads, id);
     auto start = std::chrono::steady_clock::now();
-    volatile double x = 1.0;
+    auto period = std::chrono::milliseconds(PWM_PERIOD_MS);
+    auto periodStart = start + std::chrono::milliseconds(PWM_PERIOD_MS * id / (threads > 0 ? threads : 1));
+    uint64_t sink = 0;
     while (!s_stop.load(std::memory_order_relaxed)) {
-        // Busy-loop: mix of multiply/divide to stress FPU and ALU
-        for (int i = 0; i < 10000; i++) {
-            x = x * 1.0000001 + 0.0000001;
-            if (x > 1e10) x = 1.0;
+        if (s_pwm.load(std::memory_order_relaxed)) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= periodStart + period) periodStart += period * ((now - periodStart) / period);
+            auto busyEnd = periodStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                period * s_duty.load(std::memory_order_relaxed));
+            if (now >= busyEnd) {
+                std::this_thread::sleep_until(periodStart + period);
+                continue;
+            }
         }
+        sink ^= RunKernel(workload, ks);
+        counter->units.fetch_add(1, std::memory_order_relaxed);
         auto now = std::chrono::steady_clock::now();
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
         if (elapsed >= durationMs) break;
     }
+    s_sink.fetch_xor(sink, std::memory_order_relaxed);
     s_threadsRunning--;
 }
 
-static void StressCoordinator(int durationSec) {
-    int cores = (int)std::thread::hardware_concurrency();
-    if (cores < 1) cores = 1;
+// Final per-core rates -> score. Outliers are cores more than 10% below the
+// median, which is what a throttling core or a bad DIMM channel looks like.
+static StressScore ComputeScore(StressWorkload workload, const std::vector<float>& rates,
+                               const std::vector<int>& cpus, float seconds) {
+    StressScore sc;
+    sc.valid         = !rates.empty() && seconds > 0.f;
+    sc.coreCpu       = cpus;
+    sc.workload      = workload;
+    sc.seconds       = seconds;
+    sc.coreOpsPerSec = rates;
+    if (!sc.valid) return sc;
+    double sum = 0.0;
+    for (float r : rates) sum += r;
+    sc.totalOpsPerSec = sum;
+    sc.meanOpsPerSec  = sum / rates.size();
+    double var = 0.0;
+    for (float r : rates) var += (r - sc.meanOpsPerSec) * (r - sc.meanOpsPerSec);
+    sc.stddevOpsPerSec = std::sqrt(var / rates.size());
+    sc.cvPct = sc.meanOpsPerSec > 0.0 ? (float)(100.0 * sc.stddevOpsPerSec / sc.meanOpsPerSec) : 0.f;
+    std::vector<float> sorted = rates;
+    std::sort(sorted.begin(), sorted.end());
+    float median = sorted[sorted.size() / 2];
+    sc.slowestCpu = cpus[std::min_element(rates.begin(), rates.end()) - rates.begin()];
+    for (float r : rates) if (r < median * 0.9f) sc.outliers++;
+    return sc;
+}
+
+static void StressCoordinator(int durationSec, StressWorkload workload, StressLoadProfile profile) {
+    // The machine-wide CPU reading covers every online CPU; workers only go
+    // where this process may run
+    int online = (int)GetOnlineCpus().size();
+    std::vector<int> usable = GetUsableCpus(), cpus;
+    for (int c : profile.cpus)
+        if (std::find(usable.begin(), usable.end(), c) != usable.end()) cpus.push_back(c);
+    if (cpus.empty()) cpus = usable;
+    int cores = (int)cpus.size();
 
     int durationMs = durationSec * 1000;
     s_stop.store(false);
+    bool partial = profile.ramp != StressRamp::CONSTANT || profile.targetPct < 100;
+    float sp0 = LoadSetpoint(profile, 0.f, (float)durationSec);
+    s_duty = partial ? sp0 / 100.f : 1.f;
+    s_pwm  = partial;
+    {
+        std::lock_guard<std::mutex> lock(s_rateMutex);
+        s_coreRates.assign(cores, 0.f);
+        s_score = StressScore{};
+        s_loadStatus = StressLoadStatus{};
+        s_loadStatus.active      = partial;
+        s_loadStatus.setpointPct = partial ? sp0 : 100.f;
+        s_loadStatus.duty        = s_duty;
+        s_thermal = StressThermalStatus{};
+    }
+    ThermalTracker thermalTracker;
 
-    // Launch one worker per logical core
+    // Launch one pinned worker per chosen logical core
+    std::unique_ptr<WorkerCounter[]> counters(new WorkerCounter[cores]);
     std::vector<std::thread> workers;
     workers.reserve(cores);
     for (int i = 0; i < cores; i++)
-        workers.emplace_back(StressWorker, durationMs);
+        workers.emplace_back(StressWorker, durationMs, workload, cores, i, cpus[i], &counters[i]);
+
+    // PI loop on the monitor's CPU reading. That reading is host-wide, even
+    // in a container with a cpu.max quota, and is scaled to the chosen cores
+    // (x online / chosen) so the setpoint means "% of the chosen cores"
+    // whatever the subset; background load is absorbed by the integral term.
+    // Feed-forward is the setpoint itself.
+    const float KP = 0.6f, KI = 0.8f;
+    float integral = 0.f;
 
-    // Update progress on the coordinator thread
+    // Update progress and per-core rates (1 s sliding window) on the coordinator
+    const int WINDOW = 10;   // samples of 100 ms
+    std::vector<std::vector<uint64_t>> hist(WINDOW, std::vector<uint64_t>(cores, 0));
+    std::vector<float> rates(cores, 0.f);
     auto start = std::chrono::steady_clock::now();
+    int tick = 0;
     while (true) {
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
         auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::steady_clock::now() - start).count();
+        tick++;
+        std::vector<uint64_t>& now  = hist[tick % WINDOW];
+        std::vector<uint64_t>& then = hist[(tick + 1) % WINDOW];   // oldest slot
+        int span = tick < WINDOW - 1 ? tick : WINDOW - 1;
+        for (int i = 0; i < cores; i++) {
+            now[i]   = counters[i].units.load(std::memory_order_relaxed);
+            rates[i] = span > 0 ? (float)(now[i] - (tick < WINDOW - 1 ? 0 : then[i])) / (span * 0.1f) : 0.f;
+        }
+        float sp = 100.f, measured = 0.f, duty = 1.f;
+        if (partial) {
+            sp = LoadSetpoint(profile, elapsed / 1000.f, (float)durationSec);
+            float m = s_measuredCpu.load();
+            measured = m < 0.f ? sp : std::min(100.f, m * online / cores);
+            float err = (sp - measured) / 100.f;
+            integral = std::max(-0.5f, std::min(0.5f, integral + err * KI * 0.1f));
+            duty = std::max(0.f, std::min(1.f, sp / 100.f + KP * err + integral));
+            s_duty = duty;
+        }
+        ThermalReading th = ReadThermal(cpus);
+        float totalRate = 0.f;
+        for (float r : rates) totalRate += r;
+        {
+            std::lock_guard<std::mutex> lock(s_rateMutex);
+            TrackThermal(thermalTracker, s_thermal, tick, elapsed / 1000.f, th, totalRate, !partial);
+            s_coreRates = rates;
+            s_loadStatus.setpointPct = sp;
+            s_loadStatus.measuredPct = measured;
+            s_loadStatus.duty        = duty;
+        }
         stressProgress = (float)elapsed / (float)durationMs;
         if (stressProgress >= 1.f || s_stop.load()) break;
     }
@@ -56,17 +487,33 @@ static void StressCoordinator(int durationSec) {
     s_stop.store(true);
     for (auto& t : workers) t.join();
 
+    float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    std::vector<float> finalRates;
+    std::vector<int>   scoredCpus;
+    for (int i = 0; i < cores; i++) {
+        if (counters[i].unpinned) continue;
+        finalRates.push_back((float)(counters[i].units.load() / (double)seconds));
+        scoredCpus.push_back(cpus[i]);
+    }
+    {
+        std::lock_guard<std::mutex> lock(s_rateMutex);
+        s_score = ComputeScore(workload, finalRates, scoredCpus, seconds);
+        s_loadStatus.active = false;
+    }
+    s_pwm = false;
+
     stressProgress = 1.f;
     stressState    = StressTestState::DONE;
 }
 
 void StartStressTest(int durationSec) {
     if (stressState == StressTestState::RUNNING) return;
+    if (coreLatencyState == StressTestState::RUNNING) return;   // both pin every CPU
     stressDurationSec = durationSec;
     stressProgress    = 0.f;
     stressState       = StressTestState::RUNNING;
     s_stop.store(false);
-    std::thread(StressCoordinator, durationSec).detach();
+    std::thread(StressCoordinator, durationSec, stressWorkload, stressLoad).detach();
 }
 
 void StopStressTest() {
@@ -74,3 +521,256 @@ void StopStressTest() {
     s_stop.store(true);
     stressState = StressTestState::DONE;
 }
+
+std::vector<float> GetStressCoreRates() {
+    std::lock_guard<std::mutex> lock(s_rateMutex);
+    return s_coreRates;
+}
+
+StressScore GetStressScore() {
+    std::lock_guard<std::mutex> lock(s_rateMutex);
+    return s_score;
+}
+
+StressThermalStatus GetStressThermal() {
+    std::lock_guard<std::mutex> lock(s_rateMutex);
+    return s_thermal;
+}
+
+// Called by the cpu collector's worker at its cadence (1 s, or the adaptive fast
+// rate while a stress hold is active). Smoothed over a fixed time constant so
+// the loop sees the same lag whatever the reading interval; short fast-rate
+// deltas are only a few jiffies wide and need it most.
+void StressFeedbackCpu(float systemCpuPct) {
+    const double TAU_SEC = 1.0;
+    static std::chrono::steady_clock::time_point last;
+    auto now = std::chrono::steady_clock::now();
+    float prev = s_measuredCpu.load(std::memory_order_relaxed);
+    double dt = std::chrono::duration<double>(now - last).count();
+    last = now;
+    float alpha = (float)(1.0 - std::exp(-std::min(dt, 10.0) / TAU_SEC));
+    s_measuredCpu.store(prev < 0.f ? systemCpuPct : prev + (systemCpuPct - prev) * alpha,
+                        std::memory_order_relaxed);
+}
+
+StressLoadStatus GetStressLoadStatus() {
+    std::lock_guard<std::mutex> lock(s_rateMutex);
+    return s_loadStatus;
+}
+
+// ── Core-to-core latency ──────────────────────────────────────────────────────
+// Two threads pinned to CPUs a and b bounce one cache line: a writes an odd
+// value and waits for b to answer with the next even one. Half the round trip
+// is the one-way transfer cost, which is what separates SMT siblings, cores
+// sharing an L3 (CCX), chiplets and sockets.
+//
+// Pairs are scheduled as a round-robin tournament (circle method), so every
+// round is a set of CPU-disjoint pairs that can run at once. A round is split
+// further so no two concurrent pairs share a physical core: an SMT sibling
+// spinning next to a measurement would steal its pipeline. That keeps the
+// whole matrix to ~2(n-1) short batches - seconds, even on 256 CPUs.
+StressTestState coreLatencyState = StressTestState::IDLE;
+
+static const int C2C_WARMUP  = 200;
+static const int C2C_BATCH   = 200;   // round trips per timed batch
+static const int C2C_BATCHES = 5;     // best batch wins: filters out preemption
+
+struct alignas(128) PingLine {        // 128: keep the adjacent-line prefetcher out
+    std::atomic<uint64_t> value{0};
+};
+
+struct C2CAssignment {
+    int partner = -1;                 // thread index, -1 = sits this batch out
+    bool ping   = false;
+    int  line   = 0;
+};
+
+static std::atomic<bool> s_c2cStop{false};
+static CoreLatencyMatrix s_c2c;       // guarded by s_rateMutex
+
+// Physical core of each CPU, keyed by the lowest id in its SMT sibling list
+static std::vector<int> PhysicalCoreOf(const std::vector<int>& cpus) {
+    std::vector<int> core(cpus.size());
+    for (size_t i = 0; i < cpus.size(); i++) {
+        std::string line;
+        std::vector<int> sib;
+        if (ReadSysfsLine(SysfsPath("/sys/devices/system/cpu/cpu" + std::to_string(cpus[i]) +
+                                    "/topology/thread_siblings_list"), line))
+            sib = ParseCpuList(line);
+        core[i] = sib.empty() ? cpus[i] : sib.front();
+    }
+    return core;
+}
+
+// Circle-method rounds, each split into batches with no shared physical core
+static std::vector<std::vector<std::pair<int, int>>> ScheduleCorePairs(const std::vector<int>& core) {
+    int n = (int)core.size();
+    int m = n + (n & 1);
+    std::vector<int> ids(m);
+    std::iota(ids.begin(), ids.end(), 0);
+    if (m != n) ids[m - 1] = -1;      // bye
+    std::vector<std::vector<std::pair<int, int>>> batches;
+    for (int r = 0; r < m - 1; r++) {
+        std::vector<std::pair<int, int>> pending;
+        for (int i = 0; i < m / 2; i++) {
+            int a = ids[i], b = ids[m - 1 - i];
+            if (a >= 0 && b >= 0) pending.push_back({std::min(a, b), std::max(a, b)});
+        }
+        while (!pending.empty()) {
+            std::vector<int> busy;
+            std::vector<std::pair<int, int>> batch, rest;
+            for (const auto& pr : pending) {
+                int ca = core[pr.first], cb = core[pr.second];
+                bool clash = std::find(busy.begin(), busy.end(), ca) != busy.end() ||
+                             std::find(busy.begin(), busy.end(), cb) != busy.end();
+                if (clash) { rest.push_back(pr); continue; }
+                busy.push_back(ca); busy.push_back(cb);
+                batch.push_back(pr);
+            }
+            batches.push_back(batch);
+            pending.swap(rest);
+        }
+        std::rotate(ids.begin() + 1, ids.end() - 1, ids.end());
+    }
+    return batches;
+}
+
+// Returns the best-batch one-way latency (ping side) or -1 when stopped
+static float PingPong(PingLine& line, bool ping) {
+    const int total = C2C_WARMUP + C2C_BATCH * C2C_BATCHES;
+    double best = 1e30;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < total; i++) {
+        uint64_t want = ping ? 2ULL * i : 2ULL * i + 1;
+        while (line.value.load(std::memory_order_acquire) != want)
+            if (s_c2cStop.load(std::memory_order_relaxed)) return -1.f;
+        line.value.store(want + 1, std::memory_order_release);
+        if (ping && i >= C2C_WARMUP && (i - C2C_WARMUP) % C2C_BATCH == 0) {
+            auto now = std::chrono::steady_clock::now();
+            if (i > C2C_WARMUP) best = std::min(best, std::chrono::duration<double>(now - t0).count());
+            t0 = now;
+        }
+    }
+    if (ping) {
+        // The last batch ends when the final answer arrives
+        while (line.value.load(std::memory_order_acquire) != 2ULL * total)
+            if (s_c2cStop.load(std::memory_order_relaxed)) return -1.f;
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+    }
+    return (float)(best * 1e9 / (2.0 * C2C_BATCH));
+}
+
+static void CoreLatencyCoordinator() {
+    auto start = std::chrono::steady_clock::now();
+    std::vector<int> cpus = GetUsableCpus();
+    int n = (int)cpus.size();
+    auto batches = ScheduleCorePairs(PhysicalCoreOf(cpus));
+    {
+        std::lock_guard<std::mutex> lock(s_rateMutex);
+        s_c2c = CoreLatencyMatrix{};
+        s_c2c.cpus = cpus;
+        s_c2c.ns.assign((size_t)n * n, -1.f);
+        for (int i = 0; i < n; i++) s_c2c.ns[(size_t)i * n + i] = 0.f;
+        s_c2c.pairsTotal = n * (n - 1) / 2;
+    }
+
+    // One pinned thread per CPU for the whole run; idle ones block on the
+    // condition variable so they don't compete with the pairs being timed
+    std::mutex m;
+    std::condition_variable go, done;
+    uint64_t gen = 0;
+    int remaining = 0;
+    bool quit = false;
+    std::vector<C2CAssignment> assign(n);
+    std::vector<char> pinned(n, 0);   // under m; a pair with an unpinned side is not recorded
+    int ready = 0;
+    std::unique_ptr<PingLine[]> lines(new PingLine[n / 2 + 1]);
+
+    auto worker = [&](int idx) {
+        // A worker that could not be pinned still plays its part, so its
+        // partner is not left waiting, but its pairs stay unmeasured
+        bool ok = PinThreadToCpu(cpus[idx]);
+        if (!ok) LogPinFailure("C2C", cpus[idx]);
+        {
+            std::lock_guard<std::mutex> lock(m);
+            pinned[idx] = ok;
+            if (++ready == n) done.notify_one();
+        }
+        uint64_t seen = 0;
+        while (true) {
+            C2CAssignment a;
+            bool measured;
+            {
+                std::unique_lock<std::mutex> lock(m);
+                go.wait(lock, [&] { return quit || gen != seen; });
+                if (quit) return;
+                seen = gen; a = assign[idx];
+                measured = a.partner >= 0 && pinned[idx] && pinned[a.partner];
+            }
+            if (a.partner < 0) continue;
+            float ns = PingPong(lines[a.line], a.ping);
+            if (a.ping && ns >= 0.f) {
+                std::lock_guard<std::mutex> lock(s_rateMutex);
+                if (measured) {
+                    s_c2c.ns[(size_t)idx * n + a.partner] = ns;
+                    s_c2c.ns[(size_t)a.partner * n + idx] = ns;
+                }
+                s_c2c.pairsDone++;
+            }
+            std::lock_guard<std::mutex> lock(m);
+            if (--remaining == 0) done.notify_one();
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(n);
+    for (int i = 0; i < n; i++) threads.emplace_back(worker, i);
+    {
+        std::unique_lock<std::mutex> lock(m);
+        done.wait(lock, [&] { return ready == n; });
+    }
+
+    for (const auto& batch : batches) {
+        if (s_c2cStop.load()) break;
+        std::unique_lock<std::mutex> lock(m);
+        for (auto& a : assign) a = C2CAssignment{};
+        for (int k = 0; k < (int)batch.size(); k++) {
+            int a = batch[k].first, b = batch[k].second;
+            lines[k].value.store(0, std::memory_order_relaxed);
+            assign[a] = { b, true,  k };
+            assign[b] = { a, false, k };
+        }
+        remaining = (int)batch.size() * 2;
+        gen++;
+        go.notify_all();
+        done.wait(lock, [&] { return remaining == 0; });
+    }
+    {
+        std::lock_guard<std::mutex> lock(m);
+        quit = true;
+    }
+    go.notify_all();
+    for (auto& t : threads) t.join();
+
+    {
+        std::lock_guard<std::mutex> lock(s_rateMutex);
+        s_c2c.seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    }
+    coreLatencyState = StressTestState::DONE;
+}
+
+void StartCoreLatencyTest() {
+    if (coreLatencyState == StressTestState::RUNNING || stressState == StressTestState::RUNNING) return;
+    s_c2cStop        = false;
+    coreLatencyState = StressTestState::RUNNING;
+    std::thread(CoreLatencyCoordinator).detach();
+}
+
+void StopCoreLatencyTest() {
+    if (coreLatencyState != StressTestState::RUNNING) return;
+    s_c2cStop = true;
+}
+
+CoreLatencyMatrix GetCoreLatencyMatrix() {
+    std::lock_guard<std::mutex> lock(s_rateMutex);
+    return s_c2c;
+}
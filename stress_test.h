@@ -1,10 +1,110 @@
 #pragma once
+#include <string>
+#include <vector>
 
 enum class StressTestState { IDLE, RUNNING, DONE };
 
+// Workload kernels - each loads a different part of the core/uncore
+enum class StressWorkload {
+    INTEGER = 0,     // scalar ALU: multiply/xor/shift chains
+    FP64,            // scalar double-precision multiply-add chains
+    SIMD_FMA,        // AVX-512 / AVX2 FMA, picked at runtime (falls back to FP64)
+    MEMORY_STREAM,   // STREAM-style triad over a per-thread buffer
+    CACHE_LATENCY,   // dependent pointer chase through a random cycle
+    BRANCH,          // data-dependent unpredictable branches
+    COUNT
+};
+
+inline const char* STRESS_WORKLOAD_NAMES[] = {
+    "INTEGER", "FP64", "SIMD FMA", "MEM STREAM", "CACHE CHASE", "BRANCH"
+};
+
+// Partial-load mode: each worker PWMs its kernel and a closed loop on the
+// measured CPU usage adjusts the shared duty cycle
+enum class StressRamp { CONSTANT = 0, STEP, SAWTOOTH, COUNT };
+
+inline const char* STRESS_RAMP_NAMES[] = { "CONSTANT", "STEP", "SAWTOOTH" };
+
+struct StressLoadProfile {
+    int              targetPct     = 100;   // CONSTANT setpoint; 100 = peg, no PWM
+    StressRamp       ramp          = StressRamp::CONSTANT;
+    int              rampFromPct   = 20;
+    int              rampToPct     = 80;
+    int              rampSteps     = 4;     // STEP: levels spread over the run
+    int              rampPeriodSec = 10;    // SAWTOOTH: one rise
+    std::vector<int> cpus;                  // empty = every logical CPU
+};
+
+struct StressLoadStatus {
+    bool  active      = false;   // duty cycling in effect
+    float setpointPct = 100.f;   // current target (per chosen core)
+    float measuredPct = 0.f;     // smoothed monitor reading, same scale
+    float duty        = 1.f;     // 0..1 busy fraction
+};
+
+// Frequency / temperature track of a run, correlated with completed work
+struct StressThermalSample {
+    float t;            // seconds into the run
+    float freqMHz;      // mean over the stressed CPUs
+    float tempC;        // package, -1 if no sensor
+    float opsPerSec;    // all workers, 1 s window
+};
+
+struct StressThermalStatus {
+    bool        sensors           = false;   // any frequency/temperature source found
+    float       freqMHz           = 0.f;
+    float       baselineFreqMHz   = 0.f;     // mean over seconds 1-3 of the run
+    float       tempC             = -1.f;
+    float       peakTempC         = -1.f;
+    float       opsPerSec         = 0.f;
+    float       baselineOpsPerSec = 0.f;
+    float       throughputDropPct = 0.f;     // vs baseline, positive = slower
+    float       freqDropPct       = 0.f;
+    bool        throttled         = false;   // both fell together for 1 s (latched)
+    std::string note;                        // human-readable flag for the dashboard/log
+    std::vector<StressThermalSample> history;   // 10 Hz
+};
+
+// Final result of a run: work units per second per logical CPU
+struct StressScore {
+    bool               valid           = false;
+    StressWorkload     workload        = StressWorkload::FP64;
+    float              seconds         = 0.f;
+    double             totalOpsPerSec  = 0.0;   // the score
+    double             meanOpsPerSec   = 0.0;
+    double             stddevOpsPerSec = 0.0;
+    float              cvPct           = 0.f;   // stddev / mean
+    int                slowestCpu      = -1;    // logical CPU id
+    int                outliers        = 0;     // cores >10% below the median
+    std::vector<float> coreOpsPerSec;
+    std::vector<int>   coreCpu;                 // logical CPU of each entry
+};
+
+// Core-to-core latency: one-way cache-line transfer time for every CPU pair
+struct CoreLatencyMatrix {
+    std::vector<int>   cpus;              // logical CPU of each row/column
+    std::vector<float> ns;                // n*n, row-major; <0 = not measured yet
+    int                pairsDone  = 0;
+    int                pairsTotal = 0;
+    float              seconds    = 0.f;
+};
+
 extern StressTestState stressState;
 extern float           stressProgress;   // 0..1
 extern int             stressDurationSec; // configurable, default 30
+extern StressWorkload  stressWorkload;    // kernel used by the next run
+extern StressLoadProfile stressLoad;      // load shape used by the next run
 
 void StartStressTest(int durationSec = 30);
 void StopStressTest();
+const char* GetStressSimdPath();          // "AVX-512", "AVX2+FMA" or "SCALAR"
+std::vector<float> GetStressCoreRates();  // live units/s per logical CPU (1 s window)
+StressScore        GetStressScore();      // valid once a run has finished
+StressThermalStatus GetStressThermal();   // live during a run, kept afterwards
+void               StressFeedbackCpu(float systemCpuPct);  // host-wide monitor reading for the load loop
+StressLoadStatus   GetStressLoadStatus();
+
+extern StressTestState coreLatencyState;
+void               StartCoreLatencyTest();   // no-op while a stress run is active
+void               StopCoreLatencyTest();
+CoreLatencyMatrix  GetCoreLatencyMatrix();
@@ -0,0 +1,217 @@
+// sysfs_util.cpp - small helpers shared by the sysfs/procfs readers
+#include "sysfs_util.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#if defined(_WIN32)
+  #define WIN32_LEAN_AND_MEAN
+  #include <windows.h>
+#elif defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
+static std::mutex  s_rootMutex;
+static std::string s_root;
+
+void SetSysfsRoot(const std::string& root) {
+    std::lock_guard<std::mutex> lock(s_rootMutex);
+    s_root = root;
+    while (!s_root.empty() && s_root.back() == '/') s_root.pop_back();
+}
+
+std::string GetSysfsRoot() {
+    std::lock_guard<std::mutex> lock(s_rootMutex);
+    return s_root;
+}
+
+std::string SysfsPath(const std::string& path) {
+    std::lock_guard<std::mutex> lock(s_rootMutex);
+    return s_root + path;
+}
+
+std::vector<int> ParseCpuList(const std::string& list) {
+    std::vector<int> cpus;
+    size_t i = 0;
+    while (i < list.size()) {
+        size_t end = list.find(',', i);
+        if (end == std::string::npos) end = list.size();
+        std::string part = list.substr(i, end - i);
+        i = end + 1;
+        if (part.empty()) continue;
+        char* rest = nullptr;
+        long lo = strtol(part.c_str(), &rest, 10);
+        if (rest == part.c_str() || lo < 0) continue;
+        long hi = lo;
+        if (*rest == '-') hi = strtol(rest + 1, nullptr, 10);
+        for (long c = lo; c <= hi && c < 8192; c++) cpus.push_back((int)c);
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+std::string FormatCpuList(const std::vector<int>& cpus) {
+    std::string out;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) j++;
+        char buf[32];
+        if (j == i) snprintf(buf, sizeof(buf), "%d", cpus[i]);
+        else        snprintf(buf, sizeof(buf), "%d-%d", cpus[i], cpus[j]);
+        if (!out.empty()) out += ",";
+        out += buf;
+        i = j + 1;
+    }
+    return out;
+}
+
+static std::vector<int> AllHardwareThreads() {
+    std::vector<int> cpus(std::max(1u, std::thread::hardware_concurrency()));
+    for (size_t i = 0; i < cpus.size(); i++) cpus[i] = (int)i;
+    return cpus;
+}
+
+std::vector<int> GetOnlineCpus() {
+    std::string line;
+    std::vector<int> cpus;
+    if (ReadSysfsLine(SysfsPath("/sys/devices/system/cpu/online"), line)) cpus = ParseCpuList(line);
+    return cpus.empty() ? AllHardwareThreads() : cpus;
+}
+
+std::vector<int> GetUsableCpus() {
+    std::vector<int> online = GetOnlineCpus(), cpus;
+#if defined(__linux__)
+    const int MAX_CPUS = 8192;   // ParseCpuList's bound
+    cpu_set_t* set = CPU_ALLOC(MAX_CPUS);
+    size_t size = CPU_ALLOC_SIZE(MAX_CPUS);
+    if (set) CPU_ZERO_S(size, set);
+    if (set && sched_getaffinity(0, size, set) == 0) {
+        for (int c : online) if (CPU_ISSET_S(c, size, set)) cpus.push_back(c);
+    } else {
+        cpus = online;
+    }
+    if (set) CPU_FREE(set);
+#elif defined(_WIN32)
+    DWORD_PTR mask = 0, system = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &mask, &system)) {
+        for (int c : online) if (c < 64 && (mask >> c) & 1) cpus.push_back(c);
+    } else {
+        cpus = online;
+    }
+#else
+    cpus = online;
+#endif
+    return cpus.empty() ? online : cpus;
+}
+
+bool PinThreadToCpu(int cpu) {
+#if defined(__linux__)
+    if (cpu < 0 || cpu >= 8192) return false;
+    cpu_set_t* set = CPU_ALLOC(cpu + 1);
+    if (!set) return false;
+    size_t size = CPU_ALLOC_SIZE(cpu + 1);
+    CPU_ZERO_S(size, set);
+    CPU_SET_S(cpu, size, set);
+    bool ok = pthread_setaffinity_np(pthread_self(), size, set) == 0;
+    CPU_FREE(set);
+    return ok;
+#elif defined(_WIN32)
+    return cpu >= 0 && cpu < 64 && SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) != 0;
+#else
+    (void)cpu;   // macOS has no hard affinity; threads float
+    return true;
+#endif
+}
+
+bool ReadSysfsLine(const std::string& path, std::string& out) {
+    FILE* f = fopen(path.c_str(), "r");
+    if (!f) return false;
+    char buf[4096];
+    bool ok = fgets(buf, sizeof(buf), f) != nullptr;
+    fclose(f);
+    if (!ok) return false;
+    out = buf;
+    while (!out.empty() && (out.back() == '\n' || out.back() == '\r')) out.pop_back();
+    return true;
+}
+
+std::vector<NumaNodeCpus> GetNumaNodeCpus() {
+    std::vector<NumaNodeCpus> nodes;
+    std::string line;
+    std::vector<int> ids;
+    if (ReadSysfsLine(SysfsPath("/sys/devices/system/node/online"), line)) {
+        ids = ParseCpuList(line);   // same range-list format
+    } else {
+        // Older or hand-made trees without the online file: dense from node0
+        for (int n = 0; n < 1024 && ReadSysfsLine(SysfsPath("/sys/devices/system/node/node" +
+                                                          std::to_string(n) + "/cpulist"), line); n++)
+            ids.push_back(n);
+    }
+    for (int id : ids) {
+        NumaNodeCpus node;
+        node.id = id;
+        // A memory-only node's cpulist is empty, which reads as a failure
+        if (ReadSysfsLine(SysfsPath("/sys/devices/system/node/node" + std::to_string(id) + "/cpulist"), line))
+            node.cpus = ParseCpuList(line);
+        nodes.push_back(std::move(node));
+    }
+    return nodes;
+}
+
+bool ReadProcFile(const char* path, std::string& out) {
+    out.clear();
+    FILE* f = fopen(path, "r");
+    if (!f) return false;
+    char buf[4096];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+    fclose(f);
+    return true;
+}
+
+// user nice system idle iowait irq softirq steal, from p on
+static void SumCpuLine(char* p, uint64_t& busy, uint64_t& total) {
+    uint64_t v[8] = {};
+    for (int i = 0; i < 8; i++) v[i] = strtoull(p, &p, 10);
+    uint64_t idle = v[3] + v[4];
+    total = v[0] + v[1] + v[2] + v[3] + v[4] + v[5] + v[6] + v[7];
+    busy  = total - idle;
+}
+
+bool ParseProcStatTotal(const char* text, uint64_t& busy, uint64_t& total) {
+    if (!text || strncmp(text, "cpu ", 4) != 0) return false;   // it is the first line
+    SumCpuLine((char*)text + 4, busy, total);
+    return total > 0;
+}
+
+void ParseProcStatCores(const char* text, std::vector<uint64_t>& busy, std::vector<uint64_t>& total) {
+    busy.clear(); total.clear();
+    for (const char* line = text; line && *line; line = strchr(line, '\n'), line = line ? line + 1 : nullptr) {
+        if (strncmp(line, "cpu", 3) != 0) {
+            // The cpu lines come first; the rest of the file is not needed
+            if (!busy.empty()) break;
+            continue;
+        }
+        if (line[3] < '0' || line[3] > '9') continue;   // the aggregate "cpu " line
+        char* p = nullptr;
+        long cpu = strtol(line + 3, &p, 10);
+        uint64_t b, t;
+        SumCpuLine(p, b, t);
+        if (cpu >= 0 && cpu < 65536) {
+            if ((size_t)cpu >= busy.size()) { busy.resize(cpu + 1, 0); total.resize(cpu + 1, 0); }
+            busy[cpu]  = b;
+            total[cpu] = t;
+        }
+    }
+}
+
+void ReadProcStatCores(std::vector<uint64_t>& busy, std::vector<uint64_t>& total) {
+    std::string text;
+    if (!ReadProcFile("/proc/stat", text)) { busy.clear(); total.clear(); return; }
+    ParseProcStatCores(text.c_str(), busy, total);
+}
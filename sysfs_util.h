@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ── Linux cpulist helpers ─────────────────────────────────────────────────────
+// The kernel's cpulist format ("0-3,8,10-11") is used by sysfs node/cpu files
+// and is also how CPU sets are written in dashboard.cfg.
+std::vector<int> ParseCpuList(const std::string& list);
+std::string      FormatCpuList(const std::vector<int>& cpus);
+
+// ── CPU affinity ──────────────────────────────────────────────────────────────
+// Online CPUs from /sys/devices/system/cpu/online, and the usable ones: those
+// also in this process's sched_getaffinity mask, so cpusets, container limits,
+// offline CPUs and sparse ids are all honoured. Off Linux both fall back to
+// the process affinity mask (Windows) or 0..hardware_concurrency-1.
+std::vector<int> GetOnlineCpus();
+std::vector<int> GetUsableCpus();
+// Pins the calling thread to one CPU; false when the OS refused. macOS has
+// no hard affinity, so there it always succeeds and the thread floats.
+bool PinThreadToCpu(int cpu);
+
+// ── sysfs root ────────────────────────────────────────────────────────────────
+// Every /sys path goes through SysfsPath(), so pointing sysfs_root in
+// dashboard.cfg at a copied or hand-made tree lets the readers run against
+// fake hardware. Empty = the real /sys.
+void        SetSysfsRoot(const std::string& root);
+std::string GetSysfsRoot();
+std::string SysfsPath(const std::string& path);   // "/sys/class/..." -> "<root>/sys/class/..."
+
+// Reads the first line of a small sysfs/procfs file, trailing newline removed
+bool ReadSysfsLine(const std::string& path, std::string& out);
+// Reads a whole small procfs file (their size is not known up front)
+bool ReadProcFile(const char* path, std::string& out);
+
+// Online NUMA nodes from /sys/devices/system/node/online, in id order, with
+// each node's CPUs. Ids can have gaps (offlined, memory-only or CXL nodes),
+// and memory-only nodes have no CPUs. Empty when the platform exposes no
+// node directory (single node or non-Linux).
+struct NumaNodeCpus {
+    int              id = 0;
+    std::vector<int> cpus;
+};
+std::vector<NumaNodeCpus> GetNumaNodeCpus();
+
+// Per-CPU busy and total jiffies from the "cpuN ..." lines of /proc/stat,
+// indexed by CPU number (offline CPUs stay 0). Empty off Linux. The Parse
+// form takes text already read, so one read can serve several readers.
+void ParseProcStatCores(const char* text, std::vector<uint64_t>& busy, std::vector<uint64_t>& total);
+// The same two sums from the aggregate "cpu " line; false when there is none
+bool ParseProcStatTotal(const char* text, uint64_t& busy, uint64_t& total);
+void ReadProcStatCores(std::vector<uint64_t>& busy, std::vector<uint64_t>& total);
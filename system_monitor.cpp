@@ -6,6 +6,7 @@
 #include <psapi.h>
 #include <iphlpapi.h>
 #include <cstdio>
+#include <atomic>
 
 #pragma comment(lib, "pdh.lib")
 #pragma comment(lib, "iphlpapi.lib")
@@ -21,8 +22,9 @@ static bool pdhInitialized = false;
 static ULONGLONG netPrevBytesIn  = 0;
 static ULONGLONG netPrevBytesOut = 0;
 static ULONGLONG netPrevTime     = 0;
-static float     netDownKBps     = 0.f;
-static float     netUpKBps       = 0.f;
+// Rates are atomic: the speed test scheduler thread reads them
+static std::atomic<float> netDownKBps{0.f};
+static std::atomic<float> netUpKBps{0.f};
 
 // Sums bytes across all non-loopback adapters using the classic GetIfTable API
 static void SampleNetworkBytes(ULONGLONG& bytesIn, ULONGLONG& bytesOut) {
@@ -53,11 +55,11 @@ void UpdateNetworkStats() {
 
     if (netPrevTime > 0 && now > netPrevTime) {
         double elapsedSec = (now - netPrevTime) / 1000.0;
-        netDownKBps = static_cast<float>((bytesIn  - netPrevBytesIn)  / elapsedSec / 1024.0);
-        netUpKBps   = static_cast<float>((bytesOut - netPrevBytesOut) / elapsedSec / 1024.0);
+        float down = static_cast<float>((bytesIn  - netPrevBytesIn)  / elapsedSec / 1024.0);
+        float up   = static_cast<float>((bytesOut - netPrevBytesOut) / elapsedSec / 1024.0);
         // Clamp negatives (counter wrap or adapter reset)
-        if (netDownKBps < 0.f) netDownKBps = 0.f;
-        if (netUpKBps   < 0.f) netUpKBps   = 0.f;
+        netDownKBps = down < 0.f ? 0.f : down;
+        netUpKBps   = up   < 0.f ? 0.f : up;
     }
 
     netPrevBytesIn  = bytesIn;
@@ -95,7 +97,7 @@ void CleanupSystemMonitoring() {
     netDownKBps = netUpKBps = 0.f;
 }
 
-float GetRealCPUUsage() {
+float GetRealCPUUsage(const std::string&) {
     if (!pdhInitialized) return 0.0f;
     
     PDH_FMT_COUNTERVALUE counterVal;
@@ -290,6 +292,10 @@ HardwareInfo GetHardwareInfo() {
     return info;
 }
 
+// Per-CPU load needs NtQuerySystemInformation or a PDH counter per core;
+// not wired up yet, so the per-core panel stays hidden on Windows
+std::vector<float> GetPerCoreCPUUsage(const std::string&) { return {}; }
+
 std::vector<DiskInfo> GetAllDrives() {
     std::vector<DiskInfo> result;
     DWORD drives = GetLogicalDrives();
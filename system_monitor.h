@@ -35,7 +35,9 @@ struct AdapterInfo {
 void InitializeSystemMonitoring();
 void CleanupSystemMonitoring();
 void UpdateNetworkStats();
-float GetRealCPUUsage();
+// The CPU readers take /proc/stat's text when the caller has already read
+// it (the collector scheduler reads it once for both); empty = read it here
+float GetRealCPUUsage(const std::string& procStat = std::string());
 float GetRealRAMUsage();
 float GetRealDiskUsage();
 unsigned long long GetTotalRAM_MB();
@@ -47,6 +49,8 @@ unsigned long long GetSystemUptimeSeconds();
 void GetHostName(char* buffer, int bufferSize);
 float GetNetDownKBps();
 float GetNetUpKBps();
+// Busy % of each logical CPU since the previous call; empty where unsupported
+std::vector<float>       GetPerCoreCPUUsage(const std::string& procStat = std::string());
 std::vector<AdapterInfo> GetAdapterList();
 std::vector<DiskInfo>    GetAllDrives();
 HardwareInfo             GetHardwareInfo();
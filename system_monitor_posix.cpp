@@ -4,6 +4,11 @@
 #if !defined(_WIN32)
 
 #include "system_monitor.h"
+#include "thermal.h"
+#include "cgroup.h"
+#include "meminfo.h"
+#include "sysfs_util.h"
+#include <algorithm>
 #include <cstdio>
 #include <cstring>
 #include <string>
@@ -11,6 +16,7 @@
 #include <fstream>
 #include <sstream>
 #include <chrono>
+#include <atomic>
 #include <unistd.h>
 #include <sys/statvfs.h>
 #include <ifaddrs.h>
@@ -30,8 +36,9 @@
 #endif
 
 // ── Shared state ──────────────────────────────────────────────────────────────
-static float              netDownKBps    = 0.f;
-static float              netUpKBps      = 0.f;
+// Rates are atomic: the speed test scheduler thread reads them
+static std::atomic<float> netDownKBps{0.f};
+static std::atomic<float> netUpKBps{0.f};
 static unsigned long long netPrevBytesIn = 0;
 static unsigned long long netPrevBytesOut= 0;
 static unsigned long long netPrevTimeMs  = 0;
@@ -107,10 +114,10 @@ void UpdateNetworkStats() {
     SampleNetworkBytes(bIn, bOut);
     if (netPrevTimeMs > 0 && now > netPrevTimeMs) {
         double elapsed = (now - netPrevTimeMs) / 1000.0;
-        netDownKBps = (float)((bIn  - netPrevBytesIn)  / elapsed / 1024.0);
-        netUpKBps   = (float)((bOut - netPrevBytesOut) / elapsed / 1024.0);
-        if (netDownKBps < 0.f) netDownKBps = 0.f;
-        if (netUpKBps   < 0.f) netUpKBps   = 0.f;
+        float down = (float)((bIn  - netPrevBytesIn)  / elapsed / 1024.0);
+        float up   = (float)((bOut - netPrevBytesOut) / elapsed / 1024.0);
+        netDownKBps = down < 0.f ? 0.f : down;
+        netUpKBps   = up   < 0.f ? 0.f : up;
     }
     netPrevBytesIn = bIn; netPrevBytesOut = bOut; netPrevTimeMs = now;
 }
@@ -134,10 +141,10 @@ void InitializeSystemMonitoring() {
 
 void CleanupSystemMonitoring() { netPrevTimeMs = 0; netDownKBps = netUpKBps = 0.f; }
 
-float GetRealCPUUsage() {
-    std::ifstream f("/proc/stat");
-    std::string line; std::getline(f, line);
-    std::istringstream ss(line.substr(5));
+float GetRealCPUUsage(const std::string& procStat) {
+    std::string text = procStat;
+    if (text.empty() && !ReadProcFile("/proc/stat", text)) return 0.f;
+    std::istringstream ss(text.compare(0, 4, "cpu ") == 0 ? text.substr(5, text.find('\n') - 5) : std::string());
     unsigned long long u, n, s, id, iow, irq, sirq;
     ss >> u >> n >> s >> id >> iow >> irq >> sirq;
     unsigned long long idle  = id + iow;
@@ -145,28 +152,40 @@ float GetRealCPUUsage() {
     unsigned long long dIdle  = idle  - cpuPrevIdle;
     unsigned long long dTotal = total - cpuPrevTotal;
     cpuPrevIdle = idle; cpuPrevTotal = total;
+    // Under a cpu.max quota (containers, pods) report usage of the quota instead
+    float cgPct;
+    if (CgroupCpuUsage(cgPct)) return cgPct;
     return dTotal > 0 ? (float)(dTotal - dIdle) * 100.f / (float)dTotal : 0.f;
 }
 
+// memory.max of our cgroup, when it is tighter than physical RAM
+static bool CgroupMemory(unsigned long long& usedBytes, unsigned long long& limitBytes) {
+    uint64_t used, limit;
+    if (!CgroupMemUsage(used, limit)) return false;
+    if (limit >= ReadMemInfo().kb[MI_MEM_TOTAL] * 1024ULL) return false;
+    usedBytes = used; limitBytes = limit;
+    return true;
+}
+
+// Host RAM: all three functions use the same meminfo sample and the same
+// definition of used (MemTotal - MemAvailable)
 float GetRealRAMUsage() {
-    std::ifstream f("/proc/meminfo");
-    unsigned long long total = 0, avail = 0;
-    std::string line;
-    while (std::getline(f, line)) {
-        if (line.rfind("MemTotal:", 0) == 0)     sscanf(line.c_str(), "MemTotal: %llu", &total);
-        if (line.rfind("MemAvailable:", 0) == 0) sscanf(line.c_str(), "MemAvailable: %llu", &avail);
-    }
-    return total > 0 ? (float)(total - avail) * 100.f / (float)total : 0.f;
+    unsigned long long cgUsed, cgLimit;
+    if (CgroupMemory(cgUsed, cgLimit)) return (float)cgUsed * 100.f / (float)cgLimit;
+    MemInfo m = ReadMemInfo();
+    return m.valid ? (float)m.UsedKB() * 100.f / (float)m.kb[MI_MEM_TOTAL] : 0.f;
 }
 
 unsigned long long GetTotalRAM_MB() {
-    struct sysinfo si; sysinfo(&si);
-    return (unsigned long long)si.totalram * si.mem_unit / (1024*1024);
+    unsigned long long cgUsed, cgLimit;
+    if (CgroupMemory(cgUsed, cgLimit)) return cgLimit / (1024*1024);
+    return ReadMemInfo().kb[MI_MEM_TOTAL] / 1024;
 }
 
 unsigned long long GetUsedRAM_MB() {
-    struct sysinfo si; sysinfo(&si);
-    return (unsigned long long)(si.totalram - si.freeram - si.bufferram) * si.mem_unit / (1024*1024);
+    unsigned long long cgUsed, cgLimit;
+    if (CgroupMemory(cgUsed, cgLimit)) return cgUsed / (1024*1024);
+    return ReadMemInfo().UsedKB() / 1024;
 }
 
 int GetProcessCount() {
@@ -194,7 +213,7 @@ void InitializeSystemMonitoring() {
 }
 void CleanupSystemMonitoring() { netPrevTimeMs = 0; netDownKBps = netUpKBps = 0.f; }
 
-float GetRealCPUUsage() {
+float GetRealCPUUsage(const std::string&) {
     host_cpu_load_info_data_t info;
     mach_msg_type_number_t count = HOST_CPU_LOAD_INFO_COUNT;
     static unsigned long long prevUser=0, prevSys=0, prevIdle=0, prevNice=0;
@@ -272,6 +291,42 @@ unsigned long long GetUsedDisk_GB() {
 
 void GetHostName(char* buf, int sz) { gethostname(buf, sz); }
 
+// Busy share of each logical CPU since the previous call (0 on the first)
+std::vector<float> GetPerCoreCPUUsage(const std::string& procStat) {
+    static std::vector<uint64_t> prevBusy, prevTotal;
+    std::vector<uint64_t> busy, total;
+#if defined(__linux__)
+    if (procStat.empty()) ReadProcStatCores(busy, total);
+    else                  ParseProcStatCores(procStat.c_str(), busy, total);
+#elif defined(__APPLE__)
+    (void)procStat;
+    natural_t cpuCount = 0;
+    processor_info_array_t info;
+    mach_msg_type_number_t infoCount;
+    if (host_processor_info(mach_host_self(), PROCESSOR_CPU_LOAD_INFO, &cpuCount, &info, &infoCount) == KERN_SUCCESS) {
+        for (natural_t i = 0; i < cpuCount; i++) {
+            const integer_t* t = info + i * CPU_STATE_MAX;
+            uint64_t idle = (uint32_t)t[CPU_STATE_IDLE];
+            uint64_t sum  = idle + (uint32_t)t[CPU_STATE_USER] + (uint32_t)t[CPU_STATE_SYSTEM] + (uint32_t)t[CPU_STATE_NICE];
+            busy.push_back(sum - idle);
+            total.push_back(sum);
+        }
+        vm_deallocate(mach_task_self(), (vm_address_t)info, infoCount * sizeof(integer_t));
+    }
+#endif
+    std::vector<float> pct(busy.size(), 0.f);
+    if (prevTotal.size() == total.size()) {
+        for (size_t i = 0; i < total.size(); i++) {
+            uint64_t dt = total[i] - prevTotal[i];
+            if (total[i] > prevTotal[i] && busy[i] >= prevBusy[i])
+                pct[i] = std::min(100.f, (float)(busy[i] - prevBusy[i]) * 100.f / (float)dt);
+        }
+    }
+    prevBusy.swap(busy);
+    prevTotal.swap(total);
+    return pct;
+}
+
 std::vector<DiskInfo> GetAllDrives() {
     std::vector<DiskInfo> result;
 #if defined(__linux__)
@@ -371,6 +426,12 @@ HardwareInfo GetHardwareInfo() {
     if (info.osVersion.empty()) info.osVersion = ShellLine("uname -r");
     // GPU driver
     info.gpuDriverVersion = ShellLine("glxinfo 2>/dev/null | grep 'OpenGL version' | head -1 | awk '{print $NF}'");
+    // GPU temperature from hwmon (amdgpu / nouveau / radeon)
+    ThermalReading th = ReadThermal({});
+    if (th.gpuTempC >= 0.f) {
+        info.gpuTempCelsius = th.gpuTempC;
+        info.gpuTempValid   = true;
+    }
 
 #elif defined(__APPLE__)
     // CPU name via sysctl
@@ -1,6 +1,8 @@
 #include "terminal.h"
 #include "theme.h"
 #include "dashboard.h"
+#include "text_cache.h"
+#include "layout.h"
 #include "raylib.h"
 #include <cstdio>
 #include <cmath>
@@ -87,12 +89,12 @@ void DrawTerminal() {
 
     TerminalTab& t = tabs[activeTab];
 
-    DrawRectangle(0, 0, WINDOW_WIDTH, WINDOW_HEIGHT, ColorAlpha(COLOR_BLACK, 0.88f));
+    DrawRectangle(0, 0, layout.width, layout.height, ColorAlpha(COLOR_BLACK, 0.88f));
 
     const int TX      = 40;
     const int TY      = 40;
-    const int TW      = WINDOW_WIDTH - 80;
-    const int TH      = WINDOW_HEIGHT - 100;
+    const int TW      = layout.width - 80;
+    const int TH      = layout.height - 100;
     const int TAB_H   = 28;
     const int INPUT_H = 34;
     const int BODY_Y  = TY + TAB_H;
@@ -112,20 +114,20 @@ void DrawTerminal() {
         bool active = (i == activeTab);
         DrawRectangle(tx, TY, TAB_W, TAB_H - 1, active ? Color{28, 28, 28, 255} : Color{12, 12, 12, 255});
         if (active) DrawRectangle(tx, TY, TAB_W, 2, GREEN_PHOSPHOR);
-        DrawText(tabs[i].name.c_str(), tx + 8, TY + 7, 13, active ? GREEN_PHOSPHOR : DIM_GREEN);
+        DrawTextRun(tabs[i].name.c_str(), tx + 8, TY + 7, 13, active ? GREEN_PHOSPHOR : DIM_GREEN);
         // Close button [x]
         if (tabCount > 1) {
-            DrawText("x", tx + TAB_W - 16, TY + 7, 13, active ? AMBER_PHOSPHOR : DIM_GREEN);
+            DrawTextRun("x", tx + TAB_W - 16, TY + 7, 13, active ? AMBER_PHOSPHOR : DIM_GREEN);
         }
     }
 
     // Hint on right side of tab bar
-    DrawText("Ctrl+T: new  Ctrl+W: close  Ctrl+Tab: switch  ESC: hide",
+    DrawTextRun("Ctrl+T: new  Ctrl+W: close  Ctrl+Tab: switch  ESC: hide",
              TX + tabCount * (TAB_W + 2) + 10, TY + 8, 11, DIM_GREEN);
 
     // CWD on far right
-    int cwdW = MeasureText(t.cwd.c_str(), 12);
-    DrawText(t.cwd.c_str(), TX + TW - cwdW - 8, TY + 8, 12, DIM_GREEN);
+    int cwdW = MeasureTextRun(t.cwd.c_str(), 12);
+    DrawTextRun(t.cwd.c_str(), TX + TW - cwdW - 8, TY + 8, 12, DIM_GREEN);
 
     // ── Output area ───────────────────────────────────────────────────────────
     int lineH    = 16;
@@ -141,7 +143,7 @@ void DrawTerminal() {
             c = YELLOW_ALERT;
         else if (i < 2)
             c = DIM_GREEN;
-        DrawText(t.output[i].c_str(), TX + 8, outY, 14, c);
+        DrawTextRun(t.output[i].c_str(), TX + 8, outY, 14, c);
         outY += lineH;
     }
 
@@ -150,12 +152,12 @@ void DrawTerminal() {
     DrawRectangle(TX, inputY, TW, INPUT_H, {15, 15, 15, 255});
     DrawLine(TX, inputY, TX + TW, inputY, DIM_GREEN);
     std::string prompt = t.cwd + " $ " + t.input;
-    DrawText(prompt.c_str(), TX + 8, inputY + 8, 16, GREEN_PHOSPHOR);
+    DrawTextRun(prompt.c_str(), TX + 8, inputY + 8, 16, GREEN_PHOSPHOR);
 
     // Blinking cursor
     termCursorBlink += GetFrameTime() * 2.f;
     if (fmod(termCursorBlink, 1.f) < 0.5f) {
-        int cx = TX + 8 + MeasureText(prompt.c_str(), 16);
+        int cx = TX + 8 + MeasureTextRun(prompt.c_str(), 16);
         DrawRectangle(cx, inputY + 6, 10, 20, GREEN_PHOSPHOR);
     }
 }
@@ -0,0 +1,205 @@
+#include "text_cache.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+// ── Cache storage ─────────────────────────────────────────────────────────────
+// Open-addressed table of runs over two pools that are reserved once: glyph
+// quads and the run strings (kept to compare keys exactly). When either
+// fills up, or the table gets too full to probe quickly, everything is
+// dropped and the visible strings are laid out again on the next frame.
+struct GlyphQuad {
+    float dx, dy, dw, dh;   // destination, relative to the pen origin
+    float u0, v0, u1, v1;   // atlas texture coordinates
+};
+
+struct GlyphRun {
+    uint64_t hash = 0;      // 0 = empty slot
+    uint32_t textOff = 0, textLen = 0;
+    uint32_t first = 0, count = 0;
+    int      size  = 0;
+    int      width = 0;
+};
+
+static const int    RUN_SLOTS   = 4096;   // power of two
+static const int    RUN_MAX     = RUN_SLOTS * 3 / 4;
+static const size_t QUAD_POOL   = 1 << 16;
+static const size_t TEXT_POOL   = 1 << 18;
+
+static Font                   s_font;
+static bool                   s_ready = false;
+static int                    s_asciiGlyph[128];
+static GlyphRun               s_runs[RUN_SLOTS];
+static std::vector<GlyphQuad> s_quads;
+static std::vector<char>      s_text;
+static TextCacheStats         s_stats;
+
+static void Flush() {
+    for (GlyphRun& r : s_runs) r.hash = 0;
+    s_quads.clear();
+    s_text.clear();
+    s_stats.runs = 0;
+    s_stats.flushes++;
+}
+
+void InitTextCache(Font font, bool customFont) {
+    s_font = font;
+    for (int c = 0; c < 128; c++) s_asciiGlyph[c] = GetGlyphIndex(font, c);
+    s_quads.reserve(QUAD_POOL);
+    s_text.reserve(TEXT_POOL);
+    Flush();
+    s_stats.flushes = 0;
+    s_ready = font.texture.id > 0;
+
+    // Same trick raylib uses for its default font: a white patch in the
+    // atlas corner (left free by the packer) becomes the shapes texture, so
+    // rectangles and lines don't switch textures between text runs
+    if (s_ready && customFont) {
+        int bpp = font.texture.format == PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA ? 2 :
+                  font.texture.format == PIXELFORMAT_UNCOMPRESSED_R8G8B8A8   ? 4 : 0;
+        if (bpp > 0) {
+            unsigned char white[3 * 3 * 4];
+            memset(white, 255, sizeof(white));
+            float w = (float)font.texture.width, h = (float)font.texture.height;
+            UpdateTextureRec(font.texture, { w - 3, h - 3, 3, 3 }, white);
+            SetShapesTexture(font.texture, { w - 2, h - 2, 1, 1 });
+        }
+    }
+}
+
+// ── Layout ────────────────────────────────────────────────────────────────────
+static uint64_t HashText(const char* text, size_t len, int size) {
+    uint64_t h = 14695981039346656037ull;   // FNV-1a
+    for (size_t i = 0; i < len; i++) h = (h ^ (unsigned char)text[i]) * 1099511628211ull;
+    h = (h ^ (uint64_t)size) * 1099511628211ull;
+    return h | 1;
+}
+
+// DrawText's rules: at least 10 px, one pixel of spacing per 10 px of size
+static void EffectiveSize(int& size, int& spacing) {
+    if (size < 10) size = 10;
+    spacing = size / 10;
+}
+
+// Lays the string out as DrawTextEx would draw it
+static void Shape(GlyphRun& run, const char* text, size_t len, int size) {
+    int spacing;
+    EffectiveSize(size, spacing);
+    float scale = (float)size / (float)s_font.baseSize;
+    float pad   = (float)s_font.glyphPadding;
+    float tw    = (float)s_font.texture.width, th = (float)s_font.texture.height;
+
+    run.first = (uint32_t)s_quads.size();
+    float penX = 0.f, penY = 0.f, width = 0.f;
+    for (size_t i = 0; i < len; ) {
+        int bytes = 1;
+        int cp = (unsigned char)text[i] < 128 ? text[i] : GetCodepointNext(text + i, &bytes);
+        i += bytes > 0 ? bytes : 1;
+        if (cp == '\n') {
+            width = std::max(width, penX - spacing);
+            penX = 0.f;
+            penY += (float)(size + 2);
+            continue;
+        }
+        int g = cp >= 0 && cp < 128 ? s_asciiGlyph[cp] : GetGlyphIndex(s_font, cp);
+        const Rectangle& rec  = s_font.recs[g];
+        const GlyphInfo& info = s_font.glyphs[g];
+        if (cp != ' ' && cp != '\t') {
+            GlyphQuad q;
+            q.dx = penX + info.offsetX * scale - pad * scale;
+            q.dy = penY + info.offsetY * scale - pad * scale;
+            q.dw = (rec.width  + 2.f * pad) * scale;
+            q.dh = (rec.height + 2.f * pad) * scale;
+            q.u0 = (rec.x - pad) / tw;
+            q.v0 = (rec.y - pad) / th;
+            q.u1 = (rec.x + rec.width  + pad) / tw;
+            q.v1 = (rec.y + rec.height + pad) / th;
+            s_quads.push_back(q);
+        }
+        penX += (info.advanceX != 0 ? info.advanceX : rec.width) * scale + spacing;
+    }
+    if (penX > 0.f) width = std::max(width, penX - spacing);
+    run.count = (uint32_t)s_quads.size() - run.first;
+    run.width = (int)width;
+}
+
+static const GlyphRun* FindRun(const char* text, int size) {
+    if (!s_ready || !text) return nullptr;
+    size_t   len = strlen(text);
+    uint64_t h   = HashText(text, len, size);
+    for (int attempt = 0; attempt < 2; attempt++) {
+        int slot = (int)(h & (RUN_SLOTS - 1));
+        for (;;) {
+            GlyphRun& r = s_runs[slot];
+            if (r.hash == 0) break;
+            if (r.hash == h && r.size == size && r.textLen == len &&
+                memcmp(s_text.data() + r.textOff, text, len) == 0) {
+                s_stats.hits++;
+                return &r;
+            }
+            slot = (slot + 1) & (RUN_SLOTS - 1);
+        }
+        // Miss: lay it out if it fits, otherwise start over and retry once.
+        // Capacity was reserved, so none of this reallocates.
+        if (s_stats.runs < RUN_MAX && s_text.size() + len <= TEXT_POOL && s_quads.size() + len <= QUAD_POOL) {
+            GlyphRun& r = s_runs[slot];
+            r.hash    = h;
+            r.size    = size;
+            r.textOff = (uint32_t)s_text.size();
+            r.textLen = (uint32_t)len;
+            s_text.insert(s_text.end(), text, text + len);
+            Shape(r, text, len, size);
+            s_stats.runs++;
+            s_stats.misses++;
+            return &r;
+        }
+        if (len > TEXT_POOL || len > QUAD_POOL) return nullptr;
+        Flush();
+    }
+    return nullptr;
+}
+
+// ── Drawing ───────────────────────────────────────────────────────────────────
+// Straight into raylib's batch with the atlas bound; consecutive runs (and
+// shapes, via the shapes patch) share one draw call
+void DrawTextRun(const char* text, int x, int y, int size, Color color) {
+    const GlyphRun* run = FindRun(text, size);
+    if (!run) {
+        if (text) DrawText(text, x, y, size, color);
+        return;
+    }
+    const GlyphQuad* q = s_quads.data() + run->first;
+    float ox = (float)x, oy = (float)y;
+    for (uint32_t done = 0; done < run->count; ) {
+        uint32_t n = std::min<uint32_t>(run->count - done, 256);
+        rlCheckRenderBatchLimit(4 * (int)n);
+        rlSetTexture(s_font.texture.id);
+        rlBegin(RL_QUADS);
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlNormal3f(0.f, 0.f, 1.f);
+        for (uint32_t i = 0; i < n; i++, q++) {
+            float x0 = ox + q->dx, y0 = oy + q->dy;
+            float x1 = x0 + q->dw, y1 = y0 + q->dh;
+            rlTexCoord2f(q->u0, q->v0); rlVertex2f(x0, y0);
+            rlTexCoord2f(q->u0, q->v1); rlVertex2f(x0, y1);
+            rlTexCoord2f(q->u1, q->v1); rlVertex2f(x1, y1);
+            rlTexCoord2f(q->u1, q->v0); rlVertex2f(x1, y0);
+        }
+        rlEnd();
+        rlSetTexture(0);
+        done += n;
+    }
+}
+
+int MeasureTextRun(const char* text, int size) {
+    const GlyphRun* run = FindRun(text, size);
+    if (run) return run->width;
+    return text ? MeasureText(text, size) : 0;
+}
+
+TextCacheStats GetTextCacheStats() {
+    TextCacheStats st = s_stats;
+    st.glyphs = s_quads.size();
+    return st;
+}
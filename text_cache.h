@@ -0,0 +1,32 @@
+#pragma once
+#include "raylib.h"
+#include <cstddef>
+#include <cstdint>
+
+// ── Text rendering ────────────────────────────────────────────────────────────
+// All dashboard text goes through here and is drawn with retroFont. A string
+// is laid out once per font size into a glyph run: atlas rectangles with
+// offsets from the pen position, plus the width. After that, drawing it only
+// looks the run up and writes its quads into raylib's batch. Text and shapes
+// share the font atlas (a white patch in its corner is the shapes texture),
+// so a frame's panels and text go out in one draw call until something binds
+// another texture or shader.
+//
+// DrawTextRun / MeasureTextRun take the same arguments as DrawText /
+// MeasureText, including their size-based letter spacing.
+
+// After the font is loaded. customFont: the atlas is ours to mark up; the
+// default font already carries the shapes patch.
+void InitTextCache(Font font, bool customFont);
+
+void DrawTextRun(const char* text, int x, int y, int size, Color color);
+int  MeasureTextRun(const char* text, int size);
+
+struct TextCacheStats {
+    uint64_t hits    = 0;   // lookups served from a cached run
+    uint64_t misses  = 0;   // runs laid out
+    uint64_t flushes = 0;   // times the cache filled up and started over
+    int      runs    = 0;   // runs cached now
+    size_t   glyphs  = 0;   // glyph quads cached now
+};
+TextCacheStats GetTextCacheStats();
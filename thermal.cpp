@@ -0,0 +1,173 @@
+// thermal.cpp - cpufreq + hwmon readers used by the stress test and system info
+// Pure logic, NO raylib/drawing includes
+#include "thermal.h"
+#include "sysfs_util.h"
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+#if defined(__linux__)
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+#if defined(__linux__)
+enum class SensorKind { PACKAGE, CORE, GPU };
+
+struct Sensor {
+    int        fd;
+    SensorKind kind;
+    int        priority;   // k10temp: Tdie beats Tctl (Tctl carries an offset on some parts)
+};
+
+static std::mutex          s_mutex;
+static bool                s_scanned = false;
+static std::string         s_scannedRoot;
+static std::vector<Sensor> s_sensors;
+static std::vector<int>    s_freqFd;   // index = logical CPU, -1 = none
+
+static int OpenSensor(const std::string& path) {
+    return open(path.c_str(), O_RDONLY | O_CLOEXEC);
+}
+
+// sysfs attributes re-render on every read from offset 0
+static bool ReadLong(int fd, long& out) {
+    if (fd < 0) return false;
+    char buf[32];
+    ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (n <= 0) return false;
+    buf[n] = 0;
+    char* end = nullptr;
+    out = strtol(buf, &end, 10);
+    return end != buf;
+}
+
+static void CloseAllLocked() {
+    for (const Sensor& s : s_sensors) close(s.fd);
+    for (int fd : s_freqFd) if (fd >= 0) close(fd);
+    s_sensors.clear();
+    s_freqFd.clear();
+}
+
+static void ScanLocked() {
+    CloseAllLocked();
+    s_scannedRoot = GetSysfsRoot();
+    s_scanned = true;
+
+    for (int h = 0; h < 256; h++) {
+        std::string dir = SysfsPath("/sys/class/hwmon/hwmon" + std::to_string(h));
+        std::string name;
+        if (!ReadSysfsLine(dir + "/name", name)) {
+            if (h > 16) break;   // hwmon numbering can have small gaps
+            continue;
+        }
+        bool cpuDriver = name == "coretemp" || name == "k10temp" || name == "zenpower" ||
+                         name == "cpu_thermal" || name == "soc_thermal";
+        bool gpuDriver = name == "amdgpu" || name == "nouveau" || name == "radeon";
+        if (!cpuDriver && !gpuDriver) continue;
+        for (int t = 1; t <= 64; t++) {
+            std::string base = dir + "/temp" + std::to_string(t);
+            int fd = OpenSensor(base + "_input");
+            if (fd < 0) continue;
+            std::string label;
+            ReadSysfsLine(base + "_label", label);
+            Sensor s = { fd, SensorKind::CORE, 0 };
+            if (gpuDriver) {
+                s.kind = SensorKind::GPU;
+                s.priority = label == "edge" || label.empty() ? 1 : 0;
+            } else if (label.rfind("Package", 0) == 0 || label == "Tdie" || label == "Tctl" ||
+                       label.empty()) {
+                s.kind = SensorKind::PACKAGE;
+                s.priority = label == "Tdie" ? 2 : 1;
+            }
+            // "Core N" (Intel) and "TccdN" (AMD) stay CORE
+            s_sensors.push_back(s);
+        }
+    }
+
+    // No package sensor from hwmon: the x86_pkg_temp thermal zone is the same reading
+    bool havePkg = std::any_of(s_sensors.begin(), s_sensors.end(),
+                               [](const Sensor& s) { return s.kind == SensorKind::PACKAGE; });
+    for (int z = 0; !havePkg && z < 64; z++) {
+        std::string dir = SysfsPath("/sys/class/thermal/thermal_zone" + std::to_string(z));
+        std::string type;
+        if (!ReadSysfsLine(dir + "/type", type)) break;
+        if (type != "x86_pkg_temp") continue;
+        int fd = OpenSensor(dir + "/temp");
+        if (fd >= 0) { s_sensors.push_back({ fd, SensorKind::PACKAGE, 1 }); havePkg = true; }
+    }
+
+    for (int c = 0; c < 8192; c++) {
+        std::string dir = SysfsPath("/sys/devices/system/cpu/cpu" + std::to_string(c));
+        int fd = OpenSensor(dir + "/cpufreq/scaling_cur_freq");
+        if (fd < 0) {
+            std::string online;
+            // Stop at the first CPU that doesn't exist at all
+            if (!ReadSysfsLine(dir + "/topology/core_id", online) && !ReadSysfsLine(dir + "/online", online)) break;
+        }
+        s_freqFd.push_back(fd);
+    }
+}
+
+ThermalReading ReadThermal(const std::vector<int>& cpus) {
+    std::lock_guard<std::mutex> lock(s_mutex);
+    if (!s_scanned || s_scannedRoot != GetSysfsRoot()) ScanLocked();
+
+    ThermalReading r;
+    int pkgPriority = -1, gpuPriority = -1;
+    for (const Sensor& s : s_sensors) {
+        long milli;
+        if (!ReadLong(s.fd, milli)) continue;
+        float c = milli / 1000.f;
+        r.valid = true;
+        switch (s.kind) {
+            case SensorKind::PACKAGE:
+                if (s.priority > pkgPriority || (s.priority == pkgPriority && c > r.pkgTempC)) {
+                    r.pkgTempC = c; pkgPriority = s.priority;
+                }
+                break;
+            case SensorKind::CORE:
+                r.maxCoreTempC = std::max(r.maxCoreTempC, c);
+                break;
+            case SensorKind::GPU:
+                if (s.priority > gpuPriority) { r.gpuTempC = c; gpuPriority = s.priority; }
+                break;
+        }
+    }
+    if (r.pkgTempC < 0.f) r.pkgTempC = r.maxCoreTempC;
+
+    std::vector<int> all;
+    const std::vector<int>* list = &cpus;
+    if (cpus.empty()) {
+        for (int c = 0; c < (int)s_freqFd.size(); c++) all.push_back(c);
+        list = &all;
+    }
+    r.coreFreqMHz.assign(list->size(), 0.f);
+    int n = 0;
+    double sum = 0.0;
+    for (size_t i = 0; i < list->size(); i++) {
+        int c = (*list)[i];
+        long khz;
+        if (c < 0 || c >= (int)s_freqFd.size() || !ReadLong(s_freqFd[c], khz)) continue;
+        float mhz = khz / 1000.f;
+        r.coreFreqMHz[i] = mhz;
+        r.minFreqMHz = n == 0 ? mhz : std::min(r.minFreqMHz, mhz);
+        r.maxFreqMHz = std::max(r.maxFreqMHz, mhz);
+        sum += mhz;
+        n++;
+    }
+    if (n > 0) { r.avgFreqMHz = (float)(sum / n); r.valid = true; }
+    return r;
+}
+
+#else
+
+ThermalReading ReadThermal(const std::vector<int>& cpus) {
+    ThermalReading r;
+    r.coreFreqMHz.assign(cpus.size(), 0.f);
+    return r;
+}
+
+#endif
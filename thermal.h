@@ -0,0 +1,21 @@
+#pragma once
+#include <vector>
+
+// ── CPU frequency and temperature sensors ─────────────────────────────────────
+// Linux only: cpufreq under /sys/devices/system/cpu and hwmon drivers under
+// /sys/class/hwmon (coretemp, k10temp, zenpower, amdgpu, nouveau...). Both go
+// through SysfsPath(), so a fake tree works. Other platforms read nothing.
+struct ThermalReading {
+    bool               valid        = false;   // at least one frequency or sensor read
+    float              pkgTempC     = -1.f;    // package / Tctl / Tdie, -1 if none
+    float              maxCoreTempC = -1.f;    // hottest per-core or per-CCD sensor
+    float              gpuTempC     = -1.f;
+    float              avgFreqMHz   = 0.f;     // over the requested CPUs
+    float              minFreqMHz   = 0.f;
+    float              maxFreqMHz   = 0.f;
+    std::vector<float> coreFreqMHz;            // per requested CPU, 0 = unavailable
+};
+
+// Sensor files are discovered once (again if the sysfs root changes) and kept
+// open, so a 10 Hz reader costs one pread per file.
+ThermalReading ReadThermal(const std::vector<int>& cpus);   // empty = every CPU